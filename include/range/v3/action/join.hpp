@@ -18,6 +18,7 @@
 #include <functional>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/to_container.hpp>
 #include <range/v3/action/action.hpp>
 #include <range/v3/action/concepts.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -37,12 +38,32 @@ namespace ranges
             struct join_fn
             {
             private:
+                friend action_access;
+                template<typename Alloc, CONCEPT_REQUIRES_(!Range<Alloc>())>
+                static auto bind(join_fn join, Alloc alloc)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    std::bind(join, std::placeholders::_1, std::move(alloc))
+                )
+
                 template<typename Rng>
                 using join_value_t =
                     meta::if_c<
                         (bool) ranges::Container<range_value_t<Rng>>(),
                         range_value_t<Rng>,
                         std::vector<range_value_t<range_value_t<Rng>>>>;
+
+                // The inner container, if it can be given the allocator, or else
+                // a std::vector that uses it.
+                template<typename Rng, typename Alloc,
+                    typename C = range_value_t<Rng>,
+                    typename V = range_value_t<C>,
+                    typename A = detail::rebind_alloc_t<Alloc, V>>
+                using join_alloc_value_t =
+                    meta::if_c<
+                        (bool) ranges::Container<C>() && (bool) Constructible<C, A>(),
+                        C,
+                        std::vector<V, A>>;
             public:
                 template<typename Rng>
                 using Concept = meta::and_<
@@ -61,6 +82,20 @@ namespace ranges
                     return ret;
                 }
 
+                /// The result is built with a copy of `alloc`, rebound to its
+                /// value type.
+                template<typename Rng, typename Alloc,
+                    CONCEPT_REQUIRES_(Concept<Rng>() && !Range<Alloc>())>
+                join_alloc_value_t<Rng, Alloc> operator()(Rng && rng, Alloc const &alloc) const
+                {
+                    using R = join_alloc_value_t<Rng, Alloc>;
+                    R ret(detail::rebind_alloc_t<Alloc, range_value_t<R>>{alloc});
+                    auto end = ranges::end(rng);
+                    for(auto it = begin(rng); it != end; ++it)
+                        push_back(ret, *it);
+                    return ret;
+                }
+
             #ifndef RANGES_DOXYGEN_INVOKED
                 template<typename Rng, typename T,
                     CONCEPT_REQUIRES_(!Concept<Rng>())>
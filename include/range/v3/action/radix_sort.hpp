@@ -0,0 +1,90 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_ACTION_RADIX_SORT_HPP
+#define RANGES_V3_ACTION_RADIX_SORT_HPP
+
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/action/action.hpp>
+#include <range/v3/algorithm/radix_sort.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-actions
+        /// @{
+        namespace action
+        {
+            struct radix_sort_fn
+            {
+            private:
+                friend action_access;
+                template<typename P, CONCEPT_REQUIRES_(!Range<P>())>
+                static auto bind(radix_sort_fn radix_sort, P proj)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    std::bind(radix_sort, std::placeholders::_1, protect(std::move(proj)))
+                )
+            public:
+                template<typename Rng, typename P = ident>
+                using Concept = meta::and_<
+                    RandomAccessRange<Rng>, RadixSortable<range_iterator_t<Rng>, P>>;
+
+                template<typename Rng, typename P = ident,
+                    CONCEPT_REQUIRES_(Concept<Rng, P>())>
+                Rng operator()(Rng && rng, P proj = P{}) const
+                {
+                    ranges::radix_sort(rng, std::move(proj));
+                    return std::forward<Rng>(rng);
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename P = ident,
+                    CONCEPT_REQUIRES_(!Concept<Rng, P>())>
+                void operator()(Rng &&, P && = P{}) const
+                {
+                    CONCEPT_ASSERT_MSG(RandomAccessRange<Rng>(),
+                        "The object on which action::radix_sort operates must be a model of the "
+                        "RandomAccessRange concept.");
+                    using I = range_iterator_t<Rng>;
+                    CONCEPT_ASSERT_MSG(IndirectInvocable<P, I>(),
+                        "The projection function must accept objects of the iterator's value type, "
+                        "reference type, and common reference type.");
+                    CONCEPT_ASSERT_MSG(Permutable<I>(),
+                        "The iterator type of the range passed to action::radix_sort must allow "
+                        "its elements to be permuted; that is, the values must be movable and the "
+                        "iterator must be mutable.");
+                    CONCEPT_ASSERT_MSG(RadixSortable<I, P>(),
+                        "action::radix_sort sorts by keys that are integers, IEEE float or "
+                        "double, std::array<unsigned char, N> or std::string; the projection "
+                        "function, or the range's value type if there is none, must yield one.");
+                }
+            #endif
+            };
+
+            /// \ingroup group-actions
+            /// \relates radix_sort_fn
+            /// \sa `action`
+            RANGES_INLINE_VARIABLE(action<radix_sort_fn>, radix_sort)
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -18,6 +18,7 @@
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/action/action.hpp>
 #include <range/v3/algorithm/shuffle.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
@@ -42,6 +43,15 @@ namespace ranges
                 (
                     std::bind(shuffle, std::placeholders::_1, bind_forward<Gen>(gen))
                 )
+                template<typename E, typename Gen,
+                    CONCEPT_REQUIRES_(ExecutionPolicy<E>() &&
+                        UniformRandomNumberGenerator<Gen>())>
+                static auto bind(shuffle_fn shuffle, E policy, Gen && gen)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    std::bind(shuffle, std::placeholders::_1, std::move(policy),
+                        bind_forward<Gen>(gen))
+                )
             public:
                 struct ConceptImpl
                 {
@@ -69,6 +79,15 @@ namespace ranges
                     return std::forward<Rng>(rng);
                 }
 
+                /// With a parallel policy, shuffles as `ranges::shuffle(policy, rng, gen)`.
+                template<typename Rng, typename E, typename Gen,
+                    CONCEPT_REQUIRES_(ExecutionPolicy<E>() && Concept<Rng, Gen>())>
+                Rng operator()(Rng && rng, E && policy, Gen && gen) const
+                {
+                    ranges::shuffle(static_cast<E &&>(policy), rng, std::forward<Gen>(gen));
+                    return std::forward<Rng>(rng);
+                }
+
             #ifndef RANGES_DOXYGEN_INVOKED
                 template<typename Rng, typename Gen,
                     CONCEPT_REQUIRES_(!Concept<Rng, Gen>())>
@@ -45,6 +45,29 @@ namespace ranges
                         (bool) ranges::Container<Rng>(),
                         uncvref_t<Rng>,
                         std::vector<range_value_t<Rng>>>;
+
+                // With an allocator: the range's own container type, if it can
+                // be given the allocator, or else a std::vector that uses it.
+                template<typename Rng, typename Alloc,
+                    typename V = range_value_t<Rng>,
+                    typename A = detail::rebind_alloc_t<Alloc, V>>
+                using split_alloc_value_t =
+                    meta::if_c<
+                        (bool) ranges::Container<Rng>() &&
+                            (bool) Constructible<uncvref_t<Rng>, A>(),
+                        uncvref_t<Rng>,
+                        std::vector<V, A>>;
+                template<typename Rng, typename Alloc,
+                    typename V = split_alloc_value_t<Rng, Alloc>>
+                using split_alloc_t = std::vector<V, detail::rebind_alloc_t<Alloc, V>>;
+
+                template<typename Rng, typename Alloc, typename Parts>
+                static split_alloc_t<Rng, Alloc> collect(Parts parts, Alloc const &alloc)
+                {
+                    return parts
+                         | view::transform(to_<split_alloc_value_t<Rng, Alloc>>(alloc))
+                         | to_<split_alloc_t<Rng, Alloc>>(alloc);
+                }
             public:
                 // BUGBUG something is not right with the actions. It should be possible
                 // to move a container into a split and have elements moved into the result.
@@ -77,6 +100,38 @@ namespace ranges
                          | view::transform(to_<split_value_t<Rng>>()) | to_vector;
                 }
 
+                /// As above, but the pieces and the vector of them are built with
+                /// copies of `alloc`, rebound to their value types.
+                template<typename Rng, typename Fun, typename Alloc,
+                    CONCEPT_REQUIRES_(view::split_fn::FunctionConcept<Rng, Fun>())>
+                split_alloc_t<Rng, Alloc> operator()(Rng && rng, Fun fun,
+                    Alloc const &alloc) const
+                {
+                    return split_fn::collect<Rng>(view::split(rng, std::move(fun)), alloc);
+                }
+                template<typename Rng, typename Fun, typename Alloc,
+                    CONCEPT_REQUIRES_(view::split_fn::PredicateConcept<Rng, Fun>())>
+                split_alloc_t<Rng, Alloc> operator()(Rng && rng, Fun fun,
+                    Alloc const &alloc) const
+                {
+                    return split_fn::collect<Rng>(view::split(rng, std::move(fun)), alloc);
+                }
+                template<typename Rng, typename Alloc,
+                    CONCEPT_REQUIRES_(view::split_fn::ElementConcept<Rng>())>
+                split_alloc_t<Rng, Alloc> operator()(Rng && rng, range_value_t<Rng> val,
+                    Alloc const &alloc) const
+                {
+                    return split_fn::collect<Rng>(view::split(rng, std::move(val)), alloc);
+                }
+                template<typename Rng, typename Sub, typename Alloc,
+                    CONCEPT_REQUIRES_(view::split_fn::SubRangeConcept<Rng, Sub>())>
+                split_alloc_t<Rng, Alloc> operator()(Rng && rng, Sub && sub,
+                    Alloc const &alloc) const
+                {
+                    return split_fn::collect<Rng>(view::split(rng, std::forward<Sub>(sub)),
+                        alloc);
+                }
+
             #ifndef RANGES_DOXYGEN_INVOKED
                 template<typename Rng, typename T,
                     CONCEPT_REQUIRES_(!ConvertibleTo<T, range_value_t<Rng>>())>
@@ -64,6 +64,7 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/algorithm/partition_copy.hpp>
 #include <range/v3/algorithm/partition_point.hpp>
 #include <range/v3/algorithm/permutation.hpp>
+#include <range/v3/algorithm/radix_sort.hpp>
 #include <range/v3/algorithm/remove.hpp>
 #include <range/v3/algorithm/remove_copy.hpp>
 #include <range/v3/algorithm/remove_copy_if.hpp>
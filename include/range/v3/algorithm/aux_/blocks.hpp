@@ -0,0 +1,144 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_BLOCKS_HPP
+#define RANGES_V3_ALGORITHM_AUX_BLOCKS_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_access.hpp>
+#include <range/v3/algorithm/aux_/segments.hpp>
+#include <range/v3/utility/basic_iterator.hpp>
+#include <range/v3/utility/concepts.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // A cursor can hand out the values of its range a block at a time
+            // with a member
+            //
+            //     std::ptrdiff_t read_block(V *out, std::ptrdiff_t n, End const &end);
+            //
+            // which copies the values of up to n elements of [*this, end) to out,
+            // where V is the cursor's value type, advances past them, and returns
+            // how many it copied: at least one unless the cursor is at end. n is
+            // at most block_size(). End is as for for_each_segment. A view adapts
+            // the blocks of its underlying range with a loop over the block,
+            // which the compiler can vectorize where it cannot vectorize the
+            // same work done an element at a time through the cursors.
+            //
+            // An adaptor can provide the same member as
+            //
+            //     std::ptrdiff_t read_block(BaseIter &it, BaseEnd const &end, V *out,
+            //         std::ptrdiff_t n);
+            //
+            // where BaseEnd is the underlying iterator or sentinel that the end
+            // of the adapted range holds. Its functions see what they would an
+            // element at a time: the underlying references, or, once copied
+            // into a block, only the values of ranges whose references are
+            // values.
+            constexpr std::ptrdiff_t block_size()
+            {
+                return 256;
+            }
+
+            template<typename I, typename S, typename = void>
+            struct blocked_
+              : std::false_type
+            {};
+            template<typename Cur, typename S>
+            struct blocked_<basic_iterator<Cur>, S, meta::void_<decltype(
+                range_access::read_block(std::declval<Cur &>(),
+                    std::declval<iterator_value_t<basic_iterator<Cur>> *>(), std::ptrdiff_t{},
+                    detail::segment_end(std::declval<S const &>())))>>
+              : std::true_type
+            {};
+
+            // Whether the cursor of [I, S) hands out blocks.
+            template<typename I, typename S>
+            using blocked = meta::_t<blocked_<I, S>>;
+
+            template<typename I, typename S, typename V,
+                CONCEPT_REQUIRES_(blocked<I, S>())>
+            std::ptrdiff_t read_block_(I &it, S const &end, V *out, std::ptrdiff_t n, int)
+            {
+                return range_access::read_block(range_access::pos(it), out, n,
+                    detail::segment_end(end));
+            }
+            template<typename I, typename S, typename V,
+                CONCEPT_REQUIRES_(RandomAccessIterator<I>() && SizedSentinel<S, I>())>
+            std::ptrdiff_t read_block_(I &it, S const &end, V *out, std::ptrdiff_t n, long)
+            {
+                auto const left = static_cast<std::ptrdiff_t>(end - it);
+                n = left < n ? left : n;
+                for(std::ptrdiff_t i = 0; i < n; ++i)
+                    out[i] = it[static_cast<iterator_difference_t<I>>(i)];
+                it += static_cast<iterator_difference_t<I>>(n);
+                return n;
+            }
+
+            // Copies the values of up to n elements of [it, end) to out, from
+            // the cursor's blocks or by indexing the iterator, and advances it
+            // past them. Returns how many, which is 0 only at end.
+            template<typename I, typename S, typename V>
+            auto read_block(I &it, S const &end, V *out, std::ptrdiff_t n) ->
+                decltype(detail::read_block_(it, end, out, n, 42))
+            {
+                RANGES_EXPECT(0 < n && n <= detail::block_size());
+                return detail::read_block_(it, end, out, n, 42);
+            }
+
+            template<typename I, typename S, typename V = iterator_value_t<I>, typename = void>
+            struct block_readable_
+              : std::false_type
+            {};
+            template<typename I, typename S, typename V>
+            struct block_readable_<I, S, V, meta::void_<decltype(detail::read_block(
+                std::declval<I &>(), std::declval<S const &>(), std::declval<V *>(),
+                std::ptrdiff_t{}))>>
+              : meta::and_<DefaultConstructible<V>, Movable<V>>
+            {};
+
+            // Whether detail::read_block can read [I, S) into a buffer of its
+            // values.
+            template<typename I, typename S>
+            using block_readable = meta::_t<block_readable_<I, S>>;
+
+            // Whether an algorithm over [I, S) should take its values a block at
+            // a time: the cursor hands out blocks, and they are cheap to copy.
+            template<typename I, typename S>
+            using block_copyable = meta::strict_and<
+                blocked<I, S>,
+                std::is_trivial<iterator_value_t<I>>>;
+
+            // Whether a loop over [I, S) that does little with each value should
+            // take the values a block at a time. A loop that indexes a
+            // random-access range is vectorized as well without the copy.
+            template<typename I, typename S>
+            using block_loopable = meta::strict_and<
+                block_copyable<I, S>,
+                meta::not_<meta::strict_and<RandomAccessIterator<I>, SizedSentinel<S, I>>>>;
+        }
+        /// \endcond
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -0,0 +1,139 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_GALLOP_HPP
+#define RANGES_V3_ALGORITHM_AUX_GALLOP_HPP
+
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Whether [I, S) can be searched by jumping ahead.
+            template<typename I, typename S>
+            using gallopable = meta::bool_<RandomAccessIterator<I>() && SizedSentinel<S, I>()>;
+
+            // Steps taken one at a time before galloping. Merging inputs of
+            // similar density rarely takes more, and stepping is cheaper than
+            // searching for so few.
+            constexpr int gallop_linear_steps()
+            {
+                return 8;
+            }
+
+            // How many times larger one input must be than the other for the
+            // set algorithms to gallop through it rather than merge. Merging
+            // touches every element, but its comparisons are predictable, or
+            // compile to conditional moves, so it wins at lesser ratios.
+            constexpr int gallop_min_ratio()
+            {
+                return 16;
+            }
+
+            template<typename I1, typename S1, typename I2, typename S2>
+            bool gallop_through(I1 const &begin1, S1 const &end1, I2 const &begin2,
+                S2 const &end2, std::true_type)
+            {
+                return (end1 - begin1) / detail::gallop_min_ratio() >= end2 - begin2;
+            }
+            template<typename I1, typename S1, typename I2, typename S2>
+            bool gallop_through(I1 const &, S1 const &, I2 const &, S2 const &, std::false_type)
+            {
+                return false;
+            }
+
+            // Whether to gallop through [begin1, end1) to the elements of
+            // [begin2, end2), rather than merge them.
+            template<typename I1, typename S1, typename I2, typename S2>
+            bool gallop_through(I1 const &begin1, S1 const &end1, I2 const &begin2,
+                S2 const &end2)
+            {
+                return detail::gallop_through(begin1, end1, begin2, end2,
+                    meta::bool_<gallopable<I1, S1>() && SizedSentinel<S2, I2>()>{});
+            }
+
+            template<typename I, typename S, typename J, typename C, typename P, typename Q>
+            I gallop_less(I it, S const &end, J const &other, C &pred, P &proj, Q &other_proj,
+                std::false_type)
+            {
+                while(it != end && invoke(pred, invoke(proj, *it), invoke(other_proj, *other)))
+                    ++it;
+                return it;
+            }
+
+            // Exponential search (J. L. Bentley and A. C.-C. Yao, "An Almost
+            // Optimal Algorithm for Unbounded Searching", IPL 5(3), 1976): probe
+            // 1, 2, 4, ... elements ahead, and binary search the last stride,
+            // for O(log d) comparisons to skip d elements.
+            template<typename I, typename S, typename J, typename C, typename P, typename Q>
+            I gallop_less(I it, S const &end, J const &other, C &pred, P &proj, Q &other_proj,
+                std::true_type)
+            {
+                using D = iterator_difference_t<I>;
+                D const n = end - it;
+                // Every element before lo is less, and hi, once the loop ends,
+                // is either n or the position of one that is not.
+                D lo = 0, hi = 0, step = 1;
+                while(hi < n &&
+                    invoke(pred, invoke(proj, *(it + hi)), invoke(other_proj, *other)))
+                {
+                    lo = hi + 1;
+                    hi = step < n - hi ? hi + step : n;
+                    step *= 2;
+                }
+                while(lo < hi)
+                {
+                    D const mid = lo + (hi - lo) / 2;
+                    if(invoke(pred, invoke(proj, *(it + mid)), invoke(other_proj, *other)))
+                        lo = mid + 1;
+                    else
+                        hi = mid;
+                }
+                return it + lo;
+            }
+
+            // Advances it past the elements of [it, end) whose projections are
+            // less than that of *other, galloping where the iterators permit
+            // it. *other is read again for every comparison, as a merge would,
+            // since it may be a temporary.
+            template<typename I, typename S, typename J, typename C, typename P, typename Q>
+            I gallop_less(I it, S const &end, J const &other, C &pred, P &proj, Q &other_proj)
+            {
+                return detail::gallop_less(std::move(it), end, other, pred, proj, other_proj,
+                    gallopable<I, S>{});
+            }
+
+            // As gallop_less, but stepping first, for when the skip is likely
+            // to be short.
+            template<typename I, typename S, typename J, typename C, typename P, typename Q>
+            I skip_less(I it, S const &end, J const &other, C &pred, P &proj, Q &other_proj)
+            {
+                for(int i = 0; i < detail::gallop_linear_steps(); ++i, ++it)
+                    if(it == end || !invoke(pred, invoke(proj, *it), invoke(other_proj, *other)))
+                        return it;
+                return detail::gallop_less(std::move(it), end, other, pred, proj, other_proj);
+            }
+        }
+        /// \endcond
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
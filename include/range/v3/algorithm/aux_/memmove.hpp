@@ -0,0 +1,81 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_MEMMOVE_HPP
+#define RANGES_V3_ALGORITHM_AUX_MEMMOVE_HPP
+
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Whether assigning elements of [I, I + n) to [O, O + n) may be
+            // done with a single memmove: both sides are contiguous lvalues of
+            // the same non-volatile type, the sentinel can be subtracted, and
+            // the assignment selected by Trivial<T> is a bytewise copy.
+            template<typename I, typename S, typename O,
+                template<typename...> class Trivial,
+                typename RI = iterator_reference_t<I>,
+                typename RO = iterator_reference_t<O>,
+                typename T = meta::_t<std::remove_reference<RO>>>
+            using memmove_assignable = meta::bool_<
+                is_contiguous_iterator<I>::value &&
+                is_contiguous_iterator<O>::value &&
+                SizedSentinel<S, I>::value &&
+                std::is_lvalue_reference<RI>::value &&
+                std::is_lvalue_reference<RO>::value &&
+                std::is_same<meta::_t<std::remove_cv<meta::_t<std::remove_reference<RI>>>>, T>::value &&
+                !std::is_volatile<meta::_t<std::remove_reference<RI>>>::value &&
+                Trivial<T>::value>;
+
+            template<typename I, typename S, typename O>
+            using memmove_copyable = memmove_assignable<I, S, O, is_trivially_copy_assignable>;
+
+            template<typename I, typename S, typename O>
+            using memmove_movable = memmove_assignable<I, S, O, is_trivially_move_assignable>;
+
+            // Assign the n elements starting at begin to those starting at
+            // out. The ranges may overlap. Returns out + n.
+            template<typename I, typename O>
+            O memmove_n(I begin, iterator_difference_t<I> n, O out)
+            {
+                if(n > 0)
+                    std::memmove(std::addressof(*out), std::addressof(*begin),
+                        static_cast<std::size_t>(n) * sizeof(iterator_value_t<O>));
+                return out + n;
+            }
+
+            // Assign the n elements starting at begin to the n elements ending
+            // at out. The ranges may overlap. Returns out - n.
+            template<typename I, typename O>
+            O memmove_backward_n(I begin, iterator_difference_t<I> n, O out)
+            {
+                out -= n;
+                detail::memmove_n(begin, n, out);
+                return out;
+            }
+        }
+        /// \endcond
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
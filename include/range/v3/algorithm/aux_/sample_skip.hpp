@@ -0,0 +1,213 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_SAMPLE_SKIP_HPP
+#define RANGES_V3_ALGORITHM_AUX_SAMPLE_SKIP_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/random.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // A uniformly distributed double in (0, 1], from the top 53 bits of
+            // a random word.
+            template<typename Gen>
+            double uniform_open_closed(Gen &gen)
+            {
+                std::uint64_t const bits = detail::random_bits<std::uint64_t>(gen) >> 11;
+                return static_cast<double>(bits + 1) * (1.0 / 9007199254740992.0);
+            }
+
+            // Converts a non-negative double to D, saturating at D's maximum.
+            template<typename D>
+            D saturate_cast(double d)
+            {
+                return d < static_cast<double>(std::numeric_limits<D>::max()) ?
+                    static_cast<D>(d) : std::numeric_limits<D>::max();
+            }
+
+            // Draws a uniformly random sample of n of N elements in order, as the
+            // number of elements to skip before each element of the sample, with
+            // Vitter's Algorithm D (J. S. Vitter, "An Efficient Algorithm for
+            // Sequential Random Sampling", ACM TOMS 13(1), 1987): O(1) random
+            // numbers per element of the sample, however large the population.
+            // When the sample is more than a 13th of what remains, Algorithm A
+            // is cheaper; it also takes one random number per element, but
+            // O(skip) arithmetic.
+            template<typename D>
+            class sample_skipper
+            {
+                D pop_size_ = 0;
+                D n_ = 0;
+                // For Algorithm D, a variate from the previous draw, or < 0.
+                double vprime_ = -1.0;
+
+                static constexpr D alpha_inverse()
+                {
+                    return 13;
+                }
+
+                template<typename Gen>
+                D algorithm_a(Gen &gen)
+                {
+                    double const v = detail::uniform_open_closed(gen);
+                    double top = static_cast<double>(pop_size_ - n_);
+                    double pop = static_cast<double>(pop_size_);
+                    double quot = top / pop;
+                    D s = 0;
+                    // 1 - v, since v is in (0, 1].
+                    while(quot > 1.0 - v)
+                    {
+                        ++s;
+                        top -= 1.0;
+                        pop -= 1.0;
+                        quot *= top / pop;
+                    }
+                    return s;
+                }
+
+                template<typename Gen>
+                D algorithm_d(Gen &gen)
+                {
+                    double const n = static_cast<double>(n_);
+                    double const pop = static_cast<double>(pop_size_);
+                    double const qu1 = static_cast<double>(pop_size_ - n_ + 1);
+                    double const nmin1inv = 1.0 / (n - 1.0);
+                    if(vprime_ < 0.0)
+                        vprime_ = std::exp(std::log(detail::uniform_open_closed(gen)) / n);
+                    for(;;)
+                    {
+                        double x, s;
+                        // D2: a candidate from the continuous approximation
+                        for(;;)
+                        {
+                            x = pop * (1.0 - vprime_);
+                            s = std::floor(x);
+                            if(s < qu1)
+                                break;
+                            vprime_ = std::exp(std::log(detail::uniform_open_closed(gen)) / n);
+                        }
+                        double const u = detail::uniform_open_closed(gen);
+                        // D3: accept by the squeeze test
+                        double const y1 = std::exp(std::log(u * pop / qu1) * nmin1inv);
+                        vprime_ = y1 * (1.0 - x / pop) * (qu1 / (qu1 - s));
+                        if(vprime_ <= 1.0)
+                            return static_cast<D>(s);
+                        // D4: accept by the exact test
+                        double y2 = 1.0, top = pop - 1.0, bottom, limit;
+                        if(n - 1.0 > s)
+                        {
+                            bottom = pop - n;
+                            limit = pop - s;
+                        }
+                        else
+                        {
+                            bottom = pop - 1.0 - s;
+                            limit = qu1;
+                        }
+                        for(double t = pop - 1.0; t >= limit; t -= 1.0)
+                        {
+                            y2 = y2 * top / bottom;
+                            top -= 1.0;
+                            bottom -= 1.0;
+                        }
+                        if(pop / (pop - x) >= y1 * std::exp(std::log(y2) * nmin1inv))
+                        {
+                            vprime_ = std::exp(
+                                std::log(detail::uniform_open_closed(gen)) * nmin1inv);
+                            return static_cast<D>(s);
+                        }
+                        vprime_ = std::exp(std::log(detail::uniform_open_closed(gen)) / n);
+                    }
+                }
+
+            public:
+                sample_skipper() = default;
+                sample_skipper(D pop_size, D n)
+                  : pop_size_(pop_size), n_(n < pop_size ? n : pop_size)
+                {
+                    RANGES_EXPECT(pop_size >= 0);
+                    if(n_ < 0)
+                        n_ = 0;
+                }
+                // The elements of the sample not yet drawn.
+                D remaining() const
+                {
+                    return n_;
+                }
+                // The number of elements to skip before the next element of the
+                // sample.
+                template<typename Gen>
+                D next(Gen &gen)
+                {
+                    RANGES_EXPECT(n_ > 0);
+                    D s;
+                    if(n_ == 1)
+                        s = static_cast<D>(detail::bounded_random(gen,
+                            static_cast<std::uint64_t>(pop_size_)));
+                    else if(n_ * sample_skipper::alpha_inverse() >= pop_size_)
+                    {
+                        s = algorithm_a(gen);
+                        vprime_ = -1.0;
+                    }
+                    else
+                        s = algorithm_d(gen);
+                    RANGES_ASSERT(s <= pop_size_ - n_);
+                    pop_size_ -= s + 1;
+                    --n_;
+                    return s;
+                }
+            };
+
+            // The skips between the replacements of a reservoir of n elements, as
+            // the elements of a range of unknown size go by, with Li's Algorithm L
+            // (K.-H. Li, "Reservoir-Sampling Algorithms of Time Complexity
+            // O(n(1 + log(N/n)))", ACM TOMS 20(4), 1994).
+            template<typename D>
+            class reservoir_skipper
+            {
+                double n_;
+                double w_;
+
+            public:
+                template<typename Gen>
+                reservoir_skipper(D n, Gen &gen)
+                  : n_(static_cast<double>(n))
+                  , w_(std::exp(std::log(detail::uniform_open_closed(gen)) / n_))
+                {
+                    RANGES_EXPECT(n > 0);
+                }
+                // The number of elements to skip before the next one that replaces
+                // an element of the reservoir.
+                template<typename Gen>
+                D next(Gen &gen)
+                {
+                    double const s = std::floor(
+                        std::log(detail::uniform_open_closed(gen)) / std::log1p(-w_));
+                    w_ *= std::exp(std::log(detail::uniform_open_closed(gen)) / n_);
+                    return detail::saturate_cast<D>(s);
+                }
+            };
+        }
+        /// \endcond
+    }
+}
+
+#endif
@@ -0,0 +1,125 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_SEGMENTS_HPP
+#define RANGES_V3_ALGORITHM_AUX_SEGMENTS_HPP
+
+#include <type_traits>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_access.hpp>
+#include <range/v3/utility/basic_iterator.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // A cursor whose range is made of several underlying ranges laid end
+            // to end (join, concat) can expose them with a member
+            //
+            //     template<typename Fun>
+            //     void for_each_segment(Fun &fun, End const &end);
+            //
+            // which calls fun(first, last) for each piece of [*this, end) that
+            // lies within a single underlying range, in order. fun advances
+            // first, and leaves it short of last to stop the traversal. The
+            // cursor is left where the traversal stopped. End is the cursor's
+            // own type when the range is bounded and its sentinel type otherwise.
+            template<typename S>
+            S const &segment_end(S const &end)
+            {
+                return end;
+            }
+            template<typename Cur>
+            Cur const &segment_end(basic_iterator<Cur> const &end)
+            {
+                return range_access::pos(end);
+            }
+
+            struct segment_probe
+            {
+                template<typename I, typename S>
+                void operator()(I &, S const &) const;
+            };
+
+            template<typename I, typename S, typename = void>
+            struct segmented_
+              : std::false_type
+            {};
+            template<typename Cur, typename S>
+            struct segmented_<basic_iterator<Cur>, S, meta::void_<decltype(
+                range_access::for_each_segment(std::declval<Cur &>(),
+                    std::declval<segment_probe &>(), detail::segment_end(std::declval<S const &>())))>>
+              : std::true_type
+            {};
+
+            // Whether [I, S) can be traversed a segment at a time.
+            template<typename I, typename S>
+            using segmented = meta::_t<segmented_<I, S>>;
+
+            // Calls fun(first, last) on each segment of [begin, end), and returns
+            // the position at which the traversal stopped.
+            template<typename Cur, typename S, typename Fun>
+            basic_iterator<Cur> for_each_segment(basic_iterator<Cur> begin, S const &end, Fun fun)
+            {
+                range_access::for_each_segment(range_access::pos(begin), fun,
+                    detail::segment_end(end));
+                return begin;
+            }
+
+            // The algorithms traverse joined and concatenated ranges one
+            // underlying range at a time, each with a loop of its own. An
+            // algorithm supplies that loop as step(first, last), which advances
+            // first, and leaves it short of last to stop. visit_segments calls
+            // it on [begin, end) or, if that can be traversed a segment at a
+            // time, on each segment in turn, down to ranges that cannot, and
+            // returns the position at which the traversal stopped.
+            template<typename I, typename S, typename Step>
+            I visit_segments(I begin, S const &end, Step &step);
+
+            template<typename Step>
+            struct segment_visitor
+            {
+                Step &step;
+                template<typename J, typename T>
+                void operator()(J &first, T const &last) const
+                {
+                    first = detail::visit_segments(std::move(first), last, step);
+                }
+            };
+            template<typename I, typename S, typename Step>
+            I visit_segments(I begin, S const &end, Step &step, std::false_type)
+            {
+                step(begin, end);
+                return begin;
+            }
+            template<typename I, typename S, typename Step>
+            I visit_segments(I begin, S const &end, Step &step, std::true_type)
+            {
+                return detail::for_each_segment(std::move(begin), end,
+                    segment_visitor<Step>{step});
+            }
+            template<typename I, typename S, typename Step>
+            I visit_segments(I begin, S const &end, Step &step)
+            {
+                return detail::visit_segments(std::move(begin), end, step, segmented<I, S>{});
+            }
+        }
+        /// \endcond
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
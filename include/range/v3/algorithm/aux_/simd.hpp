@@ -0,0 +1,887 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_SIMD_HPP
+#define RANGES_V3_ALGORITHM_AUX_SIMD_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+
+// Define RANGES_NO_SIMD to compile the scalar kernels only.
+#if !defined(RANGES_NO_SIMD) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define RANGES_SIMD_SSE2 1
+#include <emmintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+// AVX2 kernels are compiled with a target attribute and selected at run time,
+// so they are available whatever -m flags the translation unit uses.
+#define RANGES_SIMD_AVX2 1
+#include <immintrin.h>
+#endif
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Whether [I, S) can be handed to the kernels below as a `T const *`
+            // range, where T is an arithmetic value type, and the caller asked
+            // for plain element comparison.
+            template<typename I, typename S, typename P,
+                typename R = iterator_reference_t<I>,
+                typename T = meta::_t<std::remove_reference<R>>>
+            using contiguous_scalar_range = meta::bool_<
+                is_contiguous_iterator<I>::value &&
+                SizedSentinel<S, I>::value &&
+                std::is_same<P, ident>::value &&
+                std::is_lvalue_reference<R>::value &&
+                !std::is_volatile<T>::value &&
+                std::is_arithmetic<T>::value &&
+                !std::is_same<meta::_t<std::remove_cv<T>>, bool>::value &&
+                (std::is_floating_point<T>::value
+                    ? sizeof(T) == 4 || sizeof(T) == 8
+                    : sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)>;
+
+            // Two contiguous scalar ranges with the same element type.
+            template<typename I0, typename S0, typename P0, typename I1, typename S1, typename P1>
+            using contiguous_scalar_ranges = meta::bool_<
+                contiguous_scalar_range<I0, S0, P0>::value &&
+                contiguous_scalar_range<I1, S1, P1>::value &&
+                std::is_same<iterator_value_t<I0>, iterator_value_t<I1>>::value>;
+
+            // Whether elements of type T can be searched for a value of type V
+            // by first converting the value to T (see scalar_cast).
+            template<typename T, typename V>
+            using scalar_value_compatible = meta::bool_<
+                std::is_same<T, V>::value ||
+                (std::is_integral<T>::value && std::is_integral<V>::value &&
+                    !std::is_same<V, bool>::value)>;
+
+            // find and count: contiguous scalars compared with == against val.
+            template<typename I, typename S, typename V, typename P>
+            using scalar_findable = meta::bool_<
+                contiguous_scalar_range<I, S, P>::value &&
+                scalar_value_compatible<iterator_value_t<I>, V>::value>;
+
+            template<typename C, typename T>
+            using is_equal_to = meta::bool_<
+                std::is_same<C, ranges::equal_to>::value ||
+                std::is_same<C, std::equal_to<T>>::value>;
+
+            template<typename C, typename T>
+            using is_less = meta::bool_<
+                std::is_same<C, ranges::less>::value ||
+                std::is_same<C, ranges::ordered_less>::value ||
+                std::is_same<C, std::less<T>>::value>;
+
+            // set_intersection: contiguous 32- or 64-bit integers of the same
+            // type, ordered by <.
+            template<typename I0, typename S0, typename P0, typename I1, typename S1,
+                typename P1, typename C, typename T = iterator_value_t<I0>>
+            using scalar_intersectable = meta::bool_<
+                contiguous_scalar_ranges<I0, S0, P0, I1, S1, P1>::value &&
+                std::is_integral<T>::value &&
+                (sizeof(T) == 4 || sizeof(T) == 8) &&
+                is_less<C, T>::value>;
+
+            // Convert val to the T that compares equal to it. Returns false if
+            // no value of type T compares equal to val.
+            template<typename T, typename V>
+            bool scalar_cast(V const &val, T &t)
+            {
+                t = static_cast<T>(val);
+                return static_cast<V>(t) == val;
+            }
+
+            template<typename I>
+            iterator_value_t<I> const *scalar_pointer(I it)
+            {
+                return std::addressof(*it);
+            }
+
+            // Kernels over `T const *` ranges. Each has a portable scalar loop;
+            // on x86 the SSE2 kernel is always available and the AVX2 one is
+            // used when the CPU reports it.
+            namespace simd
+            {
+                template<typename T>
+                std::size_t find_scalar(T const *p, std::size_t n, T val)
+                {
+                    std::size_t i = 0;
+                    for(; i != n; ++i)
+                        if(p[i] == val)
+                            break;
+                    return i;
+                }
+
+                template<typename T>
+                std::size_t count_scalar(T const *p, std::size_t n, T val)
+                {
+                    std::size_t c = 0;
+                    for(std::size_t i = 0; i != n; ++i)
+                        c += p[i] == val;
+                    return c;
+                }
+
+                template<typename T>
+                std::size_t mismatch_scalar(T const *p, T const *q, std::size_t n)
+                {
+                    std::size_t i = 0;
+                    for(; i != n; ++i)
+                        if(!(p[i] == q[i]))
+                            break;
+                    return i;
+                }
+
+                /// A set of bytes, for finding the first byte in or out of the
+                /// set. Besides a table, the set is kept as two 16-entry tables
+                /// indexed by the low and high nibble of a byte, whose bitwise
+                /// and is nonzero just for members: each distinct set of low
+                /// nibbles that some high nibble allows gets one of 8 bits.
+                /// Sets that need more than 8 such bits are scanned with the
+                /// table alone.
+                struct byte_class
+                {
+                    bool table[256];
+                    unsigned char lo[16];
+                    unsigned char hi[16];
+                    bool nibbles;
+
+                    byte_class() = default;
+                    template<typename Pred>
+                    explicit byte_class(Pred pred)
+                      : table{}, lo{}, hi{}, nibbles(true)
+                    {
+                        for(unsigned c = 0; c != 256; ++c)
+                            table[c] = pred(static_cast<unsigned char>(c));
+                        unsigned rows[8];
+                        unsigned nrows = 0;
+                        for(unsigned h = 0; h != 16 && nibbles; ++h)
+                        {
+                            unsigned row = 0;
+                            for(unsigned l = 0; l != 16; ++l)
+                                row |= unsigned(table[h * 16 + l]) << l;
+                            if(row == 0)
+                                continue;
+                            unsigned r = 0;
+                            while(r != nrows && rows[r] != row)
+                                ++r;
+                            if(r == nrows)
+                            {
+                                if(nrows == 8)
+                                {
+                                    nibbles = false;
+                                    break;
+                                }
+                                rows[nrows++] = row;
+                                for(unsigned l = 0; l != 16; ++l)
+                                    if(row >> l & 1u)
+                                        lo[l] = static_cast<unsigned char>(lo[l] | 1u << r);
+                            }
+                            hi[h] = static_cast<unsigned char>(1u << r);
+                        }
+                    }
+                    bool operator()(unsigned char c) const
+                    {
+                        return table[c];
+                    }
+                };
+
+                inline std::size_t find_class_scalar(unsigned char const *p, std::size_t n,
+                    byte_class const &cls, bool member)
+                {
+                    std::size_t i = 0;
+                    for(; i != n; ++i)
+                        if(cls.table[p[i]] == member)
+                            break;
+                    return i;
+                }
+
+                // At most `steps` steps of a merge of [a, a + na) and [b, b +
+                // nb) from a[i] and b[j], calling emit(k) for each a[k] that
+                // is matched.
+                template<typename T, typename F>
+                void merge_steps(T const *a, std::size_t na, T const *b, std::size_t nb,
+                    std::size_t &i, std::size_t &j, std::size_t steps, F &emit)
+                {
+                    for(; steps != 0 && i != na && j != nb; --steps)
+                    {
+                        if(a[i] < b[j])
+                            ++i;
+                        else if(b[j] < a[i])
+                            ++j;
+                        else
+                        {
+                            emit(i);
+                            ++i;
+                            ++j;
+                        }
+                    }
+                }
+
+#ifdef RANGES_SIMD_SSE2
+                inline unsigned ctz(unsigned m)
+                {
+#if defined(__GNUC__) || defined(__clang__)
+                    return static_cast<unsigned>(__builtin_ctz(m));
+#else
+                    unsigned i = 0;
+                    for(; !(m & 1u); m >>= 1)
+                        ++i;
+                    return i;
+#endif
+                }
+
+                inline unsigned popcount(unsigned m)
+                {
+#if defined(__GNUC__) || defined(__clang__)
+                    return static_cast<unsigned>(__builtin_popcount(m));
+#else
+                    unsigned c = 0;
+                    for(; m; m &= m - 1)
+                        ++c;
+                    return c;
+#endif
+                }
+
+                // Lane-wise equality, as a byte mask of all-ones lanes.
+                template<typename T,
+                    std::size_t Size = sizeof(T), bool Float = std::is_floating_point<T>::value>
+                struct sse2_eq;
+
+                template<typename T>
+                struct sse2_eq<T, 1, false>
+                {
+                    static __m128i apply(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+                };
+                template<typename T>
+                struct sse2_eq<T, 2, false>
+                {
+                    static __m128i apply(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+                };
+                template<typename T>
+                struct sse2_eq<T, 4, false>
+                {
+                    static __m128i apply(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+                };
+                template<typename T>
+                struct sse2_eq<T, 8, false>
+                {
+                    // SSE2 has no 64-bit compare: both 32-bit halves must match.
+                    static __m128i apply(__m128i a, __m128i b)
+                    {
+                        __m128i const c = _mm_cmpeq_epi32(a, b);
+                        return _mm_and_si128(c, _mm_shuffle_epi32(c, 0xB1));
+                    }
+                };
+                template<typename T>
+                struct sse2_eq<T, 4, true>
+                {
+                    static __m128i apply(__m128i a, __m128i b)
+                    {
+                        return _mm_castps_si128(
+                            _mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+                    }
+                };
+                template<typename T>
+                struct sse2_eq<T, 8, true>
+                {
+                    static __m128i apply(__m128i a, __m128i b)
+                    {
+                        return _mm_castpd_si128(
+                            _mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+                    }
+                };
+
+                template<typename T>
+                __m128i sse2_splat(T val)
+                {
+                    T buf[16 / sizeof(T)];
+                    for(T &t : buf)
+                        t = val;
+                    return _mm_loadu_si128(reinterpret_cast<__m128i const *>(buf));
+                }
+
+                template<typename T>
+                std::size_t find_sse2(T const *p, std::size_t n, T val)
+                {
+                    constexpr std::size_t W = 16 / sizeof(T);
+                    __m128i const v = simd::sse2_splat(val);
+                    std::size_t i = 0;
+                    for(; i + W <= n; i += W)
+                    {
+                        __m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + i));
+                        unsigned const m =
+                            static_cast<unsigned>(_mm_movemask_epi8(sse2_eq<T>::apply(x, v)));
+                        if(m)
+                            return i + simd::ctz(m) / sizeof(T);
+                    }
+                    return i + simd::find_scalar(p + i, n - i, val);
+                }
+
+                template<typename T>
+                std::size_t count_sse2(T const *p, std::size_t n, T val)
+                {
+                    constexpr std::size_t W = 16 / sizeof(T);
+                    __m128i const v = simd::sse2_splat(val);
+                    std::size_t i = 0, c = 0;
+                    for(; i + W <= n; i += W)
+                    {
+                        __m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + i));
+                        c += simd::popcount(static_cast<unsigned>(
+                            _mm_movemask_epi8(sse2_eq<T>::apply(x, v))));
+                    }
+                    return c / sizeof(T) + simd::count_scalar(p + i, n - i, val);
+                }
+
+                template<typename T>
+                std::size_t mismatch_sse2(T const *p, T const *q, std::size_t n)
+                {
+                    constexpr std::size_t W = 16 / sizeof(T);
+                    std::size_t i = 0;
+                    for(; i + W <= n; i += W)
+                    {
+                        __m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + i));
+                        __m128i const y = _mm_loadu_si128(reinterpret_cast<__m128i const *>(q + i));
+                        unsigned const m =
+                            static_cast<unsigned>(_mm_movemask_epi8(sse2_eq<T>::apply(x, y)));
+                        if(m != 0xFFFFu)
+                            return i + simd::ctz(~m) / sizeof(T);
+                    }
+                    return i + simd::mismatch_scalar(p + i, q + i, n - i);
+                }
+
+                // Intersection a block at a time (after B. Schlegel, T. Willhalm
+                // and W. Lehner, "Fast Sorted-Set Intersection using SIMD
+                // Instructions", ADMS 2011): every element of a block of a is
+                // compared with every element of a block of b, and the block
+                // with the lesser last element is moved past. That is a merge,
+                // with the same output, as long as each pair of blocks with a
+                // match, and the element after each, increase strictly, which
+                // is checked when there is one; blocks with repeated elements
+                // are merged a step at a time instead. The blocks provide width();
+                // match(a, b), the mask of the elements of the block at a
+                // found in the block at b; and strict(p), whether p[0], ...,
+                // p[width()] increase strictly.
+                template<typename T, std::size_t Size = sizeof(T)>
+                struct sse2_block;
+
+                template<typename T>
+                struct sse2_block<T, 4>
+                {
+                    static constexpr std::size_t width()
+                    {
+                        return 4;
+                    }
+                    static unsigned match(T const *a, T const *b)
+                    {
+                        __m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(a));
+                        __m128i const y = _mm_loadu_si128(reinterpret_cast<__m128i const *>(b));
+                        __m128i m = _mm_cmpeq_epi32(x, y);
+                        m = _mm_or_si128(m, _mm_cmpeq_epi32(x, _mm_shuffle_epi32(y, 0x39)));
+                        m = _mm_or_si128(m, _mm_cmpeq_epi32(x, _mm_shuffle_epi32(y, 0x4E)));
+                        m = _mm_or_si128(m, _mm_cmpeq_epi32(x, _mm_shuffle_epi32(y, 0x93)));
+                        return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(m)));
+                    }
+                    static bool strict(T const *p)
+                    {
+                        __m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+                        __m128i const y =
+                            _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 1));
+                        return _mm_movemask_epi8(_mm_cmpeq_epi32(x, y)) == 0;
+                    }
+                };
+                template<typename T>
+                struct sse2_block<T, 8>
+                {
+                    static constexpr std::size_t width()
+                    {
+                        return 2;
+                    }
+                    static unsigned match(T const *a, T const *b)
+                    {
+                        __m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(a));
+                        __m128i const y = _mm_loadu_si128(reinterpret_cast<__m128i const *>(b));
+                        __m128i const m = _mm_or_si128(sse2_eq<T>::apply(x, y),
+                            sse2_eq<T>::apply(x, _mm_shuffle_epi32(y, 0x4E)));
+                        return static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(m)));
+                    }
+                    static bool strict(T const *p)
+                    {
+                        __m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p));
+                        __m128i const y =
+                            _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + 1));
+                        return _mm_movemask_epi8(sse2_eq<T>::apply(x, y)) == 0;
+                    }
+                };
+
+                template<typename T, typename F>
+                void intersect_sse2(T const *a, std::size_t na, T const *b, std::size_t nb,
+                    std::size_t &i, std::size_t &j, F &emit)
+                {
+                    using K = sse2_block<T>;
+                    constexpr std::size_t W = K::width();
+                    while(i + W < na && j + W < nb)
+                    {
+                        unsigned m = K::match(a + i, b + j);
+                        if(m != 0)
+                        {
+                            if(!K::strict(a + i) || !K::strict(b + j))
+                            {
+                                simd::merge_steps(a, na, b, nb, i, j, W, emit);
+                                continue;
+                            }
+                            for(; m != 0; m &= m - 1)
+                                emit(i + simd::ctz(m));
+                        }
+                        T const x = a[i + W - 1], y = b[j + W - 1];
+                        i += x <= y ? W : 0;
+                        j += y <= x ? W : 0;
+                    }
+                }
+
+                template<typename T>
+                void skip_unmatched_sse2(T const *a, std::size_t na, T const *b,
+                    std::size_t nb, std::size_t &i, std::size_t &j)
+                {
+                    using K = sse2_block<T>;
+                    constexpr std::size_t W = K::width();
+                    while(i + W < na && j + W < nb && K::match(a + i, b + j) == 0)
+                    {
+                        T const x = a[i + W - 1], y = b[j + W - 1];
+                        i += x <= y ? W : 0;
+                        j += y <= x ? W : 0;
+                    }
+                }
+#endif // RANGES_SIMD_SSE2
+
+#ifdef RANGES_SIMD_AVX2
+#define RANGES_AVX2_TARGET __attribute__((target("avx2")))
+
+                inline bool has_avx2()
+                {
+                    static bool const b = []{
+                        __builtin_cpu_init();
+                        return __builtin_cpu_supports("avx2") != 0;
+                    }();
+                    return b;
+                }
+
+                template<typename T,
+                    std::size_t Size = sizeof(T), bool Float = std::is_floating_point<T>::value>
+                struct avx2_eq;
+
+                template<typename T>
+                struct avx2_eq<T, 1, false>
+                {
+                    RANGES_AVX2_TARGET static __m256i apply(__m256i a, __m256i b)
+                    {
+                        return _mm256_cmpeq_epi8(a, b);
+                    }
+                };
+                template<typename T>
+                struct avx2_eq<T, 2, false>
+                {
+                    RANGES_AVX2_TARGET static __m256i apply(__m256i a, __m256i b)
+                    {
+                        return _mm256_cmpeq_epi16(a, b);
+                    }
+                };
+                template<typename T>
+                struct avx2_eq<T, 4, false>
+                {
+                    RANGES_AVX2_TARGET static __m256i apply(__m256i a, __m256i b)
+                    {
+                        return _mm256_cmpeq_epi32(a, b);
+                    }
+                };
+                template<typename T>
+                struct avx2_eq<T, 8, false>
+                {
+                    RANGES_AVX2_TARGET static __m256i apply(__m256i a, __m256i b)
+                    {
+                        return _mm256_cmpeq_epi64(a, b);
+                    }
+                };
+                template<typename T>
+                struct avx2_eq<T, 4, true>
+                {
+                    RANGES_AVX2_TARGET static __m256i apply(__m256i a, __m256i b)
+                    {
+                        return _mm256_castps_si256(_mm256_cmp_ps(
+                            _mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+                    }
+                };
+                template<typename T>
+                struct avx2_eq<T, 8, true>
+                {
+                    RANGES_AVX2_TARGET static __m256i apply(__m256i a, __m256i b)
+                    {
+                        return _mm256_castpd_si256(_mm256_cmp_pd(
+                            _mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+                    }
+                };
+
+                template<typename T>
+                RANGES_AVX2_TARGET __m256i avx2_splat(T val)
+                {
+                    T buf[32 / sizeof(T)];
+                    for(T &t : buf)
+                        t = val;
+                    return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(buf));
+                }
+
+                template<typename T>
+                RANGES_AVX2_TARGET std::size_t find_avx2(T const *p, std::size_t n, T val)
+                {
+                    constexpr std::size_t W = 32 / sizeof(T);
+                    __m256i const v = simd::avx2_splat(val);
+                    std::size_t i = 0;
+                    for(; i + W <= n; i += W)
+                    {
+                        __m256i const x =
+                            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + i));
+                        unsigned const m =
+                            static_cast<unsigned>(_mm256_movemask_epi8(avx2_eq<T>::apply(x, v)));
+                        if(m)
+                            return i + static_cast<std::size_t>(__builtin_ctz(m)) / sizeof(T);
+                    }
+                    return i + simd::find_scalar(p + i, n - i, val);
+                }
+
+                template<typename T>
+                RANGES_AVX2_TARGET std::size_t count_avx2(T const *p, std::size_t n, T val)
+                {
+                    constexpr std::size_t W = 32 / sizeof(T);
+                    __m256i const v = simd::avx2_splat(val);
+                    std::size_t i = 0, c = 0;
+                    for(; i + W <= n; i += W)
+                    {
+                        __m256i const x =
+                            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + i));
+                        c += static_cast<std::size_t>(__builtin_popcount(static_cast<unsigned>(
+                            _mm256_movemask_epi8(avx2_eq<T>::apply(x, v)))));
+                    }
+                    return c / sizeof(T) + simd::count_scalar(p + i, n - i, val);
+                }
+
+                template<typename T>
+                RANGES_AVX2_TARGET std::size_t mismatch_avx2(T const *p, T const *q, std::size_t n)
+                {
+                    constexpr std::size_t W = 32 / sizeof(T);
+                    std::size_t i = 0;
+                    for(; i + W <= n; i += W)
+                    {
+                        __m256i const x =
+                            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + i));
+                        __m256i const y =
+                            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(q + i));
+                        unsigned const m =
+                            static_cast<unsigned>(_mm256_movemask_epi8(avx2_eq<T>::apply(x, y)));
+                        if(m != 0xFFFFFFFFu)
+                            return i + static_cast<std::size_t>(__builtin_ctz(~m)) / sizeof(T);
+                    }
+                    return i + simd::mismatch_scalar(p + i, q + i, n - i);
+                }
+
+                template<typename T, std::size_t Size = sizeof(T)>
+                struct avx2_block;
+
+                // Each element meets every other in the same 128-bit lane,
+                // rotated, and in the other lane, swapped and rotated.
+                template<typename T>
+                struct avx2_block<T, 4>
+                {
+                    static constexpr std::size_t width()
+                    {
+                        return 8;
+                    }
+                    RANGES_AVX2_TARGET static unsigned match(T const *a, T const *b)
+                    {
+                        __m256i const x =
+                            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(a));
+                        __m256i const y =
+                            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(b));
+                        __m256i const z = _mm256_permute2x128_si256(y, y, 1);
+                        __m256i m = _mm256_cmpeq_epi32(x, y);
+                        m = _mm256_or_si256(m,
+                            _mm256_cmpeq_epi32(x, _mm256_shuffle_epi32(y, 0x39)));
+                        m = _mm256_or_si256(m,
+                            _mm256_cmpeq_epi32(x, _mm256_shuffle_epi32(y, 0x4E)));
+                        m = _mm256_or_si256(m,
+                            _mm256_cmpeq_epi32(x, _mm256_shuffle_epi32(y, 0x93)));
+                        m = _mm256_or_si256(m,
+                            _mm256_cmpeq_epi32(x, z));
+                        m = _mm256_or_si256(m,
+                            _mm256_cmpeq_epi32(x, _mm256_shuffle_epi32(z, 0x39)));
+                        m = _mm256_or_si256(m,
+                            _mm256_cmpeq_epi32(x, _mm256_shuffle_epi32(z, 0x4E)));
+                        m = _mm256_or_si256(m,
+                            _mm256_cmpeq_epi32(x, _mm256_shuffle_epi32(z, 0x93)));
+                        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(m)));
+                    }
+                    RANGES_AVX2_TARGET static bool strict(T const *p)
+                    {
+                        __m256i const x =
+                            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p));
+                        __m256i const y =
+                            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + 1));
+                        return _mm256_movemask_epi8(_mm256_cmpeq_epi32(x, y)) == 0;
+                    }
+                };
+                template<typename T>
+                struct avx2_block<T, 8>
+                {
+                    static constexpr std::size_t width()
+                    {
+                        return 4;
+                    }
+                    RANGES_AVX2_TARGET static unsigned match(T const *a, T const *b)
+                    {
+                        __m256i const x =
+                            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(a));
+                        __m256i const y =
+                            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(b));
+                        __m256i const z = _mm256_permute2x128_si256(y, y, 1);
+                        __m256i m = _mm256_cmpeq_epi64(x, y);
+                        m = _mm256_or_si256(m,
+                            _mm256_cmpeq_epi64(x, _mm256_shuffle_epi32(y, 0x4E)));
+                        m = _mm256_or_si256(m,
+                            _mm256_cmpeq_epi64(x, z));
+                        m = _mm256_or_si256(m,
+                            _mm256_cmpeq_epi64(x, _mm256_shuffle_epi32(z, 0x4E)));
+                        return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(m)));
+                    }
+                    RANGES_AVX2_TARGET static bool strict(T const *p)
+                    {
+                        __m256i const x =
+                            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p));
+                        __m256i const y =
+                            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + 1));
+                        return _mm256_movemask_epi8(_mm256_cmpeq_epi64(x, y)) == 0;
+                    }
+                };
+
+                template<typename T, typename F>
+                RANGES_AVX2_TARGET void intersect_avx2(T const *a, std::size_t na, T const *b,
+                    std::size_t nb, std::size_t &i, std::size_t &j, F &emit)
+                {
+                    using K = avx2_block<T>;
+                    constexpr std::size_t W = K::width();
+                    while(i + W < na && j + W < nb)
+                    {
+                        unsigned m = K::match(a + i, b + j);
+                        if(m != 0)
+                        {
+                            if(!K::strict(a + i) || !K::strict(b + j))
+                            {
+                                simd::merge_steps(a, na, b, nb, i, j, W, emit);
+                                continue;
+                            }
+                            for(; m != 0; m &= m - 1)
+                                emit(i + static_cast<std::size_t>(__builtin_ctz(m)));
+                        }
+                        T const x = a[i + W - 1], y = b[j + W - 1];
+                        i += x <= y ? W : 0;
+                        j += y <= x ? W : 0;
+                    }
+                }
+
+                template<typename T>
+                RANGES_AVX2_TARGET void skip_unmatched_avx2(T const *a, std::size_t na,
+                    T const *b, std::size_t nb, std::size_t &i, std::size_t &j)
+                {
+                    using K = avx2_block<T>;
+                    constexpr std::size_t W = K::width();
+                    while(i + W < na && j + W < nb && K::match(a + i, b + j) == 0)
+                    {
+                        T const x = a[i + W - 1], y = b[j + W - 1];
+                        i += x <= y ? W : 0;
+                        j += y <= x ? W : 0;
+                    }
+                }
+
+                RANGES_AVX2_TARGET inline std::size_t find_class_avx2(unsigned char const *p,
+                    std::size_t n, byte_class const &cls, bool member)
+                {
+                    __m256i const lo = _mm256_broadcastsi128_si256(
+                        _mm_loadu_si128(reinterpret_cast<__m128i const *>(cls.lo)));
+                    __m256i const hi = _mm256_broadcastsi128_si256(
+                        _mm_loadu_si128(reinterpret_cast<__m128i const *>(cls.hi)));
+                    __m256i const nibble = _mm256_set1_epi8(0x0F);
+                    __m256i const zero = _mm256_setzero_si256();
+                    // Bits of the mask are set for non-members; flip them to find
+                    // a member.
+                    unsigned const flip = member ? 0xFFFFFFFFu : 0u;
+                    std::size_t i = 0;
+                    for(; i + 32 <= n; i += 32)
+                    {
+                        __m256i const x = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + i));
+                        __m256i const l = _mm256_shuffle_epi8(lo, _mm256_and_si256(x, nibble));
+                        __m256i const h = _mm256_shuffle_epi8(hi,
+                            _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble));
+                        unsigned const m = flip ^ static_cast<unsigned>(_mm256_movemask_epi8(
+                            _mm256_cmpeq_epi8(_mm256_and_si256(l, h), zero)));
+                        if(m)
+                            return i + static_cast<std::size_t>(__builtin_ctz(m));
+                    }
+                    return i + simd::find_class_scalar(p + i, n - i, cls, member);
+                }
+
+#undef RANGES_AVX2_TARGET
+#endif // RANGES_SIMD_AVX2
+
+                /// Index of the first byte of [p, p + n) that is a member of
+                /// cls if member is true, or is not if it is false; or n.
+                inline std::size_t find_class(unsigned char const *p, std::size_t n,
+                    byte_class const &cls, bool member)
+                {
+#ifdef RANGES_SIMD_AVX2
+                    // Short runs are not worth setting up the vectors for.
+                    if(n >= 32 && cls.nibbles && simd::has_avx2())
+                        return simd::find_class_avx2(p, n, cls, member);
+#endif
+                    return simd::find_class_scalar(p, n, cls, member);
+                }
+
+                /// Index of the first element of [p, p + n) equal to val, or n.
+                template<typename T>
+                std::size_t find(T const *p, std::size_t n, T val)
+                {
+                    if(sizeof(T) == 1 && !std::is_floating_point<T>::value)
+                    {
+                        void const *r = std::memchr(p, static_cast<unsigned char>(val), n);
+                        return r ? static_cast<std::size_t>(static_cast<T const *>(r) - p) : n;
+                    }
+#ifdef RANGES_SIMD_AVX2
+                    if(simd::has_avx2())
+                        return simd::find_avx2(p, n, val);
+#endif
+#ifdef RANGES_SIMD_SSE2
+                    return simd::find_sse2(p, n, val);
+#else
+                    return simd::find_scalar(p, n, val);
+#endif
+                }
+
+                /// The number of elements of [p, p + n) equal to val.
+                template<typename T>
+                std::size_t count(T const *p, std::size_t n, T val)
+                {
+#ifdef RANGES_SIMD_AVX2
+                    if(simd::has_avx2())
+                        return simd::count_avx2(p, n, val);
+#endif
+#ifdef RANGES_SIMD_SSE2
+                    return simd::count_sse2(p, n, val);
+#else
+                    return simd::count_scalar(p, n, val);
+#endif
+                }
+
+                /// Index of the first position where p and q hold unequal
+                /// values, or n.
+                template<typename T>
+                std::size_t mismatch(T const *p, T const *q, std::size_t n)
+                {
+#ifdef RANGES_SIMD_AVX2
+                    if(simd::has_avx2())
+                        return simd::mismatch_avx2(p, q, n);
+#endif
+#ifdef RANGES_SIMD_SSE2
+                    return simd::mismatch_sse2(p, q, n);
+#else
+                    return simd::mismatch_scalar(p, q, n);
+#endif
+                }
+
+                /// Whether [p, p + n) and [q, q + n) hold equal values.
+                template<typename T>
+                bool equal(T const *p, T const *q, std::size_t n)
+                {
+                    // Integers have no padding bits and no values that compare
+                    // unequal to themselves, so bytewise equality is equality.
+                    return std::is_integral<T>::value
+                        ? n == 0 || std::memcmp(p, q, n * sizeof(T)) == 0
+                        : simd::mismatch(p, q, n) == n;
+                }
+
+                /// Whether [p, p + n) precedes [q, q + m) in lexicographical
+                /// order. T must be integral.
+                template<typename T>
+                bool lexicographical_less(T const *p, std::size_t n, T const *q, std::size_t m)
+                {
+                    static_assert(std::is_integral<T>::value, "");
+                    std::size_t const k = n < m ? n : m;
+                    if(sizeof(T) == 1 && std::is_unsigned<T>::value)
+                    {
+                        // memcmp compares as unsigned char.
+                        int const c = k ? std::memcmp(p, q, k) : 0;
+                        return c != 0 ? c < 0 : n < m;
+                    }
+                    std::size_t const i = simd::mismatch(p, q, k);
+                    return i != k ? p[i] < q[i] : n < m;
+                }
+
+                /// Continues a merge of [a, a + na) and [b, b + nb), T a 32- or
+                /// 64-bit integer, from a[i] and b[j], calling emit(k) for each
+                /// a[k] that is matched, as long as a block of each remains;
+                /// the caller merges the rest.
+                template<typename T, typename F>
+                void intersect(T const *a, std::size_t na, T const *b, std::size_t nb,
+                    std::size_t &i, std::size_t &j, F &emit)
+                {
+#ifdef RANGES_SIMD_AVX2
+                    if(simd::has_avx2())
+                        return simd::intersect_avx2(a, na, b, nb, i, j, emit);
+#endif
+#ifdef RANGES_SIMD_SSE2
+                    simd::intersect_sse2(a, na, b, nb, i, j, emit);
+#else
+                    (void)a, (void)na, (void)b, (void)nb, (void)i, (void)j, (void)emit;
+#endif
+                }
+
+                /// As intersect, but stops at the first block that may hold a
+                /// match, for the caller to merge up to it.
+                template<typename T>
+                void skip_unmatched(T const *a, std::size_t na, T const *b, std::size_t nb,
+                    std::size_t &i, std::size_t &j)
+                {
+#ifdef RANGES_SIMD_AVX2
+                    if(simd::has_avx2())
+                        return simd::skip_unmatched_avx2(a, na, b, nb, i, j);
+#endif
+#ifdef RANGES_SIMD_SSE2
+                    simd::skip_unmatched_sse2(a, na, b, nb, i, j);
+#else
+                    (void)a, (void)na, (void)b, (void)nb, (void)i, (void)j;
+#endif
+                }
+            }
+        }
+        /// \endcond
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
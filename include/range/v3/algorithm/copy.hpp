@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_COPY_HPP
 #define RANGES_V3_ALGORITHM_COPY_HPP
 
+#include <cstddef>
 #include <utility>
 #include <functional>
 #include <range/v3/range_fwd.hpp>
@@ -25,6 +26,9 @@
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/tagged_pair.hpp>
 #include <range/v3/algorithm/tagspec.hpp>
+#include <range/v3/algorithm/aux_/blocks.hpp>
+#include <range/v3/algorithm/aux_/memmove.hpp>
+#include <range/v3/algorithm/aux_/segments.hpp>
 
 namespace ranges
 {
@@ -34,6 +38,60 @@ namespace ranges
         /// @{
         struct copy_fn : aux::copy_fn
         {
+        private:
+            template<typename I, typename S, typename O>
+            static tagged_pair<tag::in(I), tag::out(O)> blocks(std::false_type, I begin, S end,
+                O out)
+            {
+                for(; begin != end; ++begin, ++out)
+                    *out = *begin;
+                return {begin, out};
+            }
+            // Views that hand out blocks are copied a block at a time, so that
+            // the work of the views is done in a loop over each block.
+            template<typename I, typename S, typename O>
+            static tagged_pair<tag::in(I), tag::out(O)> blocks(std::true_type, I begin, S end,
+                O out)
+            {
+                iterator_value_t<I> buf[detail::block_size()];
+                while(std::ptrdiff_t const n =
+                    detail::read_block(begin, end, buf, detail::block_size()))
+                {
+                    for(std::ptrdiff_t i = 0; i < n; ++i, ++out)
+                        *out = buf[i];
+                }
+                return {std::move(begin), std::move(out)};
+            }
+
+            template<typename I, typename S, typename O>
+            static tagged_pair<tag::in(I), tag::out(O)> impl(std::false_type, I begin, S end, O out)
+            {
+                return copy_fn::blocks(detail::block_loopable<I, S>{}, std::move(begin),
+                    std::move(end), std::move(out));
+            }
+            template<typename I, typename S, typename O>
+            static tagged_pair<tag::in(I), tag::out(O)> impl(std::true_type, I begin, S end, O out)
+            {
+                auto const n = end - begin;
+                return {begin + n, detail::memmove_n(begin, n, out)};
+            }
+            // Copies [first, last) to out, so that contiguous pieces of joined
+            // and concatenated ranges still reach memmove.
+            template<typename O>
+            struct copy_step
+            {
+                O &out;
+                template<typename J, typename T>
+                void operator()(J &first, T const &last) const
+                {
+                    auto res = copy_fn::impl(detail::memmove_copyable<J, T, O>{},
+                        std::move(first), last, std::move(out));
+                    first = std::move(res.in());
+                    out = std::move(res.out());
+                }
+            };
+
+        public:
             using aux::copy_fn::operator();
 
             template<typename I, typename S, typename O,
@@ -45,9 +103,9 @@ namespace ranges
             tagged_pair<tag::in(I), tag::out(O)>
             operator()(I begin, S end, O out) const
             {
-                for(; begin != end; ++begin, ++out)
-                    *out = *begin;
-                return {begin, out};
+                copy_step<O> step{out};
+                begin = detail::visit_segments(std::move(begin), end, step);
+                return {std::move(begin), std::move(out)};
             }
 
             template<typename Rng, typename O,
@@ -18,6 +18,7 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/algorithm/aux_/simd.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
@@ -31,11 +32,10 @@ namespace ranges
         /// @{
         struct count_fn
         {
-            template<typename I, typename S, typename V, typename P = ident,
-                CONCEPT_REQUIRES_(InputIterator<I>() && Sentinel<S, I>() &&
-                    IndirectRelation<equal_to, projected<I, P>, V const *>())>
-            iterator_difference_t<I>
-            operator()(I begin, S end, V const & val, P proj = P{}) const
+        private:
+            template<typename I, typename S, typename V, typename P>
+            static iterator_difference_t<I>
+            impl(std::false_type, I begin, S end, V const &val, P &proj)
             {
                 iterator_difference_t<I> n = 0;
                 for(; begin != end; ++begin)
@@ -43,6 +43,28 @@ namespace ranges
                         ++n;
                 return n;
             }
+            template<typename I, typename S, typename V, typename P>
+            static iterator_difference_t<I>
+            impl(std::true_type, I begin, S end, V const &val, P &)
+            {
+                auto const n = end - begin;
+                iterator_value_t<I> t;
+                if(n == 0 || !detail::scalar_cast(val, t))
+                    return 0;
+                return static_cast<iterator_difference_t<I>>(detail::simd::count(
+                    detail::scalar_pointer(begin), static_cast<std::size_t>(n), t));
+            }
+
+        public:
+            template<typename I, typename S, typename V, typename P = ident,
+                CONCEPT_REQUIRES_(InputIterator<I>() && Sentinel<S, I>() &&
+                    IndirectRelation<equal_to, projected<I, P>, V const *>())>
+            iterator_difference_t<I>
+            operator()(I begin, S end, V const & val, P proj = P{}) const
+            {
+                return count_fn::impl(detail::scalar_findable<I, S, V, P>{},
+                    std::move(begin), std::move(end), val, proj);
+            }
 
             template<typename Rng, typename V, typename P = ident,
                 typename I = range_iterator_t<Rng>,
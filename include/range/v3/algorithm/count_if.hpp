@@ -14,14 +14,19 @@
 #define RANGES_V3_ALGORITHM_COUNT_IF_HPP
 
 #include <utility>
+#include <vector>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/algorithm/aux_/segments.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/thread_pool.hpp>
 
 namespace ranges
 {
@@ -31,16 +36,61 @@ namespace ranges
         /// @{
         struct count_if_fn
         {
+        private:
+            static constexpr std::ptrdiff_t parallel_grain() { return 1024; }
+
+            template<typename I, typename S, typename R, typename P>
+            static iterator_difference_t<I> impl(std::false_type, I begin, S end, R &pred, P &proj)
+            {
+                return count_if_fn{}(detail::move(begin), detail::move(end), ref(pred), ref(proj));
+            }
+            template<typename I, typename S, typename R, typename P>
+            static iterator_difference_t<I> impl(std::true_type, I begin, S end, R &pred, P &proj)
+            {
+                using D = iterator_difference_t<I>;
+                D const n = ranges::next(begin, std::move(end)) - begin;
+                D const chunks = detail::parallel_chunk_count(n, D(count_if_fn::parallel_grain()));
+                std::vector<D> counts(static_cast<std::size_t>(chunks));
+                detail::parallel_for_chunks(n, chunks, [&](D k, D lo, D hi)
+                {
+                    counts[static_cast<std::size_t>(k)] =
+                        count_if_fn{}(begin + lo, begin + hi, ref(pred), ref(proj));
+                });
+                D total = 0;
+                for(D c : counts)
+                    total += c;
+                return total;
+            }
+
+            // Counts the matches in [first, last) into n.
+            template<typename D, typename R, typename P>
+            struct count_step
+            {
+                D &n;
+                R &pred;
+                P &proj;
+                template<typename J, typename T>
+                void operator()(J &first, T const &last) const
+                {
+                    D k = n;
+                    for(; first != last; ++first)
+                        if(invoke(pred, invoke(proj, *first)))
+                            ++k;
+                    n = k;
+                }
+            };
+
+        public:
             template<typename I, typename S, typename R, typename P = ident,
                 CONCEPT_REQUIRES_(InputIterator<I>() && Sentinel<S, I>() &&
                     IndirectPredicate<R, projected<I, P> >())>
             iterator_difference_t<I>
             operator()(I begin, S end, R pred, P proj = P{}) const
             {
-                iterator_difference_t<I> n = 0;
-                for(; begin != end; ++begin)
-                    if(invoke(pred, invoke(proj, *begin)))
-                        ++n;
+                using D = iterator_difference_t<I>;
+                D n = 0;
+                count_step<D, R, P> step{n, pred, proj};
+                detail::visit_segments(detail::move(begin), end, step);
                 return n;
             }
 
@@ -52,6 +102,31 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// \overload
+            /// Counts contiguous subranges concurrently when `E` is a parallel
+            /// policy and `I` is random-access.
+            template<typename E, typename I, typename S, typename R, typename P = ident,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && InputIterator<I>() &&
+                    Sentinel<S, I>() && IndirectPredicate<R, projected<I, P> >())>
+            iterator_difference_t<I>
+            operator()(E &&, I begin, S end, R pred, P proj = P{}) const
+            {
+                return count_if_fn::impl(detail::parallelizable<E, I>{}, std::move(begin),
+                    std::move(end), pred, proj);
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename R, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && InputRange<Rng>() &&
+                    IndirectPredicate<R, projected<I, P> >())>
+            iterator_difference_t<I>
+            operator()(E &&policy, Rng &&rng, R pred, P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng), std::move(pred),
+                    std::move(proj));
+            }
         };
 
         /// \sa `count_if_fn`
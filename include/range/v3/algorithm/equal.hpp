@@ -19,6 +19,7 @@
 #include <range/v3/distance.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/algorithm/aux_/simd.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -33,16 +34,54 @@ namespace ranges
         struct equal_fn
         {
         private:
+            // Contiguous scalar ranges compared with == can be compared a block
+            // at a time.
             template<typename I0, typename S0, typename I1, typename S1,
                 typename C, typename P0, typename P1>
-            bool nocheck(I0 begin0, S0 end0, I1 begin1, S1 end1, C pred,
-                P0 proj0, P1 proj1) const
+            using scalar_equal = meta::bool_<
+                detail::contiguous_scalar_ranges<I0, S0, P0, I1, S1, P1>::value &&
+                detail::is_equal_to<C, iterator_value_t<I0>>::value>;
+
+            template<typename I0, typename S0, typename I1,
+                typename C, typename P0, typename P1>
+            static bool impl(std::false_type, I0 begin0, S0 end0, I1 begin1, C &pred,
+                P0 &proj0, P1 &proj1)
+            {
+                for(; begin0 != end0; ++begin0, ++begin1)
+                    if(!invoke(pred, invoke(proj0, *begin0), invoke(proj1, *begin1)))
+                        return false;
+                return true;
+            }
+            template<typename I0, typename S0, typename I1,
+                typename C, typename P0, typename P1>
+            static bool impl(std::true_type, I0 begin0, S0 end0, I1 begin1, C &, P0 &, P1 &)
+            {
+                auto const n = end0 - begin0;
+                return n == 0 ||
+                    detail::simd::equal(detail::scalar_pointer(begin0),
+                        detail::scalar_pointer(begin1), static_cast<std::size_t>(n));
+            }
+
+            template<typename I0, typename S0, typename I1, typename S1,
+                typename C, typename P0, typename P1>
+            static bool nocheck(std::false_type, I0 begin0, S0 end0, I1 begin1, S1 end1, C &pred,
+                P0 &proj0, P1 &proj1)
             {
                 for(; begin0 != end0 && begin1 != end1; ++begin0, ++begin1)
                     if(!invoke(pred, invoke(proj0, *begin0), invoke(proj1, *begin1)))
                         return false;
                 return begin0 == end0 && begin1 == end1;
             }
+            template<typename I0, typename S0, typename I1, typename S1,
+                typename C, typename P0, typename P1>
+            static bool nocheck(std::true_type, I0 begin0, S0 end0, I1 begin1, S1 end1, C &,
+                P0 &, P1 &)
+            {
+                auto const n = end0 - begin0;
+                return n == end1 - begin1 && (n == 0 ||
+                    detail::simd::equal(detail::scalar_pointer(begin0),
+                        detail::scalar_pointer(begin1), static_cast<std::size_t>(n)));
+            }
 
         public:
             template<typename I0, typename S0, typename I1,
@@ -54,10 +93,8 @@ namespace ranges
             bool operator()(I0 begin0, S0 end0, I1 begin1, C pred = C{},
                 P0 proj0 = P0{}, P1 proj1 = P1{}) const
             {
-                for(; begin0 != end0; ++begin0, ++begin1)
-                    if(!invoke(pred, invoke(proj0, *begin0), invoke(proj1, *begin1)))
-                        return false;
-                return true;
+                return equal_fn::impl(scalar_equal<I0, S0, I1, I1, C, P0, P1>{},
+                    std::move(begin0), std::move(end0), std::move(begin1), pred, proj0, proj1);
             }
 
             template<typename I0, typename S0, typename I1, typename S1,
@@ -72,8 +109,9 @@ namespace ranges
                 if(SizedSentinel<S0, I0>() && SizedSentinel<S1, I1>())
                     if(distance(begin0, end0) != distance(begin1, end1))
                         return false;
-                return this->nocheck(std::move(begin0), std::move(end0), std::move(begin1),
-                    std::move(end1), std::move(pred), std::move(proj0), std::move(proj1));
+                return equal_fn::nocheck(scalar_equal<I0, S0, I1, S1, C, P0, P1>{},
+                    std::move(begin0), std::move(end0), std::move(begin1), std::move(end1),
+                    pred, proj0, proj1);
             }
 
             template<typename Rng0, typename I1Ref,
@@ -105,8 +143,10 @@ namespace ranges
                 if(SizedRange<Rng0>() && SizedRange<Rng1>())
                     if(distance(rng0) != distance(rng1))
                         return false;
-                return this->nocheck(begin(rng0), end(rng0), begin(rng1), end(rng1),
-                    std::move(pred), std::move(proj0), std::move(proj1));
+                return equal_fn::nocheck(
+                    scalar_equal<I0, range_sentinel_t<Rng0>, I1, range_sentinel_t<Rng1>,
+                        C, P0, P1>{},
+                    begin(rng0), end(rng0), begin(rng1), end(rng1), pred, proj0, proj1);
             }
         };
 
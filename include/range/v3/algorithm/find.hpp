@@ -18,6 +18,7 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/algorithm/aux_/simd.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -31,6 +32,27 @@ namespace ranges
         /// @{
         struct find_fn
         {
+        private:
+            template<typename I, typename S, typename V, typename P>
+            static I impl(std::false_type, I begin, S end, V const &val, P &proj)
+            {
+                for(; begin != end; ++begin)
+                    if(invoke(proj, *begin) == val)
+                        break;
+                return begin;
+            }
+            template<typename I, typename S, typename V, typename P>
+            static I impl(std::true_type, I begin, S end, V const &val, P &)
+            {
+                auto const n = end - begin;
+                iterator_value_t<I> t;
+                if(n == 0 || !detail::scalar_cast(val, t))
+                    return begin + n;
+                return begin + static_cast<iterator_difference_t<I>>(detail::simd::find(
+                    detail::scalar_pointer(begin), static_cast<std::size_t>(n), t));
+            }
+
+        public:
             /// \brief template function \c find_fn::operator()
             ///
             /// range-based version of the \c find std algorithm
@@ -45,10 +67,8 @@ namespace ranges
                     IndirectRelation<equal_to, projected<I, P>, V const *>())>
             I operator()(I begin, S end, V const &val, P proj = P{}) const
             {
-                for(; begin != end; ++begin)
-                    if(invoke(proj, *begin) == val)
-                        break;
-                return begin;
+                return find_fn::impl(detail::scalar_findable<I, S, V, P>{},
+                    std::move(begin), std::move(end), val, proj);
             }
 
             /// \overload
@@ -13,15 +13,20 @@
 #ifndef RANGES_V3_ALGORITHM_FIND_IF_HPP
 #define RANGES_V3_ALGORITHM_FIND_IF_HPP
 
+#include <atomic>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/algorithm/aux_/segments.hpp>
+#include <range/v3/utility/execution.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/thread_pool.hpp>
 
 namespace ranges
 {
@@ -31,6 +36,57 @@ namespace ranges
         /// @{
         struct find_if_fn
         {
+        private:
+            static constexpr std::ptrdiff_t parallel_grain() { return 1024; }
+
+            template<typename I, typename S, typename F, typename P>
+            static I impl(std::false_type, I begin, S end, F &pred, P &proj)
+            {
+                return find_if_fn{}(detail::move(begin), detail::move(end), ref(pred), ref(proj));
+            }
+            template<typename I, typename S, typename F, typename P>
+            static I impl(std::true_type, I begin, S end, F &pred, P &proj)
+            {
+                using D = iterator_difference_t<I>;
+                D const n = ranges::next(begin, std::move(end)) - begin;
+                // The position of the leftmost match found so far. Chunks stop
+                // scanning once they pass it, and skip it entirely if it precedes
+                // them.
+                std::atomic<D> found{n};
+                detail::parallel_for_chunks(n,
+                    detail::parallel_chunk_count(n, D(find_if_fn::parallel_grain())),
+                    [&](D, D lo, D hi)
+                    {
+                        for(D i = lo; i < hi && i < found.load(std::memory_order_relaxed); ++i)
+                        {
+                            if(invoke(pred, invoke(proj, *(begin + i))))
+                            {
+                                D cur = found.load(std::memory_order_relaxed);
+                                while(i < cur && !found.compare_exchange_weak(cur, i))
+                                    ;
+                                return;
+                            }
+                        }
+                    });
+                return begin + found.load();
+            }
+
+            // Advances first to the first match in [first, last).
+            template<typename F, typename P>
+            struct find_step
+            {
+                F &pred;
+                P &proj;
+                template<typename J, typename T>
+                void operator()(J &first, T const &last) const
+                {
+                    for(; first != last; ++first)
+                        if(invoke(pred, invoke(proj, *first)))
+                            break;
+                }
+            };
+
+        public:
             /// \brief template function \c find_fn::operator()
             ///
             /// range-based version of the \c find std algorithm
@@ -47,10 +103,8 @@ namespace ranges
                     IndirectPredicate<F, projected<I, P> >())>
             I operator()(I begin, S end, F pred, P proj = P{}) const
             {
-                for(; begin != end; ++begin)
-                    if(invoke(pred, invoke(proj, *begin)))
-                        break;
-                return begin;
+                find_step<F, P> step{pred, proj};
+                return detail::visit_segments(detail::move(begin), end, step);
             }
 
             /// \overload
@@ -62,6 +116,30 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// \overload
+            /// Searches contiguous subranges concurrently when `E` is a parallel
+            /// policy and `I` is random-access. Returns the first match, as the
+            /// sequential version does.
+            template<typename E, typename I, typename S, typename F, typename P = ident,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && InputIterator<I>() &&
+                    Sentinel<S, I>() && IndirectPredicate<F, projected<I, P> >())>
+            I operator()(E &&, I begin, S end, F pred, P proj = P{}) const
+            {
+                return find_if_fn::impl(detail::parallelizable<E, I>{}, std::move(begin),
+                    std::move(end), pred, proj);
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename F, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && InputRange<Rng>() &&
+                    IndirectPredicate<F, projected<I, P>>())>
+            range_safe_iterator_t<Rng> operator()(E &&policy, Rng &&rng, F pred, P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng), std::move(pred),
+                    std::move(proj));
+            }
         };
 
         /// \sa `find_if_fn`
@@ -19,10 +19,14 @@
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/algorithm/tagspec.hpp>
+#include <range/v3/algorithm/aux_/segments.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/tagged_pair.hpp>
+#include <range/v3/utility/thread_pool.hpp>
 
 namespace ranges
 {
@@ -32,16 +36,57 @@ namespace ranges
         /// @{
         struct for_each_fn
         {
+        private:
+            static constexpr std::ptrdiff_t parallel_grain() { return 1024; }
+
+            template<typename I, typename S, typename F, typename P>
+            static I impl(std::false_type, I begin, S end, F &fun, P &proj)
+            {
+                return for_each_fn{}(detail::move(begin), detail::move(end), ref(fun),
+                    ref(proj)).in();
+            }
+            template<typename I, typename S, typename F, typename P>
+            static I impl(std::true_type, I begin, S end_, F &fun, P &proj)
+            {
+                using D = iterator_difference_t<I>;
+                I end = ranges::next(begin, std::move(end_));
+                D const n = end - begin;
+                detail::parallel_for_chunks(n,
+                    detail::parallel_chunk_count(n, D(for_each_fn::parallel_grain())),
+                    [&](D, D lo, D hi)
+                    {
+                        F f = fun;
+                        for(I i = begin + lo, e = begin + hi; i != e; ++i)
+                            invoke(f, invoke(proj, *i));
+                    });
+                return end;
+            }
+
+            // Applies fun to each of [first, last).
+            template<typename F, typename P>
+            struct apply_step
+            {
+                F &fun;
+                P &proj;
+                template<typename J, typename T>
+                void operator()(J &first, T const &last) const
+                {
+                    for(; first != last; ++first)
+                    {
+                        invoke(fun, invoke(proj, *first));
+                    }
+                }
+            };
+
+        public:
             template<typename I, typename S, typename F, typename P = ident,
                 CONCEPT_REQUIRES_(InputIterator<I>() && Sentinel<S, I>() &&
                     IndirectInvocable<F, projected<I, P>>())>
             tagged_pair<tag::in(I), tag::fun(F)>
             operator()(I begin, S end, F fun, P proj = P{}) const
             {
-                for(; begin != end; ++begin)
-                {
-                    invoke(fun, invoke(proj, *begin));
-                }
+                apply_step<F, P> step{fun, proj};
+                begin = detail::visit_segments(detail::move(begin), end, step);
                 return {detail::move(begin), detail::move(fun)};
             }
 
@@ -54,6 +99,34 @@ namespace ranges
                 return {(*this)(begin(rng), end(rng), ref(fun), detail::move(proj)).in(),
                     detail::move(fun)};
             }
+
+            /// \overload
+            /// Each thread applies its own copy of `fun` to a contiguous subrange.
+            /// Falls back to the sequential algorithm unless `E` is a parallel
+            /// policy and `I` is random-access.
+            template<typename E, typename I, typename S, typename F, typename P = ident,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && InputIterator<I>() &&
+                    Sentinel<S, I>() && CopyConstructible<F>() &&
+                    IndirectInvocable<F, projected<I, P>>())>
+            tagged_pair<tag::in(I), tag::fun(F)>
+            operator()(E &&, I begin, S end, F fun, P proj = P{}) const
+            {
+                begin = for_each_fn::impl(detail::parallelizable<E, I>{}, detail::move(begin),
+                    detail::move(end), fun, proj);
+                return {detail::move(begin), detail::move(fun)};
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename F, typename P = ident,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && InputRange<Rng>() &&
+                    CopyConstructible<F>() &&
+                    IndirectInvocable<F, projected<range_iterator_t<Rng>, P>>())>
+            tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::fun(F)>
+            operator()(E &&policy, Rng &&rng, F fun, P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng),
+                    detail::move(fun), detail::move(proj));
+            }
         };
 
         /// \sa `for_each_fn`
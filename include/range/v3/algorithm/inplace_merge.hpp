@@ -55,6 +55,38 @@ namespace ranges
             struct merge_adaptive_fn
             {
             private:
+                // Merge the run [b, b_end) in the buffer with the run [i, end)
+                // into o, which trails i by the length of the buffered run. Once
+                // the buffer runs out, the rest of [i, end) is already in place;
+                // merge would move each of those elements onto itself, which
+                // leaves a std::string empty. Walking in reverse, ties go to
+                // the buffer.
+                template<typename B, typename I, typename O, typename C, typename P>
+                static void half_inplace_merge(B b, B b_end, I i, I end, O o, bool reverse,
+                    C &pred, P &proj)
+                {
+                    for(; b != b_end; ++o)
+                    {
+                        if(i == end)
+                        {
+                            ranges::move(b, b_end, o);
+                            return;
+                        }
+                        auto &&x = invoke(proj, *i);
+                        auto &&y = invoke(proj, *b);
+                        if(reverse ? invoke(pred, y, x) : invoke(pred, x, y))
+                        {
+                            *o = iter_move(i);
+                            ++i;
+                        }
+                        else
+                        {
+                            *o = iter_move(b);
+                            ++b;
+                        }
+                    }
+                }
+
                 template<typename I, typename C, typename P>
                 static void impl(I begin, I middle, I end, iterator_difference_t<I> len1,
                     iterator_difference_t<I> len2, iterator_value_t<I> *buf, C &pred, P &proj)
@@ -65,21 +97,18 @@ namespace ranges
                     if(len1 <= len2)
                     {
                         p = ranges::move(begin, middle, p).second;
-                        merge(make_move_iterator(buf), make_move_sentinel(p.base().base()),
-                            make_move_iterator(std::move(middle)),
-                            make_move_sentinel(std::move(end)), std::move(begin),
-                            std::ref(pred), std::ref(proj), std::ref(proj));
+                        merge_adaptive_fn::half_inplace_merge(buf, p.base().base(),
+                            std::move(middle), std::move(end), std::move(begin), false, pred,
+                            proj);
                     }
                     else
                     {
                         p = ranges::move(middle, end, p).second;
                         using RBi = std::reverse_iterator<I>;
                         using Rv = std::reverse_iterator<value_type*>;
-                        merge(make_move_iterator(RBi{std::move(middle)}),
-                            make_move_sentinel(RBi{std::move(begin)}),
-                            make_move_iterator(Rv{p.base().base()}),
-                            make_move_iterator(Rv{buf}), RBi{std::move(end)},
-                            not_fn(std::ref(pred)), std::ref(proj), std::ref(proj));
+                        merge_adaptive_fn::half_inplace_merge(Rv{p.base().base()}, Rv{buf},
+                            RBi{std::move(middle)}, RBi{std::move(begin)}, RBi{std::move(end)},
+                            true, pred, proj);
                     }
                 }
 
@@ -17,6 +17,7 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/algorithm/aux_/simd.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -30,12 +31,19 @@ namespace ranges
         /// @{
         struct lexicographical_compare_fn
         {
+        private:
+            // Integers ordered with < can be compared a block at a time.
             template<typename I0, typename S0, typename I1, typename S1,
-                typename C = ordered_less, typename P0 = ident, typename P1 = ident,
-                CONCEPT_REQUIRES_(Sentinel<S0, I0>() && Sentinel<S1, I1>() &&
-                    Comparable<I0, I1, C, P0, P1>())>
-            bool operator()(I0 begin0, S0 end0, I1 begin1, S1 end1, C pred = C{}, P0 proj0 = P0{},
-                P1 proj1 = P1{}) const
+                typename C, typename P0, typename P1>
+            using scalar_compare = meta::bool_<
+                detail::contiguous_scalar_ranges<I0, S0, P0, I1, S1, P1>::value &&
+                std::is_integral<iterator_value_t<I0>>::value &&
+                detail::is_less<C, iterator_value_t<I0>>::value>;
+
+            template<typename I0, typename S0, typename I1, typename S1,
+                typename C, typename P0, typename P1>
+            static bool impl(std::false_type, I0 begin0, S0 end0, I1 begin1, S1 end1, C &pred,
+                P0 &proj0, P1 &proj1)
             {
                 for(; begin1 != end1; ++begin0, ++begin1)
                 {
@@ -46,6 +54,32 @@ namespace ranges
                 }
                 return false;
             }
+            template<typename I0, typename S0, typename I1, typename S1,
+                typename C, typename P0, typename P1>
+            static bool impl(std::true_type, I0 begin0, S0 end0, I1 begin1, S1 end1, C &,
+                P0 &, P1 &)
+            {
+                auto const n0 = end0 - begin0;
+                auto const n1 = end1 - begin1;
+                if(n0 == 0 || n1 == 0)
+                    return n0 < n1;
+                return detail::simd::lexicographical_less(
+                    detail::scalar_pointer(begin0), static_cast<std::size_t>(n0),
+                    detail::scalar_pointer(begin1), static_cast<std::size_t>(n1));
+            }
+
+        public:
+            template<typename I0, typename S0, typename I1, typename S1,
+                typename C = ordered_less, typename P0 = ident, typename P1 = ident,
+                CONCEPT_REQUIRES_(Sentinel<S0, I0>() && Sentinel<S1, I1>() &&
+                    Comparable<I0, I1, C, P0, P1>())>
+            bool operator()(I0 begin0, S0 end0, I1 begin1, S1 end1, C pred = C{}, P0 proj0 = P0{},
+                P1 proj1 = P1{}) const
+            {
+                return lexicographical_compare_fn::impl(
+                    scalar_compare<I0, S0, I1, S1, C, P0, P1>{}, std::move(begin0),
+                    std::move(end0), std::move(begin1), std::move(end1), pred, proj0, proj1);
+            }
 
             template<typename Rng0, typename Rng1, typename C = ordered_less,
                 typename P0 = ident, typename P1 = ident,
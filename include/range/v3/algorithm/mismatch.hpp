@@ -19,6 +19,7 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/algorithm/aux_/simd.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -45,6 +46,59 @@ namespace ranges
         /// @{
         struct mismatch_fn
         {
+        private:
+            template<typename I1, typename S1, typename I2, typename S2,
+                typename C, typename P1, typename P2>
+            using scalar_mismatch = meta::bool_<
+                detail::contiguous_scalar_ranges<I1, S1, P1, I2, S2, P2>::value &&
+                detail::is_equal_to<C, iterator_value_t<I1>>::value>;
+
+            template<typename I1, typename S1, typename I2, typename C, typename P1, typename P2>
+            static tagged_pair<tag::in1(I1), tag::in2(I2)>
+            impl(std::false_type, I1 begin1, S1 end1, I2 begin2, C &pred, P1 &proj1, P2 &proj2)
+            {
+                for(; begin1 != end1; ++begin1, ++begin2)
+                    if(!invoke(pred, invoke(proj1, *begin1), invoke(proj2, *begin2)))
+                        break;
+                return {begin1, begin2};
+            }
+            template<typename I1, typename S1, typename I2, typename C, typename P1, typename P2>
+            static tagged_pair<tag::in1(I1), tag::in2(I2)>
+            impl(std::true_type, I1 begin1, S1 end1, I2 begin2, C &, P1 &, P2 &)
+            {
+                auto const n1 = end1 - begin1;
+                if(n1 == 0)
+                    return {begin1, begin2};
+                auto const n = static_cast<iterator_difference_t<I1>>(detail::simd::mismatch(
+                    detail::scalar_pointer(begin1), detail::scalar_pointer(begin2),
+                    static_cast<std::size_t>(n1)));
+                return {begin1 + n, begin2 + n};
+            }
+
+            template<typename I1, typename S1, typename I2, typename S2,
+                typename C, typename P1, typename P2>
+            static tagged_pair<tag::in1(I1), tag::in2(I2)>
+            impl(std::false_type, I1 begin1, S1 end1, I2 begin2, S2 end2, C &pred, P1 &proj1,
+                P2 &proj2)
+            {
+                for(; begin1 != end1 &&  begin2 != end2; ++begin1, ++begin2)
+                    if(!invoke(pred, invoke(proj1, *begin1), invoke(proj2, *begin2)))
+                        break;
+                return {begin1, begin2};
+            }
+            template<typename I1, typename S1, typename I2, typename S2,
+                typename C, typename P1, typename P2>
+            static tagged_pair<tag::in1(I1), tag::in2(I2)>
+            impl(std::true_type, I1 begin1, S1 end1, I2 begin2, S2 end2, C &pred, P1 &proj1,
+                P2 &proj2)
+            {
+                auto const n1 = end1 - begin1;
+                auto const n2 = static_cast<iterator_difference_t<I1>>(end2 - begin2);
+                return mismatch_fn::impl(std::true_type{}, begin1, begin1 + (n1 < n2 ? n1 : n2),
+                    begin2, pred, proj1, proj2);
+            }
+
+        public:
             template<typename I1, typename S1, typename I2, typename C = equal_to,
                 typename P1 = ident, typename P2 = ident,
                 CONCEPT_REQUIRES_(Mismatchable<I1, I2, C, P1, P2>() && Sentinel<S1, I1>())>
@@ -52,10 +106,8 @@ namespace ranges
             operator()(I1 begin1, S1 end1, I2 begin2, C pred = C{}, P1 proj1 = P1{},
                 P2 proj2 = P2{}) const
             {
-                for(; begin1 != end1; ++begin1, ++begin2)
-                    if(!invoke(pred, invoke(proj1, *begin1), invoke(proj2, *begin2)))
-                        break;
-                return {begin1, begin2};
+                return mismatch_fn::impl(scalar_mismatch<I1, S1, I2, I2, C, P1, P2>{},
+                    std::move(begin1), std::move(end1), std::move(begin2), pred, proj1, proj2);
             }
 
             template<typename I1, typename S1, typename I2, typename S2, typename C = equal_to,
@@ -66,10 +118,9 @@ namespace ranges
             operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, C pred = C{}, P1 proj1 = P1{},
                 P2 proj2 = P2{}) const
             {
-                for(; begin1 != end1 &&  begin2 != end2; ++begin1, ++begin2)
-                    if(!invoke(pred, invoke(proj1, *begin1), invoke(proj2, *begin2)))
-                        break;
-                return {begin1, begin2};
+                return mismatch_fn::impl(scalar_mismatch<I1, S1, I2, S2, C, P1, P2>{},
+                    std::move(begin1), std::move(end1), std::move(begin2), std::move(end2),
+                    pred, proj1, proj2);
             }
 
             template<typename Rng1, typename I2Ref, typename C = equal_to, typename P1 = ident,
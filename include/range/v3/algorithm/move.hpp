@@ -25,6 +25,7 @@
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/tagged_pair.hpp>
 #include <range/v3/algorithm/tagspec.hpp>
+#include <range/v3/algorithm/aux_/memmove.hpp>
 
 namespace ranges
 {
@@ -34,6 +35,22 @@ namespace ranges
         /// @{
         struct move_fn : aux::move_fn
         {
+        private:
+            template<typename I, typename S, typename O>
+            static tagged_pair<tag::in(I), tag::out(O)> impl(std::false_type, I begin, S end, O out)
+            {
+                for(; begin != end; ++begin, ++out)
+                    *out = iter_move(begin);
+                return {begin, out};
+            }
+            template<typename I, typename S, typename O>
+            static tagged_pair<tag::in(I), tag::out(O)> impl(std::true_type, I begin, S end, O out)
+            {
+                auto const n = end - begin;
+                return {begin + n, detail::memmove_n(begin, n, out)};
+            }
+
+        public:
             using aux::move_fn::operator();
 
             template<typename I, typename S, typename O,
@@ -41,9 +58,8 @@ namespace ranges
                     WeaklyIncrementable<O>() && IndirectlyMovable<I, O>())>
             tagged_pair<tag::in(I), tag::out(O)> operator()(I begin, S end, O out) const
             {
-                for(; begin != end; ++begin, ++out)
-                    *out = iter_move(begin);
-                return {begin, out};
+                return move_fn::impl(detail::memmove_movable<I, S, O>{}, std::move(begin),
+                    std::move(end), std::move(out));
             }
 
             template<typename Rng, typename O,
@@ -25,6 +25,7 @@
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/tagged_pair.hpp>
 #include <range/v3/algorithm/tagspec.hpp>
+#include <range/v3/algorithm/aux_/memmove.hpp>
 
 namespace ranges
 {
@@ -34,16 +35,31 @@ namespace ranges
         /// @{
         struct move_backward_fn
         {
-            template<typename I, typename S, typename O,
-                CONCEPT_REQUIRES_(BidirectionalIterator<I>() && Sentinel<S, I>() &&
-                    BidirectionalIterator<O>() && IndirectlyMovable<I, O>())>
-            tagged_pair<tag::in(I), tag::out(O)> operator()(I begin, S end_, O out) const
+        private:
+            template<typename I, typename S, typename O>
+            static tagged_pair<tag::in(I), tag::out(O)> impl(std::false_type, I begin, S end_, O out)
             {
                 I i = ranges::next(begin, end_), end = i;
                 while(begin != i)
                     *--out = iter_move(--i);
                 return {end, out};
             }
+            template<typename I, typename S, typename O>
+            static tagged_pair<tag::in(I), tag::out(O)> impl(std::true_type, I begin, S end, O out)
+            {
+                auto const n = end - begin;
+                return {begin + n, detail::memmove_backward_n(begin, n, out)};
+            }
+
+        public:
+            template<typename I, typename S, typename O,
+                CONCEPT_REQUIRES_(BidirectionalIterator<I>() && Sentinel<S, I>() &&
+                    BidirectionalIterator<O>() && IndirectlyMovable<I, O>())>
+            tagged_pair<tag::in(I), tag::out(O)> operator()(I begin, S end, O out) const
+            {
+                return move_backward_fn::impl(detail::memmove_movable<I, S, O>{},
+                    std::move(begin), std::move(end), std::move(out));
+            }
 
             template<typename Rng, typename O,
                 typename I = range_iterator_t<Rng>,
@@ -110,6 +110,17 @@ namespace ranges
                 return partition_fn::impl(begin(rng), end(rng), std::move(pred),
                     std::move(proj), iterator_concept<I>());
             }
+
+            /// \overload
+            /// The elements of a `soa_vector` are tested first, and its columns
+            /// then swap the ones out of place one column at a time.
+            template<typename...Ts, typename C, typename P = ident,
+                typename I = range_iterator_t<soa_vector<Ts...>>,
+                CONCEPT_REQUIRES_(Partitionable<I, C, P>())>
+            I operator()(soa_vector<Ts...> &rng, C pred, P proj = P{}) const
+            {
+                return rng.partition(std::move(pred), std::move(proj));
+            }
         };
 
         /// \sa `partition_fn`
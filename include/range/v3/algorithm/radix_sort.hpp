@@ -0,0 +1,497 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_RADIX_SORT_HPP
+#define RANGES_V3_ALGORITHM_RADIX_SORT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/execution.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/thread_pool.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // radix_key<K> says how radix_sort reads a key of type K. A key of
+            // fixed width has `width` byte digits, and `digit(k, i)` is its i-th
+            // digit counting from the least significant, so that comparing the
+            // digits from the most significant down orders keys as < does. A key
+            // of variable length has `byte(k, i)`, which is 0 past the end of k
+            // and one more than its i-th byte otherwise, and `less(a, b, i)`,
+            // which compares a and b from their i-th byte on.
+            template<typename K, typename = void>
+            struct radix_key
+            {};
+
+            // Integers, with the sign bit flipped so that negative values come
+            // first.
+            template<typename K>
+            struct radix_key<K, meta::if_c<std::is_integral<K>::value &&
+                !std::is_same<K, bool>::value>>
+            {
+                using bits_t = meta::_t<std::make_unsigned<K>>;
+                static constexpr std::size_t width = sizeof(K);
+                static bits_t bits(K k)
+                {
+                    return std::is_signed<K>::value ?
+                        static_cast<bits_t>(static_cast<bits_t>(k) ^
+                            static_cast<bits_t>(bits_t(1) << (width * 8 - 1))) :
+                        static_cast<bits_t>(k);
+                }
+                static std::size_t digit(K k, std::size_t i)
+                {
+                    return static_cast<unsigned char>(bits(k) >> (i * 8));
+                }
+            };
+
+            // IEEE floating-point numbers: negative values have all their bits
+            // flipped, and the others have the sign bit set. -0.0 comes before
+            // 0.0, and NaNs come first or last depending on their sign bit.
+            template<typename K>
+            struct radix_key<K, meta::if_c<std::is_floating_point<K>::value &&
+                std::numeric_limits<K>::is_iec559 && (sizeof(K) == 4 || sizeof(K) == 8)>>
+            {
+                using bits_t = meta::if_c<sizeof(K) == 4, std::uint32_t, std::uint64_t>;
+                static constexpr std::size_t width = sizeof(K);
+                static bits_t bits(K k)
+                {
+                    bits_t u;
+                    std::memcpy(&u, &k, sizeof(K));
+                    bits_t const sign = bits_t(1) << (width * 8 - 1);
+                    return (u & sign) ? ~u : (u | sign);
+                }
+                static std::size_t digit(K k, std::size_t i)
+                {
+                    return static_cast<unsigned char>(bits(k) >> (i * 8));
+                }
+            };
+
+            // Byte strings of fixed length, most significant byte first.
+            template<std::size_t N>
+            struct radix_key<std::array<unsigned char, N>>
+            {
+                static constexpr std::size_t width = N;
+                static std::size_t digit(std::array<unsigned char, N> const &k, std::size_t i)
+                {
+                    return k[N - 1 - i];
+                }
+            };
+
+            // Strings, compared byte by byte as unsigned char like
+            // std::char_traits<char>::compare.
+            template<typename A>
+            struct radix_key<std::basic_string<char, std::char_traits<char>, A>>
+            {
+                using string_t = std::basic_string<char, std::char_traits<char>, A>;
+                static constexpr bool variable = true;
+                static std::size_t byte(string_t const &k, std::size_t i)
+                {
+                    return i < k.size() ? 1u + static_cast<unsigned char>(k[i]) : 0u;
+                }
+                static bool less(string_t const &a, string_t const &b, std::size_t i)
+                {
+                    return a.compare(i, string_t::npos, b, i, string_t::npos) < 0;
+                }
+            };
+
+            template<typename K, typename = void>
+            struct radix_key_kind_
+              : meta::int_<0>
+            {};
+            template<typename K>
+            struct radix_key_kind_<K, meta::void_<decltype(radix_key<K>::width)>>
+              : meta::int_<1>
+            {};
+            template<typename K>
+            struct radix_key_kind_<K, meta::void_<decltype(radix_key<K>::variable)>>
+              : meta::int_<2>
+            {};
+
+            // 1 if the projected elements of I have a fixed-width radix key, 2 if
+            // their key has variable length, and 0 if radix_sort cannot sort them.
+            template<typename I, typename P>
+            using radix_key_kind = meta::_t<radix_key_kind_<iterator_value_t<projected<I, P>>>>;
+        }
+        /// \endcond
+
+        /// \addtogroup group-concepts
+        /// @{
+        template<typename I, typename P = ident>
+        using RadixSortable = meta::strict_and<
+            RandomAccessIterator<I>,
+            Permutable<I>,
+            meta::bool_<detail::radix_key_kind<I, P>::value != 0>>;
+        /// @}
+
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// Sorts a random-access range stably by the projection of its
+        /// elements, which must be integers, IEEE `float` or `double`,
+        /// `std::array<unsigned char, N>` or `std::string`. Keys of fixed width
+        /// take one counting pass per byte from the least significant up,
+        /// skipping bytes that are the same in every key. Strings are
+        /// distributed by their leading bytes, recursively, down to small
+        /// buckets that are insertion sorted. This allocates a buffer as large
+        /// as the range.
+        struct radix_sort_fn
+        {
+        private:
+            static constexpr std::size_t radix()
+            {
+                return 256;
+            }
+            static constexpr std::ptrdiff_t parallel_radix_threshold()
+            {
+                return 1 << 16;
+            }
+            static constexpr std::ptrdiff_t insertion_sort_threshold()
+            {
+                return 32;
+            }
+
+            template<typename I, typename P>
+            using key_t = detail::radix_key<iterator_value_t<projected<I, P>>>;
+
+            // Move [lo, hi) of src stably into dst by digit d of their keys,
+            // where next holds the position in dst of the next element with
+            // each digit.
+            template<typename Key, typename J, typename O, typename D, typename P>
+            static void scatter(J src, D lo, D hi, O dst, D *next, std::size_t d, P &proj)
+            {
+                for(D i = lo; i < hi; ++i)
+                {
+                    D &pos = next[Key::digit(invoke(proj, *(src + i)), d)];
+                    *(dst + pos++) = iter_move(src + i);
+                }
+            }
+
+            template<typename J, typename O, typename D>
+            static void move_n(J src, D n, O dst)
+            {
+                for(D i = 0; i < n; ++i)
+                    *(dst + i) = iter_move(src + i);
+            }
+
+            // Fixed-width keys, sequentially: count every digit of every key in
+            // one pass, then ping-pong between the range and a buffer with one
+            // counting sort per digit that is not the same in all keys.
+            template<typename I, typename D, typename P>
+            static void impl(meta::int_<1>, std::false_type, I begin, D n, P &proj)
+            {
+                using Key = key_t<I, P>;
+                std::size_t const R = radix_sort_fn::radix(), W = Key::width;
+                std::vector<D> counts(W * R);
+                for(D i = 0; i < n; ++i)
+                {
+                    auto &&k = invoke(proj, *(begin + i));
+                    for(std::size_t d = 0; d < W; ++d)
+                        ++counts[d * R + Key::digit(k, d)];
+                }
+                std::vector<std::size_t> passes;
+                for(std::size_t d = 0; d < W; ++d)
+                {
+                    D *c = counts.data() + d * R;
+                    if(std::find(c, c + R, n) != c + R)
+                        continue;
+                    passes.push_back(d);
+                    D pos = 0;
+                    for(D *b = c; b != c + R; ++b)
+                    {
+                        D const count = *b;
+                        *b = pos;
+                        pos += count;
+                    }
+                }
+                if(passes.empty())
+                    return;
+
+                std::vector<iterator_value_t<I>> buffer;
+                buffer.reserve(static_cast<std::size_t>(n));
+                for(D i = 0; i < n; ++i)
+                    buffer.push_back(iter_move(begin + i));
+                bool in_buffer = true;
+                for(std::size_t d : passes)
+                {
+                    D *next = counts.data() + d * R;
+                    if(in_buffer)
+                        radix_sort_fn::scatter<Key>(buffer.begin(), D(0), n, begin, next, d, proj);
+                    else
+                        radix_sort_fn::scatter<Key>(begin, D(0), n, buffer.begin(), next, d, proj);
+                    in_buffer = !in_buffer;
+                }
+                if(in_buffer)
+                    radix_sort_fn::move_n(buffer.begin(), n, begin);
+            }
+
+            // One counting sort pass on digit d with the work split into parts:
+            // each part counts the digits of its piece of src, and then moves its
+            // piece to dst at the positions that follow the same digits of the
+            // parts before it. Returns false, having moved nothing, if every key
+            // has the same digit.
+            template<typename Key, typename J, typename O, typename D, typename P>
+            static bool parallel_pass(J src, O dst, D n, D parts, std::vector<D> &table,
+                std::size_t d, P &proj)
+            {
+                std::size_t const R = radix_sort_fn::radix();
+                std::fill(table.begin(), table.end(), D(0));
+                detail::parallel_for_chunks(n, parts, [&](D p, D lo, D hi)
+                {
+                    D *counts = table.data() + static_cast<std::size_t>(p) * R;
+                    for(D i = lo; i < hi; ++i)
+                        ++counts[Key::digit(invoke(proj, *(src + i)), d)];
+                });
+                D pos = 0;
+                for(std::size_t b = 0; b < R; ++b)
+                {
+                    D const start = pos;
+                    for(D p = 0; p < parts; ++p)
+                    {
+                        D &off = table[static_cast<std::size_t>(p) * R + b];
+                        D const count = off;
+                        off = pos;
+                        pos += count;
+                    }
+                    if(pos - start == n)
+                        return false;
+                }
+                detail::parallel_for_chunks(n, parts, [&](D p, D lo, D hi)
+                {
+                    radix_sort_fn::scatter<Key>(src, lo, hi, dst,
+                        table.data() + static_cast<std::size_t>(p) * R, d, proj);
+                });
+                return true;
+            }
+
+            // Fixed-width keys, in parallel: every pass counts and scatters its
+            // digit with each thread handling a piece of the input.
+            template<typename I, typename D, typename P>
+            static void impl(meta::int_<1> kind, std::true_type, I begin, D n, P &proj)
+            {
+                using Key = key_t<I, P>;
+                D const parts =
+                    detail::parallel_chunk_count(n, D(radix_sort_fn::parallel_radix_threshold()));
+                if(parts < 2)
+                    return radix_sort_fn::impl(kind, std::false_type{}, begin, n, proj);
+                std::vector<iterator_value_t<I>> buffer;
+                buffer.reserve(static_cast<std::size_t>(n));
+                for(D i = 0; i < n; ++i)
+                    buffer.push_back(iter_move(begin + i));
+                std::vector<D> table(static_cast<std::size_t>(parts) * radix_sort_fn::radix());
+                bool in_buffer = true;
+                for(std::size_t d = 0; d < Key::width; ++d)
+                {
+                    if(in_buffer ?
+                        radix_sort_fn::parallel_pass<Key>(buffer.begin(), begin, n, parts,
+                            table, d, proj) :
+                        radix_sort_fn::parallel_pass<Key>(begin, buffer.begin(), n, parts,
+                            table, d, proj))
+                        in_buffer = !in_buffer;
+                }
+                if(in_buffer)
+                    detail::parallel_for_chunks(n, parts, [&](D, D lo, D hi)
+                    {
+                        radix_sort_fn::move_n(buffer.begin() + lo, hi - lo, begin + lo);
+                    });
+            }
+
+            // Stable insertion sort of n elements that agree on their first
+            // depth bytes.
+            template<typename Key, typename I, typename D, typename P>
+            static void insertion_sort(I begin, D n, std::size_t depth, P &proj)
+            {
+                for(D i = 1; i < n; ++i)
+                {
+                    iterator_value_t<I> tmp = iter_move(begin + i);
+                    D j = i;
+                    for(; j > 0 && Key::less(invoke(proj, tmp), invoke(proj, *(begin + (j - 1))),
+                        depth); --j)
+                        *(begin + j) = iter_move(begin + (j - 1));
+                    *(begin + j) = std::move(tmp);
+                }
+            }
+
+            // Distribute the n elements at begin, which agree on their first
+            // depth bytes, into buckets by their next byte through the scratch
+            // space, and set starts[b] to where bucket b begins. Returns false,
+            // having moved nothing, if every element falls in the same bucket.
+            template<typename Key, typename I, typename J, typename D, typename P>
+            static bool distribute(I begin, J scratch, D n, std::size_t depth, P &proj,
+                std::array<D, 258> &starts)
+            {
+                std::array<D, 257> counts{};
+                for(D i = 0; i < n; ++i)
+                    ++counts[Key::byte(invoke(proj, *(begin + i)), depth)];
+                D pos = 0;
+                for(std::size_t b = 0; b < counts.size(); ++b)
+                {
+                    starts[b] = pos;
+                    pos += counts[b];
+                }
+                starts.back() = n;
+                if(std::find(counts.begin(), counts.end(), n) != counts.end())
+                    return false;
+                std::array<D, 257> next;
+                std::copy(starts.begin(), starts.end() - 1, next.begin());
+                for(D i = 0; i < n; ++i)
+                {
+                    D &p = next[Key::byte(invoke(proj, *(begin + i)), depth)];
+                    *(scratch + p++) = iter_move(begin + i);
+                }
+                radix_sort_fn::move_n(scratch, n, begin);
+                return true;
+            }
+
+            // Sort the n elements at begin, which agree on their first depth
+            // bytes, with as many elements at scratch to move them through. The
+            // largest bucket is handled by the loop and the others recursively,
+            // so the recursion is at most log2(n) deep.
+            template<typename Key, typename I, typename J, typename D, typename P>
+            static void msd(I begin, J scratch, D n, std::size_t depth, P &proj)
+            {
+                std::array<D, 258> starts;
+                while(n > radix_sort_fn::insertion_sort_threshold())
+                {
+                    bool const moved =
+                        radix_sort_fn::distribute<Key>(begin, scratch, n, depth, proj, starts);
+                    if(!moved && starts[1] == n)
+                        return; // Every string ends here; they are all equal.
+                    std::size_t big = 1;
+                    for(std::size_t b = 2; b < 257; ++b)
+                        if(starts[b + 1] - starts[b] > starts[big + 1] - starts[big])
+                            big = b;
+                    if(moved)
+                        for(std::size_t b = 1; b < 257; ++b)
+                            if(b != big && starts[b + 1] - starts[b] > 1)
+                                radix_sort_fn::msd<Key>(begin + starts[b], scratch + starts[b],
+                                    starts[b + 1] - starts[b], depth + 1, proj);
+                    begin += starts[big];
+                    scratch += starts[big];
+                    n = starts[big + 1] - starts[big];
+                    ++depth;
+                }
+                radix_sort_fn::insertion_sort<Key>(begin, n, depth, proj);
+            }
+
+            template<typename I, typename D, typename P>
+            static void impl(meta::int_<2>, std::false_type, I begin, D n, P &proj)
+            {
+                using Key = key_t<I, P>;
+                if(n <= radix_sort_fn::insertion_sort_threshold())
+                    return radix_sort_fn::insertion_sort<Key>(begin, n, 0, proj);
+                std::vector<iterator_value_t<I>> scratch;
+                scratch.reserve(static_cast<std::size_t>(n));
+                for(D i = 0; i < n; ++i)
+                    scratch.push_back(iter_move(begin + i));
+                radix_sort_fn::move_n(scratch.begin(), n, begin);
+                radix_sort_fn::msd<Key>(begin, scratch.begin(), n, 0, proj);
+            }
+
+            // Strings, in parallel: distribute by the first byte, then sort the
+            // buckets concurrently.
+            template<typename I, typename D, typename P>
+            static void impl(meta::int_<2> kind, std::true_type, I begin, D n, P &proj)
+            {
+                using Key = key_t<I, P>;
+                if(n < radix_sort_fn::parallel_radix_threshold())
+                    return radix_sort_fn::impl(kind, std::false_type{}, begin, n, proj);
+                std::vector<iterator_value_t<I>> scratch;
+                scratch.reserve(static_cast<std::size_t>(n));
+                for(D i = 0; i < n; ++i)
+                    scratch.push_back(iter_move(begin + i));
+                radix_sort_fn::move_n(scratch.begin(), n, begin);
+                std::array<D, 258> starts;
+                radix_sort_fn::distribute<Key>(begin, scratch.begin(), n, 0, proj, starts);
+                detail::parallel_for_chunks(D(256), D(256), [&](D b, D, D)
+                {
+                    std::size_t const i = static_cast<std::size_t>(b) + 1;
+                    radix_sort_fn::msd<Key>(begin + starts[i], scratch.begin() + starts[i],
+                        starts[i + 1] - starts[i], 1, proj);
+                });
+            }
+
+        public:
+            template<typename I, typename S, typename P = ident,
+                CONCEPT_REQUIRES_(RadixSortable<I, P>() && Sentinel<S, I>())>
+            I operator()(I begin, S end_, P proj = P{}) const
+            {
+                I end = ranges::next(begin, std::move(end_));
+                radix_sort_fn::impl(detail::radix_key_kind<I, P>{}, std::false_type{}, begin,
+                    end - begin, proj);
+                return end;
+            }
+
+            template<typename Rng, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RadixSortable<I, P>() && RandomAccessRange<Rng>())>
+            range_safe_iterator_t<Rng> operator()(Rng &&rng, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(proj));
+            }
+
+            /// \overload
+            /// With a parallel policy, each counting pass over keys of fixed
+            /// width is split among the threads of the shared thread pool, and
+            /// strings are sorted concurrently once distributed by their first
+            /// byte.
+            template<typename E, typename I, typename S, typename P = ident,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && RadixSortable<I, P>() &&
+                    Sentinel<S, I>())>
+            I operator()(E &&, I begin, S end_, P proj = P{}) const
+            {
+                I end = ranges::next(begin, std::move(end_));
+                radix_sort_fn::impl(detail::radix_key_kind<I, P>{},
+                    detail::parallelizable<E, I>{}, begin, end - begin, proj);
+                return end;
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && RadixSortable<I, P>() &&
+                    RandomAccessRange<Rng>())>
+            range_safe_iterator_t<Rng> operator()(E &&policy, Rng &&rng, P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng), std::move(proj));
+            }
+        };
+
+        /// \sa `radix_sort_fn`
+        /// \ingroup group-algorithms
+        RANGES_INLINE_VARIABLE(with_braced_init_args<radix_sort_fn>, radix_sort)
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -14,12 +14,13 @@
 #ifndef RANGES_V3_ALGORITHM_SAMPLE_HPP
 #define RANGES_V3_ALGORITHM_SAMPLE_HPP
 
+#include <cstdint>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
-#include <range/v3/algorithm/min.hpp>
+#include <range/v3/algorithm/aux_/sample_skip.hpp>
 #include <range/v3/utility/random.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
@@ -49,17 +50,17 @@ namespace ranges
             sized_impl(I first, S last, iterator_difference_t<I> pop_size,
                 O out, iterator_difference_t<I> n, Gen && gen)
             {
-                std::uniform_int_distribution<iterator_difference_t<I>> dist;
-                using param_t = typename decltype(dist)::param_type;
-                n = ranges::min(pop_size, n);
-                for (; n > 0 && first != last; ++first)
+                // Jump from one element of the sample to the next: random
+                // numbers are drawn per element of the sample rather than of
+                // the population, and random-access iterators skip in O(1).
+                detail::sample_skipper<iterator_difference_t<I>> skip{pop_size, n};
+                while (skip.remaining() > 0)
                 {
-                    if (dist(gen, param_t{0, --pop_size}) < n)
-                    {
-                        --n;
-                        *out = *first;
-                        ++out;
-                    }
+                    ranges::advance(first, skip.next(gen));
+                    RANGES_EXPECT(first != last);
+                    *out = *first;
+                    ++out;
+                    ++first;
                 }
                 return {std::move(first), std::move(out)};
             }
@@ -97,13 +98,20 @@ namespace ranges
                     }
                     out[i] = *first;
                 }
-                std::uniform_int_distribution<iterator_difference_t<I>> dist;
-                using param_t = typename decltype(dist)::param_type;
-                for (auto pop_size = n; first != last; (void)++first, ++pop_size)
+                // The size of the input is unknown: a reservoir of the first n
+                // elements, in which later elements replace random ones.
                 {
-                    auto const i = dist(gen, param_t{0, pop_size});
-                    if (i < n)
-                        out[i] = *first;
+                    detail::reservoir_skipper<iterator_difference_t<I>> skip{n, gen};
+                    for (;;)
+                    {
+                        for (auto s = skip.next(gen); s > 0 && first != last; --s)
+                            ++first;
+                        if (first == last)
+                            break;
+                        out[static_cast<iterator_difference_t<I>>(detail::bounded_random(
+                            gen, static_cast<std::uint64_t>(n)))] = *first;
+                        ++first;
+                    }
                 }
                 out += n;
             done:
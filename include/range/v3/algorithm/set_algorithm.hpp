@@ -31,6 +31,8 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/aux_/gallop.hpp>
+#include <range/v3/algorithm/aux_/simd.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/tagged_pair.hpp>
 #include <range/v3/utility/tagged_tuple.hpp>
@@ -44,12 +46,11 @@ namespace ranges
         /// @{
         struct includes_fn
         {
+        private:
             template<typename I1, typename S1, typename I2, typename S2,
-                typename C = ordered_less, typename P1 = ident, typename P2 = ident,
-                CONCEPT_REQUIRES_(Comparable<I1, I2, C, P1, P2>() &&
-                    Sentinel<S1, I1>() && Sentinel<S2, I2>())>
-            bool operator()(I1 begin1, S1 end1, I2 begin2, S2 end2,
-                C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+                typename C, typename P1, typename P2>
+            static bool impl(I1 begin1, S1 end1, I2 begin2, S2 end2,
+                C &pred, P1 &proj1, P2 &proj2, std::false_type)
             {
                 for(; begin2 != end2; ++begin1)
                 {
@@ -60,6 +61,40 @@ namespace ranges
                 }
                 return true;
             }
+            // When the first range is much the larger, gallop through it to
+            // each element of the second: O(n2 log(n1 / n2)) comparisons.
+            template<typename I1, typename S1, typename I2, typename S2,
+                typename C, typename P1, typename P2>
+            static bool impl(I1 begin1, S1 end1, I2 begin2, S2 end2,
+                C &pred, P1 &proj1, P2 &proj2, std::true_type)
+            {
+                if(!detail::gallop_through(begin1, end1, begin2, end2))
+                    return includes_fn::impl(std::move(begin1), std::move(end1),
+                        std::move(begin2), std::move(end2), pred, proj1, proj2,
+                        std::false_type{});
+                for(; begin2 != end2; ++begin1, ++begin2)
+                {
+                    begin1 = detail::skip_less(std::move(begin1), end1, begin2, pred, proj1,
+                        proj2);
+                    if(begin1 == end1 ||
+                        invoke(pred, invoke(proj2, *begin2), invoke(proj1, *begin1)))
+                        return false;
+                }
+                return true;
+            }
+        public:
+            template<typename I1, typename S1, typename I2, typename S2,
+                typename C = ordered_less, typename P1 = ident, typename P2 = ident,
+                CONCEPT_REQUIRES_(Comparable<I1, I2, C, P1, P2>() &&
+                    Sentinel<S1, I1>() && Sentinel<S2, I2>())>
+            bool operator()(I1 begin1, S1 end1, I2 begin2, S2 end2,
+                C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return includes_fn::impl(std::move(begin1), std::move(end1),
+                    std::move(begin2), std::move(end2), pred, proj1, proj2,
+                    meta::bool_<detail::gallopable<I1, S1>() &&
+                        SizedSentinel<S2, I2>()>{});
+            }
 
             template<typename Rng1, typename Rng2, typename C = ordered_less,
                 typename P1 = ident, typename P2 = ident,
@@ -136,12 +171,11 @@ namespace ranges
 
         struct set_intersection_fn
         {
+        private:
             template<typename I1, typename S1, typename I2, typename S2, typename O,
-                typename C = ordered_less, typename P1 = ident, typename P2 = ident,
-                CONCEPT_REQUIRES_(Mergeable<I1, I2, O, C, P1, P2>() &&
-                    Sentinel<S1, I1>() && Sentinel<S2, I2>())>
-            O operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, O out,
-                C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+                typename C, typename P1, typename P2>
+            static O impl(I1 begin1, S1 end1, I2 begin2, S2 end2, O out,
+                C &pred, P1 &proj1, P2 &proj2, std::false_type)
             {
                 while(begin1 != end1 && begin2 != end2)
                 {
@@ -160,6 +194,94 @@ namespace ranges
                 }
                 return out;
             }
+            // When one range is much the larger, each in turn skips to the
+            // other's element, galloping: O(m log(n / m)) comparisons for
+            // ranges of m and n elements.
+            template<typename I1, typename S1, typename I2, typename S2, typename O,
+                typename C, typename P1, typename P2>
+            static O impl(I1 begin1, S1 end1, I2 begin2, S2 end2, O out,
+                C &pred, P1 &proj1, P2 &proj2, std::true_type)
+            {
+                if(!detail::gallop_through(begin1, end1, begin2, end2) &&
+                    !detail::gallop_through(begin2, end2, begin1, end1))
+                    return set_intersection_fn::merge(std::move(begin1), std::move(end1),
+                        std::move(begin2), std::move(end2), std::move(out), pred, proj1,
+                        proj2, detail::scalar_intersectable<I1, S1, P1, I2, S2, P2, C>{});
+                while(begin1 != end1 && begin2 != end2)
+                {
+                    begin1 = detail::skip_less(std::move(begin1), end1, begin2, pred, proj1,
+                        proj2);
+                    if(begin1 == end1)
+                        break;
+                    begin2 = detail::skip_less(std::move(begin2), end2, begin1, pred, proj2,
+                        proj1);
+                    if(begin2 == end2)
+                        break;
+                    if(!invoke(pred, invoke(proj1, *begin1), invoke(proj2, *begin2)))
+                    {
+                        *out = *begin1;
+                        ++out;
+                        ++begin1;
+                        ++begin2;
+                    }
+                }
+                return out;
+            }
+            template<typename I1, typename S1, typename I2, typename S2, typename O,
+                typename C, typename P1, typename P2>
+            static O merge(I1 begin1, S1 end1, I2 begin2, S2 end2, O out,
+                C &pred, P1 &proj1, P2 &proj2, std::false_type)
+            {
+                return set_intersection_fn::impl(std::move(begin1), std::move(end1),
+                    std::move(begin2), std::move(end2), std::move(out), pred, proj1, proj2,
+                    std::false_type{});
+            }
+            template<typename I, typename O>
+            struct output_match
+            {
+                I begin1;
+                O &out;
+                void operator()(std::size_t k)
+                {
+                    *out = *(begin1 + static_cast<iterator_difference_t<I>>(k));
+                    ++out;
+                }
+            };
+            // Contiguous 32- and 64-bit integers are merged a block at a time
+            // with SIMD compares.
+            template<typename I1, typename S1, typename I2, typename S2, typename O,
+                typename C, typename P1, typename P2>
+            static O merge(I1 begin1, S1 end1, I2 begin2, S2 end2, O out,
+                C &pred, P1 &proj1, P2 &proj2, std::true_type)
+            {
+                auto const n1 = end1 - begin1;
+                auto const n2 = end2 - begin2;
+                if(n1 != 0 && n2 != 0)
+                {
+                    std::size_t i = 0, j = 0;
+                    output_match<I1, O> match{begin1, out};
+                    detail::simd::intersect(detail::scalar_pointer(begin1),
+                        static_cast<std::size_t>(n1), detail::scalar_pointer(begin2),
+                        static_cast<std::size_t>(n2), i, j, match);
+                    begin1 += static_cast<iterator_difference_t<I1>>(i);
+                    begin2 += static_cast<iterator_difference_t<I2>>(j);
+                }
+                return set_intersection_fn::impl(std::move(begin1), std::move(end1),
+                    std::move(begin2), std::move(end2), std::move(out), pred, proj1, proj2,
+                    std::false_type{});
+            }
+        public:
+            template<typename I1, typename S1, typename I2, typename S2, typename O,
+                typename C = ordered_less, typename P1 = ident, typename P2 = ident,
+                CONCEPT_REQUIRES_(Mergeable<I1, I2, O, C, P1, P2>() &&
+                    Sentinel<S1, I1>() && Sentinel<S2, I2>())>
+            O operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, O out,
+                C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return set_intersection_fn::impl(std::move(begin1), std::move(end1),
+                    std::move(begin2), std::move(end2), std::move(out), pred, proj1, proj2,
+                    meta::bool_<detail::gallopable<I1, S1>() && detail::gallopable<I2, S2>()>{});
+            }
 
             template<typename Rng1, typename Rng2, typename O,
                 typename C = ordered_less, typename P1 = ident, typename P2 = ident,
@@ -182,12 +304,11 @@ namespace ranges
 
         struct set_difference_fn
         {
+        private:
             template<typename I1, typename S1, typename I2, typename S2, typename O,
-                typename C = ordered_less, typename P1 = ident, typename P2 = ident,
-                CONCEPT_REQUIRES_(Mergeable<I1, I2, O, C, P1, P2>() &&
-                    Sentinel<S1, I1>() && Sentinel<S2, I2>())>
-            tagged_pair<tag::in1(I1), tag::out(O)> operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, O out,
-                C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+                typename C, typename P1, typename P2>
+            static tagged_pair<tag::in1(I1), tag::out(O)> impl(I1 begin1, S1 end1,
+                I2 begin2, S2 end2, O out, C &pred, P1 &proj1, P2 &proj2, std::false_type)
             {
                 while(begin1 != end1)
                 {
@@ -208,6 +329,49 @@ namespace ranges
                 }
                 return {begin1, out};
             }
+            // As set_intersection, but the elements of the first range that
+            // are skipped are copied, a run at a time.
+            template<typename I1, typename S1, typename I2, typename S2, typename O,
+                typename C, typename P1, typename P2>
+            static tagged_pair<tag::in1(I1), tag::out(O)> impl(I1 begin1, S1 end1,
+                I2 begin2, S2 end2, O out, C &pred, P1 &proj1, P2 &proj2, std::true_type)
+            {
+                if(!detail::gallop_through(begin1, end1, begin2, end2) &&
+                    !detail::gallop_through(begin2, end2, begin1, end1))
+                    return set_difference_fn::impl(std::move(begin1), std::move(end1),
+                        std::move(begin2), std::move(end2), std::move(out), pred, proj1,
+                        proj2, std::false_type{});
+                while(begin1 != end1 && begin2 != end2)
+                {
+                    I1 run_end = detail::skip_less(begin1, end1, begin2, pred, proj1, proj2);
+                    out = copy(std::move(begin1), run_end, std::move(out)).out();
+                    begin1 = std::move(run_end);
+                    if(begin1 == end1)
+                        break;
+                    begin2 = detail::skip_less(std::move(begin2), end2, begin1, pred, proj2,
+                        proj1);
+                    if(begin2 == end2)
+                        break;
+                    if(!invoke(pred, invoke(proj1, *begin1), invoke(proj2, *begin2)))
+                    {
+                        ++begin1;
+                        ++begin2;
+                    }
+                }
+                return copy(std::move(begin1), std::move(end1), std::move(out));
+            }
+        public:
+            template<typename I1, typename S1, typename I2, typename S2, typename O,
+                typename C = ordered_less, typename P1 = ident, typename P2 = ident,
+                CONCEPT_REQUIRES_(Mergeable<I1, I2, O, C, P1, P2>() &&
+                    Sentinel<S1, I1>() && Sentinel<S2, I2>())>
+            tagged_pair<tag::in1(I1), tag::out(O)> operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, O out,
+                C pred = C{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return set_difference_fn::impl(std::move(begin1), std::move(end1),
+                    std::move(begin2), std::move(end2), std::move(out), pred, proj1, proj2,
+                    meta::bool_<detail::gallopable<I1, S1>() && detail::gallopable<I2, S2>()>{});
+            }
 
             template<typename Rng1, typename Rng2, typename O,
                 typename C = ordered_less, typename P1 = ident, typename P2 = ident,
@@ -13,26 +13,265 @@
 #ifndef RANGES_V3_ALGORITHM_SHUFFLE_HPP
 #define RANGES_V3_ALGORITHM_SHUFFLE_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
 #include <utility>
+#include <vector>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/random.hpp>
 #include <range/v3/utility/swap.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/memory.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/thread_pool.hpp>
 
 namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // Random words for an algorithm that knows about how many it needs,
+            // drawn from the engine in batches with fill_random.
+            template<typename Gen>
+            class buffered_random_words
+            {
+                static constexpr std::size_t capacity()
+                {
+                    return 64;
+                }
+                Gen &gen_;
+                std::uint64_t wanted_;
+                std::size_t pos_ = 0, size_ = 0;
+                std::array<std::uint64_t, capacity()> buf_;
+            public:
+                buffered_random_words(Gen &gen, std::uint64_t wanted)
+                  : gen_(gen), wanted_(wanted)
+                {}
+                std::uint64_t operator()()
+                {
+                    if(pos_ == size_)
+                    {
+                        // Draw no more than wanted, so that short shuffles
+                        // advance the engine no further than they must.
+                        size_ = wanted_ < capacity() ?
+                            (wanted_ == 0 ? 1u : static_cast<std::size_t>(wanted_)) :
+                            capacity();
+                        wanted_ -= wanted_ < size_ ? wanted_ : size_;
+                        fill_random(buf_.begin(), buf_.begin() + size_, gen_);
+                        pos_ = 0;
+                    }
+                    return buf_[pos_++];
+                }
+            };
+
+            // A seed sequence that draws its words from an engine, to seed one
+            // engine from another.
+            template<typename Gen>
+            struct engine_seed_seq
+            {
+                Gen &gen;
+                template<typename I>
+                void generate(I first, I last)
+                {
+                    for(; first != last; ++first)
+                        *first = detail::random_bits<std::uint32_t>(gen);
+                }
+            };
+
+            // Uniformly random labels of `bits` bits, several from each word.
+            class random_labels
+            {
+                xoshiro256starstar gen_;
+                std::uint64_t word_ = 0;
+                int bits_;
+                int left_ = 0;
+            public:
+                random_labels(xoshiro256starstar const &gen, int bits)
+                  : gen_(gen), bits_(bits)
+                {
+                    RANGES_EXPECT(0 < bits && bits < 64);
+                }
+                std::uint64_t operator()()
+                {
+                    if(left_ == 0)
+                    {
+                        word_ = gen_();
+                        left_ = 64 / bits_;
+                    }
+                    std::uint64_t const label = word_ & ((std::uint64_t{1} << bits_) - 1);
+                    word_ >>= bits_;
+                    --left_;
+                    return label;
+                }
+            };
+
+            // Raw storage for the elements of a range, which the pieces of a
+            // scatter move their elements into and out of concurrently. The
+            // elements of piece p live in [live[p].first, live[p].second).
+            template<typename V, typename D>
+            struct scatter_buffer
+            {
+                V *data;
+                std::vector<std::pair<D, D>> live;
+
+                scatter_buffer(V *d, D pieces)
+                  : data(d), live(static_cast<std::size_t>(pieces))
+                {}
+                scatter_buffer(scatter_buffer const &) = delete;
+                scatter_buffer &operator=(scatter_buffer const &) = delete;
+                ~scatter_buffer()
+                {
+                    for(auto const &r : live)
+                        for(D i = r.first; i < r.second; ++i)
+                            data[i].~V();
+                }
+            };
+        }
+        /// \endcond
+
         /// \addtogroup group-algorithms
         /// @{
         struct shuffle_fn
         {
+        private:
+            // The parallel shuffle aims for buckets of this many bytes, which
+            // shuffle in cache, and no more buckets than the scatter can
+            // write to at once without thrashing the TLB.
+            static constexpr std::size_t parallel_bucket_bytes() { return 1u << 18; }
+            static constexpr int parallel_max_bucket_bits() { return 12; }
+            static constexpr std::ptrdiff_t parallel_piece_size() { return 1 << 16; }
+            static constexpr std::ptrdiff_t parallel_max_pieces() { return 64; }
+
+            template<typename I, typename Gen>
+            static void impl(std::false_type, I begin, I end, Gen &gen)
+            {
+                shuffle_fn{}(begin, end, gen);
+            }
+
+            // A scatter shuffle (P. Sanders, "Random Permutations on Distributed,
+            // External and Hierarchical Memory", IPL 67(6), 1998): every element
+            // goes to a uniformly random bucket, and then every bucket is
+            // shuffled on its own. Labelling the pieces of the range, scattering
+            // them and shuffling the buckets run concurrently, each with its own
+            // stream of a xoshiro256** engine seeded from gen, jumped apart. The
+            // numbers of pieces and buckets depend only on the size of the
+            // range, so that the permutation does not depend on the number of
+            // threads. Each piece moves its elements into the buffer as it
+            // labels them. Without memory for the buffer, shuffles sequentially.
+            template<typename I, typename Gen>
+            static void impl(std::true_type, I begin, I end, Gen &gen)
+            {
+                using D = iterator_difference_t<I>;
+                using V = iterator_value_t<I>;
+                D const n = end - begin;
+                D const bucket_size = sizeof(V) < shuffle_fn::parallel_bucket_bytes() ?
+                    static_cast<D>(shuffle_fn::parallel_bucket_bytes() / sizeof(V)) : D(1);
+                int bits = 0;
+                while(bits < shuffle_fn::parallel_max_bucket_bits() &&
+                    (D(1) << bits) < n / bucket_size)
+                    ++bits;
+                if(bits == 0)
+                    return shuffle_fn{}(begin, end, gen), void();
+                D const buckets = D(1) << bits;
+                D const pieces = n / shuffle_fn::parallel_piece_size() < 1 ? D(1) :
+                    n / shuffle_fn::parallel_piece_size() < shuffle_fn::parallel_max_pieces() ?
+                        n / shuffle_fn::parallel_piece_size() :
+                        D(shuffle_fn::parallel_max_pieces());
+                auto const raw = std::get_temporary_buffer<V>(n);
+                std::unique_ptr<V, detail::return_temporary_buffer> const h{raw.first};
+                if(raw.first == nullptr || raw.second < n)
+                    return shuffle_fn{}(begin, end, gen), void();
+                detail::scatter_buffer<V, D> buffer{raw.first, pieces};
+                // Only moves that may throw need the live elements counted one
+                // at a time.
+                constexpr bool track = !(std::is_nothrow_move_constructible<V>::value &&
+                    std::is_nothrow_move_assignable<V>::value);
+
+                // A stream for each piece, and then one for each bucket.
+                detail::engine_seed_seq<Gen> seq{gen};
+                xoshiro256starstar engine{seq};
+                std::vector<xoshiro256starstar> streams;
+                streams.reserve(static_cast<std::size_t>(pieces + buckets));
+                for(D k = 0; k < pieces + buckets; ++k)
+                {
+                    streams.push_back(engine);
+                    engine.jump();
+                }
+
+                // Count the elements of each piece bound for each bucket, and
+                // turn the counts into the position in the range of each piece's
+                // share of each bucket. The labels are drawn again, from the same
+                // stream, to scatter.
+                std::vector<D> offsets(static_cast<std::size_t>(pieces * buckets));
+                detail::parallel_for_chunks(n, pieces, [&](D p, D lo, D hi)
+                {
+                    D *counts = offsets.data() + p * buckets;
+                    auto &live = buffer.live[static_cast<std::size_t>(p)];
+                    live = {lo, lo};
+                    detail::random_labels labels{streams[static_cast<std::size_t>(p)], bits};
+                    for(D i = lo; i < hi; ++i)
+                    {
+                        ::new(static_cast<void *>(buffer.data + i)) V(iter_move(begin + i));
+                        if(track)
+                            ++live.second;
+                        ++counts[labels()];
+                    }
+                    live.second = hi;
+                });
+                std::vector<D> starts(static_cast<std::size_t>(buckets + 1));
+                D pos = 0;
+                for(D b = 0; b < buckets; ++b)
+                {
+                    starts[static_cast<std::size_t>(b)] = pos;
+                    for(D p = 0; p < pieces; ++p)
+                    {
+                        D &off = offsets[static_cast<std::size_t>(p * buckets + b)];
+                        D const count = off;
+                        off = pos;
+                        pos += count;
+                    }
+                }
+                starts.back() = n;
+                detail::parallel_for_chunks(n, pieces, [&](D p, D lo, D hi)
+                {
+                    D *next = offsets.data() + p * buckets;
+                    auto &live = buffer.live[static_cast<std::size_t>(p)];
+                    detail::random_labels labels{streams[static_cast<std::size_t>(p)], bits};
+                    for(D i = lo; i < hi; ++i)
+                    {
+                        *(begin + next[labels()]++) = std::move(buffer.data[i]);
+                        buffer.data[i].~V();
+                        if(track)
+                            ++live.first;
+                    }
+                    live.first = hi;
+                });
+                detail::parallel_for_chunks(buckets, buckets, [&](D b, D, D)
+                {
+                    shuffle_fn{}(begin + starts[static_cast<std::size_t>(b)],
+                        begin + starts[static_cast<std::size_t>(b + 1)],
+                        streams[static_cast<std::size_t>(pieces + b)]);
+                });
+            }
+
+        public:
+            // Fisher-Yates, front to back: each element is swapped with a
+            // uniformly random one of those before it or itself. The random
+            // indices are drawn with Lemire's multiply-and-shift rather than
+            // std::uniform_int_distribution's divisions, two from each word
+            // while the product of their bounds fits in one.
             template<typename I, typename S, typename Gen = detail::default_random_engine&,
                 CONCEPT_REQUIRES_(RandomAccessIterator<I>() && Sentinel<S, I>() &&
                     Permutable<I>() && UniformRandomNumberGenerator<Gen>() &&
@@ -42,17 +281,30 @@ namespace ranges
             I operator()(I const begin, S const end,
                 Gen && gen = detail::get_random_engine()) const
             {
-                auto mid = begin;
-                if(mid == end)
-                    return mid;
-                std::uniform_int_distribution<iterator_difference_t<I>> uid{};
-                using param_t = typename decltype(uid)::param_type;
-                while(++mid != end)
+                auto const last = ranges::next(begin, end);
+                auto const n = static_cast<std::uint64_t>(last - begin);
+                if(n < 2)
+                    return last;
+                using D = iterator_difference_t<I>;
+                detail::buffered_random_words<meta::_t<std::remove_reference<Gen>>>
+                    words{gen, n / 2};
+                std::uint64_t i = 1;
+                // Bounds of up to 2^32, so that the products fit.
+                std::uint64_t const paired = n - 1 < (std::uint64_t{1} << 32) ?
+                    n - 1 : (std::uint64_t{1} << 32) - 1;
+                for(; i < paired; i += 2)
                 {
-                    if(auto const i = uid(gen, param_t{0, mid - begin}))
-                        ranges::iter_swap(mid - i, mid);
+                    std::uint64_t j0, j1;
+                    detail::bounded_random_words(words, i + 1, i + 2, j0, j1);
+                    ranges::iter_swap(begin + static_cast<D>(i), begin + static_cast<D>(j0));
+                    ranges::iter_swap(begin + static_cast<D>(i + 1), begin + static_cast<D>(j1));
                 }
-                return mid;
+                for(; i < n; ++i)
+                {
+                    auto const j = detail::bounded_random_words(words, i + 1);
+                    ranges::iter_swap(begin + static_cast<D>(i), begin + static_cast<D>(j));
+                }
+                return last;
             }
 
             template<typename Rng, typename Gen = detail::default_random_engine&,
@@ -66,6 +318,45 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::forward<Gen>(rand));
             }
+
+            /// \overload
+            /// With a parallel policy, the elements are scattered to random
+            /// buckets that are small enough to shuffle in cache, and the
+            /// buckets are shuffled concurrently on the shared thread pool. The
+            /// permutation is uniformly random, and depends only on the state of
+            /// `gen`, not on the number of threads; it differs from the one the
+            /// sequential shuffle makes from the same state. This allocates a
+            /// buffer as large as the range.
+            template<typename E, typename I, typename S,
+                typename Gen = detail::default_random_engine&,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && RandomAccessIterator<I>() &&
+                    Sentinel<S, I>() && Permutable<I>() &&
+                    UniformRandomNumberGenerator<Gen>() &&
+                    ConvertibleTo<
+                        concepts::UniformRandomNumberGenerator::result_t<Gen>,
+                        iterator_difference_t<I>>())>
+            I operator()(E &&, I const begin, S const end,
+                Gen && gen = detail::get_random_engine()) const
+            {
+                auto const last = ranges::next(begin, end);
+                shuffle_fn::impl(detail::parallelizable<E, I>{}, begin, last, gen);
+                return last;
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename Gen = detail::default_random_engine&,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && RandomAccessRange<Rng>() &&
+                    Permutable<I>() && UniformRandomNumberGenerator<Gen>() &&
+                    ConvertibleTo<
+                        concepts::UniformRandomNumberGenerator::result_t<Gen>,
+                        iterator_difference_t<I>>())>
+            range_safe_iterator_t<Rng>
+            operator()(E &&policy, Rng && rng, Gen && gen = detail::get_random_engine()) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng),
+                    std::forward<Gen>(gen));
+            }
         };
 
         /// \sa `shuffle_fn`
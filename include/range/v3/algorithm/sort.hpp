@@ -36,10 +36,15 @@
 #ifndef RANGES_V3_ALGORITHM_SORT_HPP
 #define RANGES_V3_ALGORITHM_SORT_HPP
 
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
@@ -47,7 +52,9 @@
 #include <range/v3/algorithm/move_backward.hpp>
 #include <range/v3/algorithm/partial_sort.hpp>
 #include <range/v3/algorithm/heap_algorithm.hpp>
+#include <range/v3/algorithm/aux_/simd.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/thread_pool.hpp>
 
 namespace ranges
 {
@@ -133,25 +140,29 @@ namespace ranges
         /// \addtogroup group-algorithms
         /// @{
 
-        // Introsort: Quicksort to a certain depth, then Heapsort. Insertion
-        // sort below a certain threshold.
+        // Pattern-defeating quicksort (pdqsort, Orson Peters): quicksort with
+        // ninther pivots that notices partitions that needed no swaps and
+        // finishes them with a bounded insertion sort, shuffles a few elements
+        // after a badly unbalanced partition, and falls back to heapsort after
+        // too many of those. Partitions a block at a time without branches
+        // when comparing arithmetic keys with <. Insertion sort below a
+        // certain threshold.
         // TODO Forward iterators, like EoP?
         struct sort_fn
         {
         private:
-            static constexpr int introsort_threshold() { return 16; }
+            static constexpr int insertion_sort_threshold() { return 24; }
+            static constexpr int ninther_threshold() { return 128; }
+            static constexpr int partial_insertion_sort_limit() { return 8; }
+            static constexpr int partition_block_size() { return 64; }
 
-            template<typename I, typename C, typename P>
-            static void final_insertion_sort(I begin, I end, C &pred, P &proj)
-            {
-                if(end - begin > sort_fn::introsort_threshold())
-                {
-                    detail::insertion_sort(begin, begin + sort_fn::introsort_threshold(), pred, proj);
-                    detail::unguarded_insertion_sort(begin + sort_fn::introsort_threshold(), end, pred, proj);
-                }
-                else
-                    detail::insertion_sort(begin, end, pred, proj);
-            }
+            // Comparisons that are cheap and have no side effects, so that the
+            // partition can evaluate them for a whole block without branching
+            // on each result.
+            template<typename I, typename C, typename P,
+                typename T = iterator_value_t<projected<I, P>>>
+            using branchless_partition = meta::bool_<
+                std::is_arithmetic<T>::value && detail::is_less<C, T>::value>;
 
             template<typename Size>
             static Size log2(Size n)
@@ -162,17 +173,510 @@ namespace ranges
                 return k;
             }
 
+            template<typename I, typename C, typename P>
+            static void sort2(I a, I b, C &pred, P &proj)
+            {
+                if(invoke(pred, invoke(proj, *b), invoke(proj, *a)))
+                    ranges::iter_swap(a, b);
+            }
+
+            template<typename I, typename C, typename P>
+            static void sort3(I a, I b, I c, C &pred, P &proj)
+            {
+                sort_fn::sort2(a, b, pred, proj);
+                sort_fn::sort2(b, c, pred, proj);
+                sort_fn::sort2(a, b, pred, proj);
+            }
+
+            // Insertion sort that gives up once it has moved more than a few
+            // elements, and returns whether it finished.
+            template<typename I, typename C, typename P>
+            static bool partial_insertion_sort(I begin, I end, C &pred, P &proj)
+            {
+                if(begin == end)
+                    return true;
+                iterator_difference_t<I> moved = 0;
+                for(I cur = begin + 1; cur != end; ++cur)
+                {
+                    I sift = cur, sift_1 = cur - 1;
+                    if(invoke(pred, invoke(proj, *sift), invoke(proj, *sift_1)))
+                    {
+                        iterator_value_t<I> tmp = iter_move(sift);
+                        do
+                        {
+                            *sift = iter_move(sift_1);
+                            --sift;
+                        } while(sift != begin &&
+                            invoke(pred, invoke(proj, tmp), invoke(proj, *--sift_1)));
+                        *sift = std::move(tmp);
+                        moved += cur - sift;
+                        if(moved > sort_fn::partial_insertion_sort_limit())
+                            return false;
+                    }
+                }
+                return true;
+            }
+
+            // Partition [begin, end) around the pivot *begin, with the elements
+            // equivalent to it on the right, and return the pivot's new position
+            // and whether the range was already partitioned.
+            template<typename I, typename C, typename P>
+            static std::pair<I, bool> partition_right(std::false_type, I begin, I end,
+                C &pred, P &proj)
+            {
+                iterator_value_t<I> pivot = iter_move(begin);
+                auto &&pv = invoke(proj, pivot);
+                I first = begin, last = end;
+                while(invoke(pred, invoke(proj, *++first), pv))
+                    ;
+                if(first - 1 == begin)
+                    while(first < last && !invoke(pred, invoke(proj, *--last), pv))
+                        ;
+                else
+                    while(!invoke(pred, invoke(proj, *--last), pv))
+                        ;
+                bool const already_partitioned = !(first < last);
+                while(first < last)
+                {
+                    ranges::iter_swap(first, last);
+                    while(invoke(pred, invoke(proj, *++first), pv))
+                        ;
+                    while(!invoke(pred, invoke(proj, *--last), pv))
+                        ;
+                }
+                I const pivot_pos = first - 1;
+                *begin = iter_move(pivot_pos);
+                *pivot_pos = std::move(pivot);
+                return {pivot_pos, already_partitioned};
+            }
+
+            // Swap num pairs of elements at the offsets from first and from
+            // last. Unless the blocks were the same size, rotating them through
+            // a temporary takes fewer moves than swapping pairs.
+            template<typename I>
+            static void swap_offsets(I first, I last, unsigned char const *offsets_l,
+                unsigned char const *offsets_r, int num, bool use_swaps)
+            {
+                if(use_swaps)
+                {
+                    for(int i = 0; i < num; ++i)
+                        ranges::iter_swap(first + offsets_l[i], last - offsets_r[i]);
+                }
+                else if(num > 0)
+                {
+                    I l = first + offsets_l[0], r = last - offsets_r[0];
+                    iterator_value_t<I> tmp = iter_move(l);
+                    *l = iter_move(r);
+                    for(int i = 1; i < num; ++i)
+                    {
+                        l = first + offsets_l[i];
+                        *r = iter_move(l);
+                        r = last - offsets_r[i];
+                        *l = iter_move(r);
+                    }
+                    *r = std::move(tmp);
+                }
+            }
+
+            // As above, but comparing a block of elements from each end at a
+            // time and recording the offsets of those on the wrong side, then
+            // swapping them in bulk (BlockQuicksort, Edelkamp and Weiss).
+            template<typename I, typename C, typename P>
+            static std::pair<I, bool> partition_right(std::true_type, I begin, I end,
+                C &pred, P &proj)
+            {
+                using D = iterator_difference_t<I>;
+                int const block = sort_fn::partition_block_size();
+                iterator_value_t<I> pivot = iter_move(begin);
+                auto &&pv = invoke(proj, pivot);
+                I first = begin, last = end;
+                while(invoke(pred, invoke(proj, *++first), pv))
+                    ;
+                if(first - 1 == begin)
+                    while(first < last && !invoke(pred, invoke(proj, *--last), pv))
+                        ;
+                else
+                    while(!invoke(pred, invoke(proj, *--last), pv))
+                        ;
+                bool const already_partitioned = !(first < last);
+                if(!already_partitioned)
+                {
+                    ranges::iter_swap(first, last);
+                    ++first;
+
+                    unsigned char offsets_l[sort_fn::partition_block_size()];
+                    unsigned char offsets_r[sort_fn::partition_block_size()];
+                    I offsets_l_base = first, offsets_r_base = last;
+                    int num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+                    while(first < last)
+                    {
+                        // Fill the offset blocks, splitting what is left between
+                        // them when both are empty.
+                        D const num_unknown = last - first;
+                        D const left_split =
+                            num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+                        D const right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+                        if(left_split >= block)
+                        {
+                            for(int i = 0; i < block; ++i, ++first)
+                            {
+                                offsets_l[num_l] = static_cast<unsigned char>(i);
+                                num_l += !invoke(pred, invoke(proj, *first), pv);
+                            }
+                        }
+                        else
+                        {
+                            for(D i = 0; i < left_split; ++i, ++first)
+                            {
+                                offsets_l[num_l] = static_cast<unsigned char>(i);
+                                num_l += !invoke(pred, invoke(proj, *first), pv);
+                            }
+                        }
+                        if(right_split >= block)
+                        {
+                            for(int i = 0; i < block;)
+                            {
+                                offsets_r[num_r] = static_cast<unsigned char>(++i);
+                                num_r += invoke(pred, invoke(proj, *--last), pv);
+                            }
+                        }
+                        else
+                        {
+                            for(D i = 0; i < right_split;)
+                            {
+                                offsets_r[num_r] = static_cast<unsigned char>(++i);
+                                num_r += invoke(pred, invoke(proj, *--last), pv);
+                            }
+                        }
+
+                        // Swap the misplaced elements, and start a new block on
+                        // each side that has run out.
+                        int const num = num_l < num_r ? num_l : num_r;
+                        sort_fn::swap_offsets(offsets_l_base, offsets_r_base,
+                            offsets_l + start_l, offsets_r + start_r, num, num_l == num_r);
+                        num_l -= num;
+                        num_r -= num;
+                        start_l += num;
+                        start_r += num;
+                        if(num_l == 0)
+                        {
+                            start_l = 0;
+                            offsets_l_base = first;
+                        }
+                        if(num_r == 0)
+                        {
+                            start_r = 0;
+                            offsets_r_base = last;
+                        }
+                    }
+
+                    // One side may still hold misplaced elements; move them to
+                    // the boundary.
+                    if(num_l)
+                    {
+                        while(num_l--)
+                            ranges::iter_swap(offsets_l_base + offsets_l[start_l + num_l], --last);
+                        first = last;
+                    }
+                    if(num_r)
+                    {
+                        while(num_r--)
+                        {
+                            ranges::iter_swap(offsets_r_base - offsets_r[start_r + num_r], first);
+                            ++first;
+                        }
+                        last = first;
+                    }
+                }
+                I const pivot_pos = first - 1;
+                *begin = iter_move(pivot_pos);
+                *pivot_pos = std::move(pivot);
+                return {pivot_pos, already_partitioned};
+            }
+
+            // Partition [begin, end) around the pivot *begin with the elements
+            // equivalent to it on the left, and return the position of the
+            // last of them. Used when the pivot is equivalent to the element
+            // before the range, so the whole left side can be skipped.
+            template<typename I, typename C, typename P>
+            static I partition_left(I begin, I end, C &pred, P &proj)
+            {
+                iterator_value_t<I> pivot = iter_move(begin);
+                auto &&pv = invoke(proj, pivot);
+                I first = begin, last = end;
+                while(invoke(pred, pv, invoke(proj, *--last)))
+                    ;
+                if(last + 1 == end)
+                    while(first < last && !invoke(pred, pv, invoke(proj, *++first)))
+                        ;
+                else
+                    while(!invoke(pred, pv, invoke(proj, *++first)))
+                        ;
+                while(first < last)
+                {
+                    ranges::iter_swap(first, last);
+                    while(invoke(pred, pv, invoke(proj, *--last)))
+                        ;
+                    while(!invoke(pred, pv, invoke(proj, *++first)))
+                        ;
+                }
+                I const pivot_pos = last;
+                *begin = iter_move(pivot_pos);
+                *pivot_pos = std::move(pivot);
+                return pivot_pos;
+            }
+
+            template<typename I, typename Size, typename C, typename P, typename Branchless>
+            static void pdqsort_loop(I begin, I end, Size bad_allowed, bool leftmost, C &pred,
+                P &proj, Branchless branchless)
+            {
+                using D = iterator_difference_t<I>;
+                while(true)
+                {
+                    D const size = end - begin;
+                    if(size < sort_fn::insertion_sort_threshold())
+                    {
+                        if(leftmost)
+                            detail::insertion_sort(begin, end, pred, proj);
+                        else
+                            detail::unguarded_insertion_sort(begin, end, pred, proj);
+                        return;
+                    }
+
+                    // Move the median of three, or of three medians of three for
+                    // large ranges, to the front as the pivot.
+                    D const s2 = size / 2;
+                    if(size > sort_fn::ninther_threshold())
+                    {
+                        sort_fn::sort3(begin, begin + s2, end - 1, pred, proj);
+                        sort_fn::sort3(begin + 1, begin + (s2 - 1), end - 2, pred, proj);
+                        sort_fn::sort3(begin + 2, begin + (s2 + 1), end - 3, pred, proj);
+                        sort_fn::sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), pred, proj);
+                        ranges::iter_swap(begin, begin + s2);
+                    }
+                    else
+                        sort_fn::sort3(begin + s2, begin, end - 1, pred, proj);
+
+                    // No element of the range is less than the one before it,
+                    // which was a pivot. If this pivot is equivalent to it, so is
+                    // everything the left partition would hold.
+                    if(!leftmost && !invoke(pred, invoke(proj, *(begin - 1)), invoke(proj, *begin)))
+                    {
+                        begin = sort_fn::partition_left(begin, end, pred, proj) + 1;
+                        continue;
+                    }
+
+                    std::pair<I, bool> const part =
+                        sort_fn::partition_right(branchless, begin, end, pred, proj);
+                    I const pivot_pos = part.first;
+                    D const l_size = pivot_pos - begin, r_size = end - (pivot_pos + 1);
+                    if(l_size < size / 8 || r_size < size / 8)
+                    {
+                        // A bad pivot: fall back to heapsort after too many, and
+                        // otherwise break up patterns that may have caused it.
+                        if(--bad_allowed == 0)
+                            return partial_sort(begin, end, end, std::ref(pred),
+                                std::ref(proj)), void();
+                        if(l_size >= sort_fn::insertion_sort_threshold())
+                        {
+                            ranges::iter_swap(begin, begin + l_size / 4);
+                            ranges::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+                            if(l_size > sort_fn::ninther_threshold())
+                            {
+                                ranges::iter_swap(begin + 1, begin + (l_size / 4 + 1));
+                                ranges::iter_swap(begin + 2, begin + (l_size / 4 + 2));
+                                ranges::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+                                ranges::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+                            }
+                        }
+                        if(r_size >= sort_fn::insertion_sort_threshold())
+                        {
+                            ranges::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                            ranges::iter_swap(end - 1, end - r_size / 4);
+                            if(r_size > sort_fn::ninther_threshold())
+                            {
+                                ranges::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+                                ranges::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+                                ranges::iter_swap(end - 2, end - (1 + r_size / 4));
+                                ranges::iter_swap(end - 3, end - (2 + r_size / 4));
+                            }
+                        }
+                    }
+                    // A partition that needed no swaps suggests the range is
+                    // nearly sorted; try to finish both sides cheaply.
+                    else if(part.second &&
+                        sort_fn::partial_insertion_sort(begin, pivot_pos, pred, proj) &&
+                        sort_fn::partial_insertion_sort(pivot_pos + 1, end, pred, proj))
+                        return;
+
+                    sort_fn::pdqsort_loop(begin, pivot_pos, bad_allowed, leftmost, pred, proj,
+                        branchless);
+                    begin = pivot_pos + 1;
+                    leftmost = false;
+                }
+            }
+
+            // Returns true, having sorted [begin, end), if it is one ascending
+            // or descending run. Stops at the first element out of order, so
+            // on other inputs this is cheap.
+            template<typename I, typename C, typename P>
+            static bool sort_run(I begin, I end, C &pred, P &proj)
+            {
+                I i = begin + 1;
+                if(!invoke(pred, invoke(proj, *i), invoke(proj, *begin)))
+                {
+                    for(++i; i != end; ++i)
+                        if(invoke(pred, invoke(proj, *i), invoke(proj, *(i - 1))))
+                            return false;
+                    return true;
+                }
+                for(++i; i != end; ++i)
+                    if(invoke(pred, invoke(proj, *(i - 1)), invoke(proj, *i)))
+                        return false;
+                for(--end; begin < end; ++begin, --end)
+                    ranges::iter_swap(begin, end);
+                return true;
+            }
+
+            static constexpr std::ptrdiff_t parallel_sort_threshold() { return 2048; }
+
+            // Partition serially, then sort the two sides concurrently. Small or
+            // badly-partitioned subranges are handed to the sequential sort,
+            // which supplies the heapsort fallback.
             template<typename I, typename Size, typename C, typename P>
-            static void introsort_loop(I begin, I end, Size depth_limit, C &pred, P &proj)
+            static void parallel_introsort(I begin, I end, Size depth_limit, C &pred, P &proj)
             {
-                while(end - begin > sort_fn::introsort_threshold())
+                if(end - begin <= sort_fn::parallel_sort_threshold() || depth_limit == 0)
+                    return sort_fn{}(begin, end, std::ref(pred), std::ref(proj)), void();
+                I cut = detail::unguarded_partition(begin, end, pred, proj);
+                --depth_limit;
+                detail::fork_join(
+                    [&]{ sort_fn::parallel_introsort(begin, cut, depth_limit, pred, proj); },
+                    [&]{ sort_fn::parallel_introsort(cut, end, depth_limit, pred, proj); });
+            }
+
+            static constexpr std::ptrdiff_t samplesort_oversampling() { return 16; }
+
+            // The bucket of x among the k sorted splitters at s: 2b holds the
+            // elements strictly between splitters b - 1 and b, and 2b + 1 those
+            // equal to splitter b.
+            template<typename T, typename J, typename D, typename C, typename P>
+            static D samplesort_bucket(T &&x, J s, D k, C &pred, P &proj)
+            {
+                auto &&px = invoke(proj, static_cast<T &&>(x));
+                D lo = 0, hi = k;
+                while(lo < hi)
                 {
-                    if(depth_limit == 0)
-                        return partial_sort(begin, end, end, std::ref(pred), std::ref(proj)), void();
-                    I cut = detail::unguarded_partition(begin, end, pred, proj);
-                    sort_fn::introsort_loop(cut, end, --depth_limit, pred, proj);
-                    end = cut;
+                    D const mid = lo + (hi - lo) / 2;
+                    if(invoke(pred, invoke(proj, s[mid]), px))
+                        lo = mid + 1;
+                    else
+                        hi = mid;
                 }
+                return 2 * lo + (lo < k && !invoke(pred, px, invoke(proj, s[lo])) ? 1 : 0);
+            }
+
+            // Pick splitters from a sorted sample, move the range into a buffer,
+            // then scatter it back bucket by bucket with each thread handling a
+            // piece of the buffer, and finally sort the buckets concurrently.
+            // Buckets of elements equal to a splitter need no sorting, which
+            // keeps inputs with few distinct values balanced. Without memory for
+            // the buffer, falls back to parallel_introsort.
+            template<typename I, typename C, typename P>
+            static void parallel_samplesort(I begin, I end, C &pred, P &proj)
+            {
+                using D = iterator_difference_t<I>;
+                using V = iterator_value_t<I>;
+                D const n = end - begin;
+                D const parts = detail::parallel_chunk_count(n, D(sort_fn::parallel_sort_threshold()));
+                if(parts < 2)
+                    return sort_fn{}(begin, end, std::ref(pred), std::ref(proj)), void();
+                std::vector<V> buffer;
+                try
+                {
+                    buffer.reserve(static_cast<std::size_t>(n));
+                }
+                catch(std::bad_alloc const &)
+                {
+                    return sort_fn::parallel_introsort(begin, end, sort_fn::log2(n) * 2, pred, proj);
+                }
+
+                // Gather an evenly spaced sample at the front and sort it. Every
+                // oversampling-th element of it is a splitter; set those aside and
+                // move the rest of the range into the buffer.
+                D const over = sort_fn::samplesort_oversampling();
+                D const k = parts - 1, m = parts * over, stride = n / m;
+                for(D t = 1; t < m; ++t)
+                    ranges::iter_swap(begin + t, begin + t * stride);
+                sort_fn{}(begin, begin + m, std::ref(pred), std::ref(proj));
+                for(D t = 0; t < k; ++t)
+                    ranges::iter_swap(begin + t, begin + (t + 1) * over);
+                std::vector<V> splitters;
+                splitters.reserve(static_cast<std::size_t>(k));
+                for(I i = begin; i != begin + k; ++i)
+                    splitters.push_back(iter_move(i));
+                for(I i = begin + k; i != end; ++i)
+                    buffer.push_back(iter_move(i));
+                auto const s = splitters.begin();
+                auto const src = buffer.begin();
+                D const rest = n - k;
+
+                // Count the elements of each piece of the buffer that fall in
+                // each bucket, turn the counts into the position in the range of
+                // each piece's share of each bucket, and scatter. The splitters
+                // come last, one to each bucket of equal elements.
+                D const buckets = 2 * k + 1;
+                std::vector<D> offsets(static_cast<std::size_t>((parts + 1) * buckets));
+                detail::parallel_for_chunks(rest, parts, [&](D p, D lo, D hi)
+                {
+                    D *counts = offsets.data() + p * buckets;
+                    for(D i = lo; i < hi; ++i)
+                        ++counts[sort_fn::samplesort_bucket(src[i], s, k, pred, proj)];
+                });
+                for(D t = 0; t < k; ++t)
+                    offsets[static_cast<std::size_t>(parts * buckets + 2 * t + 1)] = 1;
+                std::vector<D> starts(static_cast<std::size_t>(buckets + 1));
+                D pos = 0;
+                for(D b = 0; b < buckets; ++b)
+                {
+                    starts[static_cast<std::size_t>(b)] = pos;
+                    for(D p = 0; p <= parts; ++p)
+                    {
+                        D &off = offsets[static_cast<std::size_t>(p * buckets + b)];
+                        D const count = off;
+                        off = pos;
+                        pos += count;
+                    }
+                }
+                starts.back() = n;
+                detail::parallel_for_chunks(rest, parts, [&](D p, D lo, D hi)
+                {
+                    D *next = offsets.data() + p * buckets;
+                    for(D i = lo; i < hi; ++i)
+                        *(begin + next[sort_fn::samplesort_bucket(src[i], s, k, pred, proj)]++) =
+                            std::move(src[i]);
+                });
+                for(D t = 0; t < k; ++t)
+                    *(begin + offsets[static_cast<std::size_t>(parts * buckets + 2 * t + 1)]) =
+                        std::move(s[t]);
+
+                detail::parallel_for_chunks(k + 1, k + 1, [&](D b, D, D)
+                {
+                    sort_fn{}(begin + starts[static_cast<std::size_t>(2 * b)],
+                        begin + starts[static_cast<std::size_t>(2 * b + 1)], std::ref(pred),
+                        std::ref(proj));
+                });
+            }
+
+            template<typename I, typename C, typename P>
+            static void impl(std::false_type, I begin, I end, C &pred, P &proj)
+            {
+                sort_fn{}(begin, end, std::ref(pred), std::ref(proj));
+            }
+            template<typename I, typename C, typename P>
+            static void impl(std::true_type, I begin, I end, C &pred, P &proj)
+            {
+                sort_fn::parallel_samplesort(begin, end, pred, proj);
             }
 
         public:
@@ -182,11 +686,9 @@ namespace ranges
             I operator()(I begin, S end_, C pred = C{}, P proj = P{}) const
             {
                 I end = ranges::next(begin, std::move(end_));
-                if (begin != end)
-                {
-                    sort_fn::introsort_loop(begin, end, sort_fn::log2(end - begin) * 2, pred, proj);
-                    sort_fn::final_insertion_sort(begin, end, pred, proj);
-                }
+                if(end - begin > 1 && !sort_fn::sort_run(begin, end, pred, proj))
+                    sort_fn::pdqsort_loop(begin, end, sort_fn::log2(end - begin), true, pred,
+                        proj, branchless_partition<I, C, P>{});
                 return end;
             }
 
@@ -197,6 +699,45 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// \overload
+            /// A `soa_vector` is sorted by its keys alone, and its columns are
+            /// then moved into place one at a time.
+            template<typename...Ts, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<soa_vector<Ts...>>,
+                CONCEPT_REQUIRES_(Sortable<I, C, P>())>
+            I operator()(soa_vector<Ts...> &rng, C pred = C{}, P proj = P{}) const
+            {
+                return rng.sort(std::move(pred), std::move(proj));
+            }
+
+            /// \overload
+            /// With a parallel policy, the range is distributed into buckets by a
+            /// sample of its elements, and the buckets are sorted concurrently on
+            /// the shared thread pool. This allocates a buffer as large as the
+            /// range.
+            template<typename E, typename I, typename S, typename C = ordered_less,
+                typename P = ident,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && Sortable<I, C, P>() &&
+                    RandomAccessIterator<I>() && Sentinel<S, I>())>
+            I operator()(E &&, I begin, S end_, C pred = C{}, P proj = P{}) const
+            {
+                I end = ranges::next(begin, std::move(end_));
+                sort_fn::impl(detail::parallelizable<E, I>{}, begin, end, pred, proj);
+                return end;
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && Sortable<I, C, P>() &&
+                    RandomAccessRange<Rng>())>
+            range_safe_iterator_t<Rng> operator()(E &&policy, Rng &&rng, C pred = C{},
+                P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng), std::move(pred),
+                    std::move(proj));
+            }
         };
 
         /// \sa `sort_fn`
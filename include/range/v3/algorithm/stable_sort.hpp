@@ -37,12 +37,15 @@
 #define RANGES_V3_ALGORITHM_STABLE_SORT_HPP
 
 #include <memory>
+#include <new>
 #include <iterator>
 #include <functional>
+#include <vector>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/memory.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
@@ -51,9 +54,12 @@
 #include <range/v3/utility/counted_iterator.hpp>
 #include <range/v3/algorithm/merge.hpp>
 #include <range/v3/algorithm/min.hpp>
+#include <range/v3/algorithm/move.hpp>
 #include <range/v3/algorithm/sort.hpp>
 #include <range/v3/algorithm/inplace_merge.hpp>
+#include <range/v3/algorithm/aux_/merge_n.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/thread_pool.hpp>
 
 namespace ranges
 {
@@ -153,6 +159,157 @@ namespace ranges
                     buffer, buffer_size, std::ref(pred), std::ref(proj));
             }
 
+            static constexpr std::ptrdiff_t parallel_grain() { return 4096; }
+
+            // How many of the first d elements of the stable merge of [a, a + na)
+            // and [b, b + nb) come from the first range. This is where diagonal d
+            // crosses the merge path.
+            template<typename I0, typename I1, typename D, typename C, typename P>
+            static D merge_path(I0 a, D na, I1 b, D nb, D d, C &pred, P &proj)
+            {
+                D lo = d > nb ? d - nb : D(0), hi = d < na ? d : na;
+                while(lo < hi)
+                {
+                    D const i = lo + (hi - lo) / 2;
+                    if(invoke(pred, invoke(proj, b[d - i - 1]), invoke(proj, a[i])))
+                        hi = i;
+                    else
+                        lo = i + 1;
+                }
+                return lo;
+            }
+
+            // Merge neighbouring runs of src, delimited by the offsets in bounds,
+            // pairwise into the same positions of dst, and drop the bounds that
+            // no longer separate runs. Each merge is cut at merge-path boundaries
+            // into pieces of at most `piece` elements, which are merged
+            // concurrently, so every level keeps the whole pool busy.
+            template<typename I0, typename I1, typename D, typename C, typename P>
+            static void parallel_merge_runs(I0 src, I1 dst, std::vector<D> &bounds, D piece,
+                C &pred, P &proj)
+            {
+                // A piece of the merge of [lo, mid) and [mid, hi): output
+                // elements [d0, d1) of it, of which those in [i0, i1) come from
+                // the first run.
+                struct task { D lo, mid, hi, d0, d1, i0, i1; };
+                std::vector<task> tasks;
+                std::size_t const runs = bounds.size() - 1;
+                for(std::size_t r = 0; r < runs; r += 2)
+                {
+                    D const lo = bounds[r], mid = bounds[r + 1];
+                    D const hi = r + 2 <= runs ? bounds[r + 2] : mid;
+                    for(D d = 0; d < hi - lo; d += piece)
+                        tasks.push_back(task{lo, mid, hi, d, ranges::min(D(d + piece), D(hi - lo)),
+                            0, 0});
+                }
+                // Find all the cuts before moving anything, since a search may
+                // look at elements another piece moves.
+                D const ntasks = static_cast<D>(tasks.size());
+                detail::parallel_for_chunks(ntasks, ntasks, [&](D k, D, D)
+                {
+                    task &t = tasks[static_cast<std::size_t>(k)];
+                    D const na = t.mid - t.lo, nb = t.hi - t.mid;
+                    t.i0 = stable_sort_fn::merge_path(src + t.lo, na, src + t.mid, nb, t.d0,
+                        pred, proj);
+                    t.i1 = stable_sort_fn::merge_path(src + t.lo, na, src + t.mid, nb, t.d1,
+                        pred, proj);
+                });
+                detail::parallel_for_chunks(ntasks, ntasks, [&](D k, D, D)
+                {
+                    task const &t = tasks[static_cast<std::size_t>(k)];
+                    aux::merge_n(make_move_iterator(src + (t.lo + t.i0)), t.i1 - t.i0,
+                        make_move_iterator(src + (t.mid + t.d0 - t.i0)),
+                        (t.d1 - t.i1) - (t.d0 - t.i0), dst + (t.lo + t.d0), std::ref(pred),
+                        std::ref(proj), std::ref(proj));
+                });
+                std::vector<D> merged;
+                for(std::size_t r = 0; r < runs; r += 2)
+                    merged.push_back(bounds[r]);
+                merged.push_back(bounds.back());
+                bounds.swap(merged);
+            }
+
+            template<typename I, typename C, typename P>
+            static void impl(std::false_type, I begin, I end, C &pred, P &proj)
+            {
+                stable_sort_fn{}(begin, end, std::ref(pred), std::ref(proj));
+            }
+            // Sort contiguous pieces concurrently, then merge neighbouring runs
+            // pairwise in place, one level at a time, until a single run remains.
+            template<typename I, typename D, typename C, typename P>
+            static void parallel_sort_in_place(I begin, I end, D chunks, C &pred, P &proj)
+            {
+                D const n = end - begin;
+                std::vector<I> bounds(static_cast<std::size_t>(chunks + 1), begin);
+                detail::parallel_for_chunks(n, chunks, [&](D k, D lo, D hi)
+                {
+                    bounds[static_cast<std::size_t>(k)] = begin + lo;
+                    stable_sort_fn{}(begin + lo, begin + hi, std::ref(pred), std::ref(proj));
+                });
+                bounds.back() = end;
+                for(std::size_t width = 1; width < bounds.size() - 1; width *= 2)
+                {
+                    std::size_t const step = 2 * width, last = bounds.size() - 1;
+                    D const merges = static_cast<D>((last + step - 1) / step);
+                    detail::parallel_for_chunks(merges, merges, [&](D k, D, D)
+                    {
+                        std::size_t const lo = static_cast<std::size_t>(k) * step;
+                        std::size_t const mid = lo + width, hi = ranges::min(lo + step, last);
+                        if(mid < hi)
+                            inplace_merge(bounds[lo], bounds[mid], bounds[hi], std::ref(pred),
+                                std::ref(proj));
+                    });
+                }
+            }
+            // Sort contiguous pieces concurrently, then merge runs pairwise back
+            // and forth between the range and a buffer of the same size, with
+            // each merge split across the pool. Without memory for the buffer,
+            // the runs are merged in place instead, which is slower.
+            template<typename I, typename C, typename P>
+            static void impl(std::true_type, I begin, I end, C &pred, P &proj)
+            {
+                using D = iterator_difference_t<I>;
+                using V = iterator_value_t<I>;
+                D const n = end - begin;
+                D const chunks = detail::parallel_chunk_count(n, D(stable_sort_fn::parallel_grain()));
+                if(chunks < 2)
+                    return stable_sort_fn{}(begin, end, std::ref(pred), std::ref(proj)), void();
+                std::vector<V> buffer;
+                try
+                {
+                    buffer.reserve(static_cast<std::size_t>(n));
+                }
+                catch(std::bad_alloc const &)
+                {
+                    return stable_sort_fn::parallel_sort_in_place(begin, end, chunks, pred, proj);
+                }
+                std::vector<D> bounds(static_cast<std::size_t>(chunks + 1));
+                detail::parallel_for_chunks(n, chunks, [&](D k, D lo, D hi)
+                {
+                    bounds[static_cast<std::size_t>(k)] = lo;
+                    stable_sort_fn{}(begin + lo, begin + hi, std::ref(pred), std::ref(proj));
+                });
+                bounds.back() = n;
+                for(I i = begin; i != end; ++i)
+                    buffer.push_back(iter_move(i));
+                D const piece = (n + chunks - 1) / chunks;
+                bool in_buffer = true;
+                for(; bounds.size() > 2; in_buffer = !in_buffer)
+                {
+                    if(in_buffer)
+                        stable_sort_fn::parallel_merge_runs(buffer.begin(), begin, bounds, piece,
+                            pred, proj);
+                    else
+                        stable_sort_fn::parallel_merge_runs(begin, buffer.begin(), bounds, piece,
+                            pred, proj);
+                }
+                if(in_buffer)
+                    detail::parallel_for_chunks(n, chunks, [&](D, D lo, D hi)
+                    {
+                        move(buffer.begin() + lo, buffer.begin() + hi, begin + lo);
+                    });
+            }
+
         public:
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessIterator<I>() &&
@@ -179,6 +336,44 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// \overload
+            /// A `soa_vector` is sorted by its keys alone, and its columns are
+            /// then moved into place one at a time.
+            template<typename...Ts, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<soa_vector<Ts...>>,
+                CONCEPT_REQUIRES_(Sortable<I, C, P>())>
+            I operator()(soa_vector<Ts...> &rng, C pred = C{}, P proj = P{}) const
+            {
+                return rng.stable_sort(std::move(pred), std::move(proj));
+            }
+
+            /// \overload
+            /// With a parallel policy, pieces of the range are sorted concurrently
+            /// and then merged, each merge itself split across threads. This
+            /// allocates a buffer as large as the range.
+            template<typename E, typename I, typename S, typename C = ordered_less,
+                typename P = ident,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && Sortable<I, C, P>() &&
+                    RandomAccessIterator<I>() && Sentinel<S, I>())>
+            I operator()(E &&, I begin, S end_, C pred = C{}, P proj = P{}) const
+            {
+                I end = ranges::next(begin, end_);
+                stable_sort_fn::impl(detail::parallelizable<E, I>{}, begin, end, pred, proj);
+                return end;
+            }
+
+            /// \overload
+            template<typename E, typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && Sortable<I, C, P>() &&
+                    RandomAccessRange<Rng>())>
+            range_safe_iterator_t<Rng> operator()(E &&policy, Rng &&rng, C pred = C{},
+                P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng), std::move(pred),
+                    std::move(proj));
+            }
         };
 
         /// \sa `stable_sort_fn`
@@ -20,6 +20,8 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/utility/execution.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -27,6 +29,7 @@
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/utility/tagged_pair.hpp>
 #include <range/v3/utility/tagged_tuple.hpp>
+#include <range/v3/utility/thread_pool.hpp>
 #include <range/v3/algorithm/tagspec.hpp>
 
 namespace ranges
@@ -55,6 +58,33 @@ namespace ranges
         /// @{
         struct transform_fn
         {
+        private:
+            static constexpr std::ptrdiff_t parallel_grain() { return 1024; }
+
+            template<typename I, typename S, typename O, typename F, typename P>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl(std::false_type, I begin, S end, O out, F &fun, P &proj)
+            {
+                return transform_fn{}(detail::move(begin), detail::move(end), detail::move(out),
+                    ref(fun), ref(proj));
+            }
+            template<typename I, typename S, typename O, typename F, typename P>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl(std::true_type, I begin, S end_, O out, F &fun, P &proj)
+            {
+                using D = iterator_difference_t<I>;
+                I end = ranges::next(begin, std::move(end_));
+                D const n = end - begin;
+                detail::parallel_for_chunks(n,
+                    detail::parallel_chunk_count(n, D(transform_fn::parallel_grain())),
+                    [&](D, D lo, D hi)
+                    {
+                        transform_fn{}(begin + lo, begin + hi, out + lo, ref(fun), ref(proj));
+                    });
+                return {end, out + n};
+            }
+
+        public:
             // Single-range variant
             template<typename I, typename S, typename O, typename F, typename P = ident,
                 CONCEPT_REQUIRES_(Sentinel<S, I>() && Transformable1<I, O, F, P>())>
@@ -75,6 +105,31 @@ namespace ranges
                 return (*this)(begin(rng), end(rng), std::move(out), std::move(fun), std::move(proj));
             }
 
+            // Single-range variant with an execution policy. Runs on the thread
+            // pool when `E` is a parallel policy and both `I` and `O` are
+            // random-access.
+            template<typename E, typename I, typename S, typename O, typename F, typename P = ident,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && Sentinel<S, I>() &&
+                    Transformable1<I, O, F, P>())>
+            tagged_pair<tag::in(I), tag::out(O)>
+            operator()(E &&, I begin, S end, O out, F fun, P proj = P{}) const
+            {
+                return transform_fn::impl(
+                    meta::bool_<detail::parallelizable<E, I>() && RandomAccessIterator<O>()>{},
+                    std::move(begin), std::move(end), std::move(out), fun, proj);
+            }
+
+            template<typename E, typename Rng, typename O, typename F, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && Range<Rng>() &&
+                    Transformable1<I, O, F, P>())>
+            tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(O)>
+            operator()(E &&policy, Rng &&rng, O out, F fun, P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng), std::move(out),
+                    std::move(fun), std::move(proj));
+            }
+
             // Double-range variant, 4-iterator version
             template<typename I0, typename S0, typename I1, typename S1, typename O, typename F,
                 typename P0 = ident, typename P1 = ident,
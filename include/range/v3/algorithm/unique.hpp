@@ -65,6 +65,17 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            /// \overload
+            /// The elements of a `soa_vector` to keep are found first, and its
+            /// columns are then compacted one at a time.
+            template<typename...Ts, typename C = equal_to, typename P = ident,
+                typename I = range_iterator_t<soa_vector<Ts...>>,
+                CONCEPT_REQUIRES_(Sortable<I, C, P>())>
+            I operator()(soa_vector<Ts...> &rng, C pred = C{}, P proj = P{}) const
+            {
+                return rng.unique(std::move(pred), std::move(proj));
+            }
         };
 
         /// \sa `unique_fn`
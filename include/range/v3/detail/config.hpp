@@ -60,6 +60,18 @@ namespace ranges
 #endif
 #endif // RANGES_ASSUME
 
+// Keeps a function that is rarely called out of its callers, so that it does
+// not crowd the code of their fast paths.
+#ifndef RANGES_NOINLINE
+#if defined(__clang__) || defined(__GNUC__)
+#define RANGES_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define RANGES_NOINLINE __declspec(noinline)
+#else
+#define RANGES_NOINLINE
+#endif
+#endif // RANGES_NOINLINE
+
 #ifndef RANGES_EXPECT
 #ifdef NDEBUG
 #define RANGES_EXPECT(COND) RANGES_ASSUME(COND)
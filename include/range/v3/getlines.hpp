@@ -14,9 +14,13 @@
 #ifndef RANGES_V3_GETLINES_HPP
 #define RANGES_V3_GETLINES_HPP
 
+#include <cstddef>
+#include <cstring>
 #include <string>
 #include <istream>
+#include <vector>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/span.hpp>
 #include <range/v3/view_facade.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -90,6 +94,126 @@ namespace ranges
         };
 
         RANGES_INLINE_VARIABLE(getlines_fn, getlines)
+
+        /// The lines of a stream, like `getlines`, but read a block at a time
+        /// with `std::istream::read` and split with `memchr`. Each line is a
+        /// `span` into the block, valid until the next line is read; only a
+        /// line that crosses the end of a block is copied. The stream is read
+        /// ahead of the current line, a block at a time, so this is not for
+        /// interactive input or for a stream that is also read some other way.
+        struct buffered_getlines_range
+          : view_facade<buffered_getlines_range, unknown>
+        {
+        private:
+            friend range_access;
+            std::istream *sin_;
+            std::vector<char> buf_;
+            // The rest of a line that runs off the end of a block.
+            std::vector<char> spill_;
+            // The unread part of the block is [pos_, end_). The current line
+            // is [line_, line_ + len_) of the block, or all of spill_.
+            std::size_t pos_, end_, line_, len_;
+            bool spilled_, done_;
+            char delim_;
+            struct cursor
+            {
+            private:
+                buffered_getlines_range *rng_;
+            public:
+                cursor() = default;
+                explicit cursor(buffered_getlines_range &rng)
+                  : rng_(&rng)
+                {}
+                void next()
+                {
+                    rng_->next();
+                }
+                span<char const> read() const noexcept
+                {
+                    return rng_->cached();
+                }
+                bool equal(default_sentinel) const
+                {
+                    return rng_->done_;
+                }
+            };
+            bool fill()
+            {
+                sin_->read(buf_.data(), static_cast<std::streamsize>(buf_.size()));
+                pos_ = 0;
+                end_ = static_cast<std::size_t>(sin_->gcount());
+                return end_ != 0;
+            }
+            void next()
+            {
+                spilled_ = false;
+                if(pos_ == end_ && !fill())
+                {
+                    done_ = true;
+                    return;
+                }
+                for(;;)
+                {
+                    char const *const first = buf_.data() + pos_;
+                    void const *const p = std::memchr(first, delim_, end_ - pos_);
+                    std::size_t const n = p ?
+                        static_cast<std::size_t>(static_cast<char const *>(p) - first) :
+                        end_ - pos_;
+                    if(spilled_)
+                        spill_.insert(spill_.end(), first, first + n);
+                    else if(p)
+                    {
+                        line_ = pos_;
+                        len_ = n;
+                    }
+                    else
+                    {
+                        spill_.assign(first, first + n);
+                        spilled_ = true;
+                    }
+                    if(p)
+                    {
+                        pos_ += n + 1;
+                        return;
+                    }
+                    // As with std::getline, the last line need not end with
+                    // a delimiter.
+                    if(!fill())
+                        return;
+                }
+            }
+            cursor begin_cursor()
+            {
+                return cursor{*this};
+            }
+        public:
+            buffered_getlines_range() = default;
+            buffered_getlines_range(std::istream &sin, char delim = '\n',
+                std::size_t block_size = 1u << 16)
+              : sin_(&sin), buf_(block_size != 0 ? block_size : 1u), spill_{}
+              , pos_(0), end_(0), line_(0), len_(0), spilled_(false), done_(false)
+              , delim_(delim)
+            {
+                this->next(); // prime the pump
+            }
+            span<char const> cached() const noexcept
+            {
+                return spilled_ ?
+                    span<char const>{spill_.data(), static_cast<std::ptrdiff_t>(spill_.size())} :
+                    span<char const>{buf_.data() + line_, static_cast<std::ptrdiff_t>(len_)};
+            }
+        };
+
+        struct buffered_getlines_fn
+        {
+            buffered_getlines_range operator()(std::istream & sin, char delim = '\n',
+                std::size_t block_size = 1u << 16) const
+            {
+                return buffered_getlines_range{sin, delim, block_size};
+            }
+        };
+
+        RANGES_INLINE_VARIABLE(buffered_getlines_fn, buffered_getlines)
         /// @}
     }
 }
@@ -0,0 +1,215 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_MMAP_FILE_HPP
+#define RANGES_V3_MMAP_FILE_HPP
+
+#include <cerrno>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/view_interface.hpp>
+
+#ifdef _WIN32
+#include <cstdio>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-core
+        /// @{
+
+        /// How a mapped file will be read, passed on to the kernel with
+        /// `madvise` so that it can read ahead and drop pages accordingly.
+        enum class mmap_hint
+        {
+            normal,     ///< No particular order
+            sequential, ///< From front to back, each page once
+            random,     ///< In no predictable order; do not read ahead
+            willneed    ///< Soon, all of it; start reading it in now
+        };
+
+        /// \cond
+        namespace detail
+        {
+            // The contents of a whole file, read-only: mapped into memory, or,
+            // where there is no mmap, read into a buffer. Shared between the
+            // copies of an mmap_file and released with the last of them.
+            struct mapped_file
+            {
+            private:
+                void *data_ = nullptr;
+                std::size_t size_ = 0;
+
+                [[noreturn]] static void fail(char const *what, std::string const &path)
+                {
+                    throw std::system_error(errno, std::generic_category(),
+                        std::string("mmap_file: cannot ") + what + " " + path);
+                }
+            public:
+            #ifdef _WIN32
+                explicit mapped_file(std::string const &path)
+                {
+                    std::unique_ptr<std::FILE, int (*)(std::FILE *)> f{
+                        std::fopen(path.c_str(), "rb"), &std::fclose};
+                    if(!f)
+                        mapped_file::fail("open", path);
+                    if(std::fseek(f.get(), 0, SEEK_END) != 0)
+                        mapped_file::fail("read", path);
+                    long const size = std::ftell(f.get());
+                    if(size < 0 || std::fseek(f.get(), 0, SEEK_SET) != 0)
+                        mapped_file::fail("read", path);
+                    size_ = static_cast<std::size_t>(size);
+                    data_ = ::operator new(size_);
+                    if(std::fread(data_, 1, size_, f.get()) != size_)
+                    {
+                        ::operator delete(data_);
+                        mapped_file::fail("read", path);
+                    }
+                }
+                ~mapped_file()
+                {
+                    ::operator delete(data_);
+                }
+                void advise(mmap_hint, std::size_t, std::size_t) const noexcept
+                {}
+            #else
+                explicit mapped_file(std::string const &path)
+                {
+                    int const fd = ::open(path.c_str(), O_RDONLY);
+                    if(fd < 0)
+                        mapped_file::fail("open", path);
+                    struct ::stat st;
+                    if(::fstat(fd, &st) != 0)
+                    {
+                        int const err = errno;
+                        ::close(fd);
+                        errno = err;
+                        mapped_file::fail("stat", path);
+                    }
+                    size_ = static_cast<std::size_t>(st.st_size);
+                    // Mapping nothing is an error; an empty file is just empty.
+                    if(size_ != 0)
+                    {
+                        data_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                        if(data_ == MAP_FAILED)
+                        {
+                            int const err = errno;
+                            data_ = nullptr;
+                            ::close(fd);
+                            errno = err;
+                            mapped_file::fail("map", path);
+                        }
+                    }
+                    ::close(fd);
+                }
+                ~mapped_file()
+                {
+                    if(data_)
+                        ::munmap(data_, size_);
+                }
+                // Hints are advisory; a kernel that rejects one reads the file
+                // all the same.
+                void advise(mmap_hint hint, std::size_t offset, std::size_t length) const noexcept
+                {
+                    if(!data_ || offset >= size_)
+                        return;
+                    // madvise wants a page-aligned address.
+                    std::size_t const page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+                    std::size_t const start = offset / page * page;
+                    length = (length < size_ - offset ? length : size_ - offset) + (offset - start);
+                    int const advice =
+                        hint == mmap_hint::sequential ? MADV_SEQUENTIAL :
+                        hint == mmap_hint::random ? MADV_RANDOM :
+                        hint == mmap_hint::willneed ? MADV_WILLNEED : MADV_NORMAL;
+                    (void) ::madvise(static_cast<char *>(data_) + start, length, advice);
+                }
+            #endif
+                mapped_file(mapped_file const &) = delete;
+                mapped_file &operator=(mapped_file const &) = delete;
+
+                void const *data() const noexcept
+                {
+                    return data_;
+                }
+                std::size_t size() const noexcept
+                {
+                    return size_;
+                }
+            };
+        }
+        /// \endcond
+
+        /// A read-only contiguous view of the contents of a file as an array of
+        /// `T`, mapped into memory rather than read through a stream. Trailing
+        /// bytes that do not make up a whole `T` are not part of the view. The
+        /// mapping is shared by copies of the view and is released with the
+        /// last of them; elements must not be used after that.
+        ///
+        /// \throw std::system_error if the file cannot be opened or mapped.
+        template<typename T>
+        struct mmap_file
+          : view_interface<mmap_file<T>>
+        {
+            static_assert(std::is_trivially_copyable<T>::value,
+                "mmap_file can only view a file as an array of trivially copyable objects.");
+        private:
+            std::shared_ptr<detail::mapped_file const> file_;
+        public:
+            mmap_file() = default;
+            explicit mmap_file(std::string const &path, mmap_hint hint = mmap_hint::sequential)
+              : file_(std::make_shared<detail::mapped_file>(path))
+            {
+                advise(hint);
+            }
+            T const *begin() const noexcept
+            {
+                return file_ ? static_cast<T const *>(file_->data()) : nullptr;
+            }
+            T const *end() const noexcept
+            {
+                return begin() + size();
+            }
+            T const *data() const noexcept
+            {
+                return begin();
+            }
+            std::size_t size() const noexcept
+            {
+                return file_ ? file_->size() / sizeof(T) : 0u;
+            }
+            /// Advise the kernel how the elements `[pos, pos + count)` will be
+            /// read from now on. Has no effect where files are not mapped.
+            void advise(mmap_hint hint, std::size_t pos = 0,
+                std::size_t count = static_cast<std::size_t>(-1)) const noexcept
+            {
+                if(file_ && pos < size())
+                    file_->advise(hint, pos * sizeof(T),
+                        count < size() - pos ? count * sizeof(T) : (size() - pos) * sizeof(T));
+            }
+        };
+        /// @}
+    }
+}
+
+#endif
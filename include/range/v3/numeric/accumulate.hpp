@@ -13,14 +13,22 @@
 #ifndef RANGES_V3_NUMERIC_ACCUMULATE_HPP
 #define RANGES_V3_NUMERIC_ACCUMULATE_HPP
 
+#include <cstddef>
+#include <vector>
 #include <meta/meta.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/algorithm/aux_/blocks.hpp>
+#include <range/v3/algorithm/aux_/segments.hpp>
+#include <range/v3/utility/execution.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/optional.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/thread_pool.hpp>
 
 namespace ranges
 {
@@ -32,14 +40,93 @@ namespace ranges
             IndirectInvocable<Op, T *, projected<I, P>>,
             Assignable<T&, indirect_result_of_t<Op&(T *, projected<I, P>)>>>;
 
+        /// \cond
+        namespace detail
+        {
+            // What a parallel accumulate needs beyond Accumulateable: partial
+            // sums are seeded from an element and then combined with each other.
+            template<typename I, typename T, typename Op, typename P>
+            using ParallelAccumulateable = meta::strict_and<
+                Constructible<T, iterator_reference_t<projected<I, P>>>,
+                IndirectInvocable<Op, T *, T *>>;
+        }
+        /// \endcond
+
         struct accumulate_fn
         {
+        private:
+            static constexpr std::ptrdiff_t parallel_grain() { return 1024; }
+
+            template<typename I, typename S, typename T, typename Op, typename P>
+            static T impl(std::false_type, I begin, S end, T init, Op &op, P &proj)
+            {
+                return accumulate_fn{}(std::move(begin), std::move(end), std::move(init), ref(op),
+                    ref(proj));
+            }
+            template<typename I, typename S, typename T, typename Op, typename P>
+            static T impl(std::true_type, I begin, S end, T init, Op &op, P &proj)
+            {
+                using D = iterator_difference_t<I>;
+                D const n = ranges::next(begin, std::move(end)) - begin;
+                if(n == 0)
+                    return init;
+                D const chunks = detail::fixed_chunk_count(n, D(accumulate_fn::parallel_grain()));
+                std::vector<optional<T>> partial(static_cast<std::size_t>(chunks));
+                detail::parallel_for_chunks(n, chunks, [&](D k, D lo, D hi)
+                {
+                    I i = begin + lo;
+                    T acc(invoke(proj, *i));
+                    partial[static_cast<std::size_t>(k)] =
+                        accumulate_fn{}(++i, begin + hi, std::move(acc), ref(op), ref(proj));
+                });
+                for(auto &t : partial)
+                    init = invoke(op, init, *t);
+                return init;
+            }
+
+            template<typename I, typename S, typename T, typename Op, typename P>
+            static T blocks(std::false_type, I &begin, S const &end, T init, Op &op, P &proj)
+            {
+                for(; begin != end; ++begin)
+                    init = invoke(op, init, invoke(proj, *begin));
+                return init;
+            }
+            // Views that hand out blocks are summed a block at a time, so that
+            // the work of the views is done in a loop over each block.
+            template<typename I, typename S, typename T, typename Op, typename P>
+            static T blocks(std::true_type, I &begin, S const &end, T init, Op &op, P &proj)
+            {
+                iterator_value_t<I> buf[detail::block_size()];
+                while(std::ptrdiff_t const n =
+                    detail::read_block(begin, end, buf, detail::block_size()))
+                {
+                    for(std::ptrdiff_t i = 0; i < n; ++i)
+                        init = invoke(op, init, invoke(proj, buf[i]));
+                }
+                return init;
+            }
+            // Sums [first, last) into init.
+            template<typename T, typename Op, typename P>
+            struct sum_step
+            {
+                T &init;
+                Op &op;
+                P &proj;
+                template<typename J, typename U>
+                void operator()(J &first, U const &last) const
+                {
+                    init = accumulate_fn::blocks(detail::block_loopable<J, U>{}, first, last,
+                        std::move(init), op, proj);
+                }
+            };
+
+        public:
             template<typename I, typename S, typename T, typename Op = plus, typename P = ident,
                 CONCEPT_REQUIRES_(Sentinel<S, I>() && Accumulateable<I, T, Op, P>())>
             T operator()(I begin, S end, T init, Op op = Op{}, P proj = P{}) const
             {
-                for(; begin != end; ++begin)
-                    init = invoke(op, init, invoke(proj, *begin));
+                sum_step<T, Op, P> step{init, op, proj};
+                detail::visit_segments(std::move(begin), end, step);
                 return init;
             }
 
@@ -51,6 +138,32 @@ namespace ranges
                 return (*this)(begin(rng), end(rng), std::move(init), std::move(op),
                     std::move(proj));
             }
+
+            /// Like the sequential overloads, but when `E` is a parallel policy
+            /// and `I` is random-access, the range is cut into contiguous pieces
+            /// that are summed concurrently and then folded into `init` from left
+            /// to right. This requires `op` to be associative.
+            template<typename E, typename I, typename S, typename T, typename Op = plus,
+                typename P = ident,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && Sentinel<S, I>() &&
+                    Accumulateable<I, T, Op, P>())>
+            T operator()(E &&, I begin, S end, T init, Op op = Op{}, P proj = P{}) const
+            {
+                return accumulate_fn::impl(
+                    meta::bool_<detail::parallelizable<E, I>() &&
+                        detail::ParallelAccumulateable<I, T, Op, P>()>{},
+                    std::move(begin), std::move(end), std::move(init), op, proj);
+            }
+
+            template<typename E, typename Rng, typename T, typename Op = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && Range<Rng>() &&
+                    Accumulateable<I, T, Op, P>())>
+            T operator()(E &&policy, Rng && rng, T init, Op op = Op{}, P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng), std::move(init),
+                    std::move(op), std::move(proj));
+            }
         };
 
         RANGES_INLINE_VARIABLE(with_braced_init_args<accumulate_fn>, accumulate)
@@ -0,0 +1,147 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_NUMERIC_EXCLUSIVE_SCAN_HPP
+#define RANGES_V3_NUMERIC_EXCLUSIVE_SCAN_HPP
+
+#include <cstddef>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/algorithm/tagspec.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/numeric/inclusive_scan.hpp>
+#include <range/v3/numeric/reduce.hpp>
+#include <range/v3/utility/execution.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/tagged_pair.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        template<typename I, typename O, typename T, typename BOp = plus, typename P = ident>
+        using ExclusiveScannable = meta::strict_and<
+            Accumulateable<I, T, BOp, P>,
+            OutputIterator<O, T>>;
+
+        /// Writes `init`, then the fold of `init` and the first element, and so
+        /// on, leaving out the last element. `bop` need only be associative:
+        /// when `E` is a parallel policy and both iterators are random-access,
+        /// the range is cut into pieces, the pieces are summed concurrently, and
+        /// then they are scanned concurrently, each starting from the sum of
+        /// `init` and the pieces before it. This reads the input twice.
+        struct exclusive_scan_fn
+        {
+        private:
+            static constexpr std::ptrdiff_t parallel_grain() { return 4096; }
+
+            template<typename E, typename I, typename O, typename T, typename BOp, typename P>
+            using parallel = meta::bool_<
+                detail::parallelizable<E, I>() && RandomAccessIterator<O>() &&
+                Reduceable<I, T, BOp, P>()>;
+
+            template<typename I, typename S, typename O, typename T, typename BOp, typename P>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl(std::false_type, I begin, S end, O out, T init, BOp &bop, P &proj)
+            {
+                for(; begin != end; ++begin, ++out)
+                {
+                    // Read the element before writing, in case out is begin.
+                    auto next = invoke(bop, init, invoke(proj, *begin));
+                    *out = std::move(init);
+                    init = std::move(next);
+                }
+                return {begin, out};
+            }
+            template<typename I, typename S, typename O, typename T, typename BOp, typename P>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl(std::true_type, I begin, S end, O out, T init, BOp &bop, P &proj)
+            {
+                using D = iterator_difference_t<I>;
+                using OD = iterator_difference_t<O>;
+                D const n = ranges::next(begin, std::move(end)) - begin;
+                detail::projected_at<I, P> const read{begin, proj};
+                detail::parallel_scan(n, optional<T>{std::move(init)}, bop, read,
+                    [&](D lo, D hi, optional<T> const &carry)
+                    {
+                        T acc = *carry;
+                        for(D i = lo; i < hi; ++i)
+                        {
+                            auto next = invoke(bop, acc, read(i));
+                            out[static_cast<OD>(i)] = std::move(acc);
+                            acc = std::move(next);
+                        }
+                    }, D(exclusive_scan_fn::parallel_grain()));
+                return {begin + n, out + static_cast<OD>(n)};
+            }
+
+        public:
+            template<typename I, typename S, typename O, typename T, typename BOp = plus,
+                typename P = ident,
+                CONCEPT_REQUIRES_(Sentinel<S, I>() && ExclusiveScannable<I, O, T, BOp, P>())>
+            tagged_pair<tag::in(I), tag::out(O)>
+            operator()(I begin, S end, O out, T init, BOp bop = BOp{}, P proj = P{}) const
+            {
+                return exclusive_scan_fn::impl(std::false_type{}, std::move(begin),
+                    std::move(end), std::move(out), std::move(init), bop, proj);
+            }
+
+            template<typename Rng, typename ORef, typename T, typename BOp = plus,
+                typename P = ident, typename I = range_iterator_t<Rng>,
+                typename O = uncvref_t<ORef>,
+                CONCEPT_REQUIRES_(Range<Rng>() && ExclusiveScannable<I, O, T, BOp, P>())>
+            tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(O)>
+            operator()(Rng && rng, ORef && out, T init, BOp bop = BOp{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::forward<ORef>(out), std::move(init),
+                    std::move(bop), std::move(proj));
+            }
+
+            template<typename E, typename I, typename S, typename O, typename T,
+                typename BOp = plus, typename P = ident,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && Sentinel<S, I>() &&
+                    ExclusiveScannable<I, O, T, BOp, P>())>
+            tagged_pair<tag::in(I), tag::out(O)>
+            operator()(E &&, I begin, S end, O out, T init, BOp bop = BOp{},
+                P proj = P{}) const
+            {
+                return exclusive_scan_fn::impl(parallel<E, I, O, T, BOp, P>{}, std::move(begin),
+                    std::move(end), std::move(out), std::move(init), bop, proj);
+            }
+
+            template<typename E, typename Rng, typename ORef, typename T, typename BOp = plus,
+                typename P = ident, typename I = range_iterator_t<Rng>,
+                typename O = uncvref_t<ORef>,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && Range<Rng>() &&
+                    ExclusiveScannable<I, O, T, BOp, P>())>
+            tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(O)>
+            operator()(E &&policy, Rng && rng, ORef && out, T init, BOp bop = BOp{},
+                P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng),
+                    std::forward<ORef>(out), std::move(init), std::move(bop), std::move(proj));
+            }
+        };
+
+        RANGES_INLINE_VARIABLE(exclusive_scan_fn, exclusive_scan)
+    }
+}
+
+#endif
@@ -0,0 +1,174 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_NUMERIC_INCLUSIVE_SCAN_HPP
+#define RANGES_V3_NUMERIC_INCLUSIVE_SCAN_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <meta/meta.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/algorithm/tagspec.hpp>
+#include <range/v3/numeric/partial_sum.hpp>
+#include <range/v3/numeric/reduce.hpp>
+#include <range/v3/utility/execution.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/tagged_pair.hpp>
+#include <range/v3/utility/thread_pool.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Scans [0, n) on the thread pool in two passes. First the pieces but
+            // the last are folded concurrently, and each piece's carry is the
+            // fold of carry and the pieces before it. Then scan(lo, hi, carry)
+            // scans each piece concurrently. op need only be associative.
+            template<typename D, typename T, typename Op, typename Read, typename Scan>
+            void parallel_scan(D n, optional<T> carry, Op &op, Read read, Scan scan, D grain)
+            {
+                if(n == 0)
+                    return;
+                D const chunks = detail::fixed_chunk_count(n, grain);
+                std::vector<optional<T>> carries(static_cast<std::size_t>(chunks));
+                detail::parallel_for_chunks(n, chunks, [&](D k, D lo, D hi)
+                {
+                    if(k + 1 == chunks)
+                        return;
+                    T acc(read(lo));
+                    for(D i = lo + 1; i < hi; ++i)
+                        acc = invoke(op, acc, read(i));
+                    carries[static_cast<std::size_t>(k + 1)] = std::move(acc);
+                });
+                carries[0] = std::move(carry);
+                for(std::size_t k = 1; k < carries.size(); ++k)
+                    if(carries[k - 1])
+                        carries[k] = invoke(op, *carries[k - 1], *carries[k]);
+                detail::parallel_for_chunks(n, chunks, [&](D k, D lo, D hi)
+                {
+                    scan(lo, hi, carries[static_cast<std::size_t>(k)]);
+                });
+            }
+        }
+        /// \endcond
+
+        /// Like `partial_sum`, but `bop` need only be associative: when `E` is a
+        /// parallel policy and both iterators are random-access, the range is
+        /// cut into pieces, the pieces are summed concurrently, and then they
+        /// are scanned concurrently, each starting from the sum of the pieces
+        /// before it. This reads the input twice. Where the pieces fall depends
+        /// only on the size of the range, not on the number of threads, so the
+        /// result is the same on every machine.
+        struct inclusive_scan_fn
+        {
+        private:
+            static constexpr std::ptrdiff_t parallel_grain() { return 4096; }
+
+            template<typename I, typename P>
+            using value_t = uncvref_t<concepts::Invocable::result_t<P&, iterator_value_t<I>>>;
+
+            template<typename E, typename I, typename O, typename BOp, typename P>
+            using parallel = meta::bool_<
+                detail::parallelizable<E, I>() && RandomAccessIterator<O>() &&
+                Reduceable<I, value_t<I, P>, BOp, P>()>;
+
+            template<typename I, typename S, typename O, typename BOp, typename P>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl(std::false_type, I begin, S end, O out, BOp &bop, P &proj)
+            {
+                return partial_sum(std::move(begin), std::move(end), std::move(out), ref(bop),
+                    ref(proj));
+            }
+            template<typename I, typename S, typename O, typename BOp, typename P>
+            static tagged_pair<tag::in(I), tag::out(O)>
+            impl(std::true_type, I begin, S end, O out, BOp &bop, P &proj)
+            {
+                using D = iterator_difference_t<I>;
+                using T = value_t<I, P>;
+                using OD = iterator_difference_t<O>;
+                D const n = ranges::next(begin, std::move(end)) - begin;
+                detail::projected_at<I, P> const read{begin, proj};
+                detail::parallel_scan(n, optional<T>{}, bop, read,
+                    [&](D lo, D hi, optional<T> const &carry)
+                    {
+                        T acc = carry ? T(invoke(bop, *carry, read(lo))) : T(read(lo));
+                        out[static_cast<OD>(lo)] = acc;
+                        for(D i = lo + 1; i < hi; ++i)
+                        {
+                            acc = invoke(bop, acc, read(i));
+                            out[static_cast<OD>(i)] = acc;
+                        }
+                    }, D(inclusive_scan_fn::parallel_grain()));
+                return {begin + n, out + static_cast<OD>(n)};
+            }
+
+        public:
+            template<typename I, typename S, typename O, typename BOp = plus, typename P = ident,
+                CONCEPT_REQUIRES_(Sentinel<S, I>() && PartialSummable<I, O, BOp, P>())>
+            tagged_pair<tag::in(I), tag::out(O)>
+            operator()(I begin, S end, O out, BOp bop = BOp{}, P proj = P{}) const
+            {
+                return inclusive_scan_fn::impl(std::false_type{}, std::move(begin),
+                    std::move(end), std::move(out), bop, proj);
+            }
+
+            template<typename Rng, typename ORef, typename BOp = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>, typename O = uncvref_t<ORef>,
+                CONCEPT_REQUIRES_(Range<Rng>() && PartialSummable<I, O, BOp, P>())>
+            tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(O)>
+            operator()(Rng && rng, ORef && out, BOp bop = BOp{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::forward<ORef>(out), std::move(bop),
+                    std::move(proj));
+            }
+
+            template<typename E, typename I, typename S, typename O, typename BOp = plus,
+                typename P = ident,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && Sentinel<S, I>() &&
+                    PartialSummable<I, O, BOp, P>())>
+            tagged_pair<tag::in(I), tag::out(O)>
+            operator()(E &&, I begin, S end, O out, BOp bop = BOp{}, P proj = P{}) const
+            {
+                return inclusive_scan_fn::impl(parallel<E, I, O, BOp, P>{}, std::move(begin),
+                    std::move(end), std::move(out), bop, proj);
+            }
+
+            template<typename E, typename Rng, typename ORef, typename BOp = plus,
+                typename P = ident, typename I = range_iterator_t<Rng>,
+                typename O = uncvref_t<ORef>,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && Range<Rng>() &&
+                    PartialSummable<I, O, BOp, P>())>
+            tagged_pair<tag::in(range_safe_iterator_t<Rng>), tag::out(O)>
+            operator()(E &&policy, Rng && rng, ORef && out, BOp bop = BOp{},
+                P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng),
+                    std::forward<ORef>(out), std::move(bop), std::move(proj));
+            }
+        };
+
+        RANGES_INLINE_VARIABLE(inclusive_scan_fn, inclusive_scan)
+    }
+}
+
+#endif
@@ -0,0 +1,199 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_NUMERIC_REDUCE_HPP
+#define RANGES_V3_NUMERIC_REDUCE_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <meta/meta.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/utility/execution.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/thread_pool.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        template<typename I, typename T, typename Op = plus, typename P = ident>
+        using Reduceable = meta::strict_and<
+            Accumulateable<I, T, Op, P>,
+            detail::ParallelAccumulateable<I, T, Op, P>,
+            Assignable<T&, indirect_result_of_t<Op&(T *, T *)>>>;
+
+        /// \cond
+        namespace detail
+        {
+            // Folds read(0), ..., read(n - 1) into init with four partial results,
+            // so that each application of op need not wait for the one before
+            // it. op must be associative and commutative.
+            template<typename D, typename T, typename Op, typename Read>
+            T unrolled_reduce(D n, T init, Op &op, Read read)
+            {
+                if(n < 8)
+                {
+                    for(D i = 0; i < n; ++i)
+                        init = invoke(op, init, read(i));
+                    return init;
+                }
+                T a0(read(0)), a1(read(1)), a2(read(2)), a3(read(3));
+                D i = 4;
+                for(; n - i >= 4; i += 4)
+                {
+                    a0 = invoke(op, a0, read(i));
+                    a1 = invoke(op, a1, read(i + 1));
+                    a2 = invoke(op, a2, read(i + 2));
+                    a3 = invoke(op, a3, read(i + 3));
+                }
+                for(; i < n; ++i)
+                    a0 = invoke(op, a0, read(i));
+                a0 = invoke(op, a0, a1);
+                a2 = invoke(op, a2, a3);
+                a0 = invoke(op, a0, a2);
+                return invoke(op, init, a0);
+            }
+
+            // The projection of the i-th element from begin.
+            template<typename I, typename P>
+            struct projected_at
+            {
+                I begin;
+                P &proj;
+                auto operator()(iterator_difference_t<I> i) const ->
+                    decltype(invoke(proj, begin[i]))
+                {
+                    return invoke(proj, begin[i]);
+                }
+            };
+
+            // Reduces [0, n) on the thread pool: each piece is folded into a
+            // partial result seeded from its first value, and the partial
+            // results are folded into init in order.
+            template<typename D, typename T, typename Op, typename Read>
+            T parallel_reduce(D n, T init, Op &op, Read read, D grain)
+            {
+                if(n == 0)
+                    return init;
+                D const chunks = detail::fixed_chunk_count(n, grain);
+                std::vector<optional<T>> partial(static_cast<std::size_t>(chunks));
+                detail::parallel_for_chunks(n, chunks, [&](D k, D lo, D hi)
+                {
+                    T acc(read(lo));
+                    partial[static_cast<std::size_t>(k)] = detail::unrolled_reduce(
+                        hi - lo - 1, std::move(acc), op, [&](D i) -> decltype(read(i)) {
+                            return read(lo + 1 + i);
+                        });
+                });
+                for(auto &t : partial)
+                    init = invoke(op, init, *t);
+                return init;
+            }
+        }
+        /// \endcond
+
+        /// Like `accumulate`, but `op` must be associative and commutative, so
+        /// the values may be combined in any order. Random-access ranges are
+        /// folded into several partial results at once, so that the next
+        /// application of `op` does not wait on the last; floating-point sums
+        /// may therefore differ from `accumulate`'s in their rounding.
+        struct reduce_fn
+        {
+        private:
+            static constexpr std::ptrdiff_t parallel_grain() { return 4096; }
+
+            template<typename I, typename S, typename T, typename Op, typename P>
+            static T sequential(std::false_type, I begin, S end, T init, Op &op, P &proj)
+            {
+                return accumulate(std::move(begin), std::move(end), std::move(init), ref(op),
+                    ref(proj));
+            }
+            template<typename I, typename S, typename T, typename Op, typename P>
+            static T sequential(std::true_type, I begin, S end, T init, Op &op, P &proj)
+            {
+                auto const n = ranges::next(begin, std::move(end)) - begin;
+                return detail::unrolled_reduce(n, std::move(init), op,
+                    detail::projected_at<I, P>{begin, proj});
+            }
+
+            template<typename I, typename S, typename T, typename Op, typename P>
+            static T impl(std::false_type, I begin, S end, T init, Op &op, P &proj)
+            {
+                return reduce_fn::sequential(RandomAccessIterator<I>(), std::move(begin),
+                    std::move(end), std::move(init), op, proj);
+            }
+            template<typename I, typename S, typename T, typename Op, typename P>
+            static T impl(std::true_type, I begin, S end, T init, Op &op, P &proj)
+            {
+                using D = iterator_difference_t<I>;
+                D const n = ranges::next(begin, std::move(end)) - begin;
+                return detail::parallel_reduce(n, std::move(init), op,
+                    detail::projected_at<I, P>{begin, proj}, D(reduce_fn::parallel_grain()));
+            }
+
+        public:
+            template<typename I, typename S, typename T, typename Op = plus, typename P = ident,
+                CONCEPT_REQUIRES_(Sentinel<S, I>() && Reduceable<I, T, Op, P>())>
+            T operator()(I begin, S end, T init, Op op = Op{}, P proj = P{}) const
+            {
+                return reduce_fn::impl(std::false_type{}, std::move(begin), std::move(end),
+                    std::move(init), op, proj);
+            }
+
+            template<typename Rng, typename T, typename Op = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(Range<Rng>() && Reduceable<I, T, Op, P>())>
+            T operator()(Rng && rng, T init, Op op = Op{}, P proj = P{}) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(init), std::move(op),
+                    std::move(proj));
+            }
+
+            /// When `E` is a parallel policy and `I` is random-access, the range
+            /// is cut into contiguous pieces that are reduced concurrently. Where
+            /// the pieces fall depends only on the size of the range, not on the
+            /// number of threads, so the result is the same on every machine.
+            template<typename E, typename I, typename S, typename T, typename Op = plus,
+                typename P = ident,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && Sentinel<S, I>() &&
+                    Reduceable<I, T, Op, P>())>
+            T operator()(E &&, I begin, S end, T init, Op op = Op{}, P proj = P{}) const
+            {
+                return reduce_fn::impl(detail::parallelizable<E, I>{}, std::move(begin),
+                    std::move(end), std::move(init), op, proj);
+            }
+
+            template<typename E, typename Rng, typename T, typename Op = plus, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>() && Range<Rng>() &&
+                    Reduceable<I, T, Op, P>())>
+            T operator()(E &&policy, Rng && rng, T init, Op op = Op{}, P proj = P{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng), end(rng), std::move(init),
+                    std::move(op), std::move(proj));
+            }
+        };
+
+        RANGES_INLINE_VARIABLE(with_braced_init_args<reduce_fn>, reduce)
+    }
+}
+
+#endif
@@ -0,0 +1,248 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_NUMERIC_TRANSFORM_REDUCE_HPP
+#define RANGES_V3_NUMERIC_TRANSFORM_REDUCE_HPP
+
+#include <cstddef>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/numeric/inner_product.hpp>
+#include <range/v3/numeric/reduce.hpp>
+#include <range/v3/utility/execution.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/unreachable.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        template<typename I1, typename I2, typename T,
+            typename BOp1 = plus, typename BOp2 = multiplies,
+            typename P1 = ident, typename P2 = ident,
+            typename V1 = iterator_value_t<I1>,
+            typename V2 = iterator_value_t<I2>,
+            typename X1 = concepts::Invocable::result_t<P1&, V1>,
+            typename X2 = concepts::Invocable::result_t<P2&, V2>,
+            typename Y2 = concepts::Invocable::result_t<BOp2&, X1, X2>,
+            typename Y1 = concepts::Invocable::result_t<BOp1&, T, T>>
+        using TransformReduceable = meta::strict_and<
+            InnerProductable<I1, I2, T, BOp1, BOp2, P1, P2>,
+            Constructible<T, Y2>,
+            Invocable<BOp1&, T, T>,
+            Assignable<T&, Y1>>;
+
+        /// \cond
+        namespace detail
+        {
+            // bop2 applied to the projections of the i-th elements from begin1
+            // and begin2.
+            template<typename I1, typename I2, typename BOp2, typename P1, typename P2>
+            struct transformed_at
+            {
+                I1 begin1;
+                I2 begin2;
+                BOp2 &bop2;
+                P1 &proj1;
+                P2 &proj2;
+                auto operator()(iterator_difference_t<I1> i) const ->
+                    decltype(invoke(bop2, invoke(proj1, begin1[i]),
+                        invoke(proj2, begin2[static_cast<iterator_difference_t<I2>>(i)])))
+                {
+                    return invoke(bop2, invoke(proj1, begin1[i]),
+                        invoke(proj2, begin2[static_cast<iterator_difference_t<I2>>(i)]));
+                }
+            };
+        }
+        /// \endcond
+
+        /// Like `inner_product`, but `bop1` must be associative and commutative,
+        /// so the products may be combined in any order. Random-access ranges
+        /// are folded into several partial results at once, so that the next
+        /// application of `bop1` does not wait on the last; floating-point dot
+        /// products may therefore differ from `inner_product`'s in their
+        /// rounding. To transform the elements of a single range, pass the
+        /// transformation to `reduce` as its projection.
+        struct transform_reduce_fn
+        {
+        private:
+            static constexpr std::ptrdiff_t parallel_grain() { return 4096; }
+
+            template<typename I1, typename S1, typename I2, typename S2, typename T,
+                typename BOp1, typename BOp2, typename P1, typename P2>
+            static T impl(std::false_type, std::false_type, I1 begin1, S1 end1, I2 begin2,
+                S2 end2, T init, BOp1 &bop1, BOp2 &bop2, P1 &proj1, P2 &proj2)
+            {
+                return inner_product(std::move(begin1), std::move(end1), std::move(begin2),
+                    std::move(end2), std::move(init), ref(bop1), ref(bop2), ref(proj1),
+                    ref(proj2));
+            }
+            template<typename Par, typename I1, typename S1, typename I2, typename S2,
+                typename T, typename BOp1, typename BOp2, typename P1, typename P2>
+            static T impl(std::true_type, Par, I1 begin1, S1 end1, I2 begin2, S2 end2, T init,
+                BOp1 &bop1, BOp2 &bop2, P1 &proj1, P2 &proj2)
+            {
+                using D = iterator_difference_t<I1>;
+                D const n1 = ranges::next(begin1, std::move(end1)) - begin1;
+                D const n2 = transform_reduce_fn::count(begin2, std::move(end2), n1);
+                detail::transformed_at<I1, I2, BOp2, P1, P2> read{begin1, begin2, bop2, proj1,
+                    proj2};
+                return transform_reduce_fn::reduce(Par{}, n1 < n2 ? n1 : n2, std::move(init),
+                    bop1, read);
+            }
+            // How many elements the second range has, or at least n if it has no
+            // end.
+            template<typename I2, typename S2, typename D>
+            static D count(I2 const &begin2, S2 end2, D)
+            {
+                return static_cast<D>(ranges::next(begin2, std::move(end2)) - begin2);
+            }
+            template<typename I2, typename D>
+            static D count(I2 const &, unreachable, D n)
+            {
+                return n;
+            }
+            template<typename D, typename T, typename BOp1, typename Read>
+            static T reduce(std::false_type, D n, T init, BOp1 &bop1, Read read)
+            {
+                return detail::unrolled_reduce(n, std::move(init), bop1, read);
+            }
+            template<typename D, typename T, typename BOp1, typename Read>
+            static T reduce(std::true_type, D n, T init, BOp1 &bop1, Read read)
+            {
+                return detail::parallel_reduce(n, std::move(init), bop1, read,
+                    D(transform_reduce_fn::parallel_grain()));
+            }
+
+            template<typename E, typename I1, typename I2>
+            using parallel = meta::bool_<
+                detail::parallelizable<E, I1>() && RandomAccessIterator<I2>()>;
+            template<typename I1, typename I2>
+            using indexable = meta::strict_and<RandomAccessIterator<I1>,
+                RandomAccessIterator<I2>>;
+
+        public:
+            template<typename I1, typename S1, typename I2, typename T,
+                typename BOp1 = plus, typename BOp2 = multiplies,
+                typename P1 = ident, typename P2 = ident,
+                CONCEPT_REQUIRES_(
+                    Sentinel<S1, I1>() &&
+                    TransformReduceable<I1, I2, T, BOp1, BOp2, P1, P2>()
+                )>
+            T operator()(I1 begin1, S1 end1, I2 begin2, T init, BOp1 bop1 = BOp1{},
+                BOp2 bop2 = BOp2{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return transform_reduce_fn::impl(indexable<I1, I2>{}, std::false_type{},
+                    std::move(begin1), std::move(end1), std::move(begin2),
+                    unreachable{}, std::move(init), bop1, bop2, proj1, proj2);
+            }
+
+            template<typename I1, typename S1, typename I2, typename S2, typename T,
+                typename BOp1 = plus, typename BOp2 = multiplies,
+                typename P1 = ident, typename P2 = ident,
+                CONCEPT_REQUIRES_(
+                    Sentinel<S1, I1>() &&
+                    Sentinel<S2, I2>() &&
+                    TransformReduceable<I1, I2, T, BOp1, BOp2, P1, P2>()
+                )>
+            T operator()(I1 begin1, S1 end1, I2 begin2, S2 end2, T init, BOp1 bop1 = BOp1{},
+                BOp2 bop2 = BOp2{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return transform_reduce_fn::impl(indexable<I1, I2>{}, std::false_type{},
+                    std::move(begin1), std::move(end1), std::move(begin2), std::move(end2),
+                    std::move(init), bop1, bop2, proj1, proj2);
+            }
+
+            template<typename Rng1, typename I2Ref, typename T, typename BOp1 = plus,
+                typename BOp2 = multiplies, typename P1 = ident, typename P2 = ident,
+                typename I1 = range_iterator_t<Rng1>,
+                typename I2 = uncvref_t<I2Ref>,
+                CONCEPT_REQUIRES_(
+                    Range<Rng1>() && Iterator<I2>() &&
+                    TransformReduceable<I1, I2, T, BOp1, BOp2, P1, P2>()
+                )>
+            T operator()(Rng1 && rng1, I2Ref && begin2, T init, BOp1 bop1 = BOp1{},
+                BOp2 bop2 = BOp2{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return (*this)(begin(rng1), end(rng1), std::forward<I2Ref>(begin2),
+                    std::move(init), std::move(bop1), std::move(bop2), std::move(proj1),
+                    std::move(proj2));
+            }
+
+            template<typename Rng1, typename Rng2, typename T, typename BOp1 = plus,
+                typename BOp2 = multiplies, typename P1 = ident, typename P2 = ident,
+                typename I1 = range_iterator_t<Rng1>,
+                typename I2 = range_iterator_t<Rng2>,
+                CONCEPT_REQUIRES_(
+                    Range<Rng1>() &&
+                    Range<Rng2>() &&
+                    TransformReduceable<I1, I2, T, BOp1, BOp2, P1, P2>()
+                )>
+            T operator()(Rng1 && rng1, Rng2 && rng2, T init, BOp1 bop1 = BOp1{},
+                BOp2 bop2 = BOp2{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return (*this)(begin(rng1), end(rng1), begin(rng2), end(rng2), std::move(init),
+                    std::move(bop1), std::move(bop2), std::move(proj1), std::move(proj2));
+            }
+
+            /// When `E` is a parallel policy and both ranges are random-access,
+            /// they are cut into contiguous pieces that are reduced concurrently.
+            template<typename E, typename I1, typename S1, typename I2, typename S2,
+                typename T, typename BOp1 = plus, typename BOp2 = multiplies,
+                typename P1 = ident, typename P2 = ident,
+                CONCEPT_REQUIRES_(
+                    ExecutionPolicy<E>() &&
+                    Sentinel<S1, I1>() &&
+                    Sentinel<S2, I2>() &&
+                    TransformReduceable<I1, I2, T, BOp1, BOp2, P1, P2>()
+                )>
+            T operator()(E &&, I1 begin1, S1 end1, I2 begin2, S2 end2, T init,
+                BOp1 bop1 = BOp1{}, BOp2 bop2 = BOp2{}, P1 proj1 = P1{},
+                P2 proj2 = P2{}) const
+            {
+                return transform_reduce_fn::impl(indexable<I1, I2>{}, parallel<E, I1, I2>{},
+                    std::move(begin1), std::move(end1), std::move(begin2), std::move(end2),
+                    std::move(init), bop1, bop2, proj1, proj2);
+            }
+
+            template<typename E, typename Rng1, typename Rng2, typename T,
+                typename BOp1 = plus, typename BOp2 = multiplies,
+                typename P1 = ident, typename P2 = ident,
+                typename I1 = range_iterator_t<Rng1>,
+                typename I2 = range_iterator_t<Rng2>,
+                CONCEPT_REQUIRES_(
+                    ExecutionPolicy<E>() &&
+                    Range<Rng1>() &&
+                    Range<Rng2>() &&
+                    TransformReduceable<I1, I2, T, BOp1, BOp2, P1, P2>()
+                )>
+            T operator()(E &&policy, Rng1 && rng1, Rng2 && rng2, T init, BOp1 bop1 = BOp1{},
+                BOp2 bop2 = BOp2{}, P1 proj1 = P1{}, P2 proj2 = P2{}) const
+            {
+                return (*this)(static_cast<E &&>(policy), begin(rng1), end(rng1), begin(rng2),
+                    end(rng2), std::move(init), std::move(bop1), std::move(bop2),
+                    std::move(proj1), std::move(proj2));
+            }
+        };
+
+        RANGES_INLINE_VARIABLE(with_braced_init_args<transform_reduce_fn>, transform_reduce)
+    }
+}
+
+#endif
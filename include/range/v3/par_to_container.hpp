@@ -0,0 +1,314 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_PAR_TO_CONTAINER_HPP
+#define RANGES_V3_PAR_TO_CONTAINER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/iterator_range.hpp>
+#include <range/v3/range_access.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/to_container.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/thread_pool.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/take_while.hpp>
+#include <range/v3/view/transform.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Calls a take_while predicate, and records when it first fails, so
+            // that the pieces after the one that stopped can be dropped.
+            template<typename Pred>
+            struct stop_recorder
+            {
+                Pred pred_;
+                bool *stopped_;
+
+                template<typename I>
+                bool operator()(I const &it)
+                {
+                    if(invoke(pred_, it))
+                        return true;
+                    *stopped_ = true;
+                    return false;
+                }
+            };
+
+            // How to rebuild a pipeline of views over the piece [lo, hi) of its
+            // source. Only views that apply their functions to one element at a
+            // time are rebuilt; any other range is the source, which must be
+            // sized and random-access.
+            template<typename Rng>
+            struct par_stage
+            {
+                using source_t = Rng;
+
+                template<typename D>
+                static iterator_range<range_iterator_t<Rng>>
+                rebase(Rng &rng, D lo, D hi, bool *)
+                {
+                    auto const first = ranges::begin(rng);
+                    using SD = range_difference_t<Rng>;
+                    return {first + static_cast<SD>(lo), first + static_cast<SD>(hi)};
+                }
+                static Rng &source(Rng &rng)
+                {
+                    return rng;
+                }
+            };
+
+            template<typename Rng, typename Fun>
+            struct par_stage<transform_view<Rng, Fun>>
+            {
+                using source_t = typename par_stage<Rng>::source_t;
+
+                template<typename D>
+                static auto rebase(transform_view<Rng, Fun> &rng, D lo, D hi, bool *stopped) ->
+                    iter_transform_view<
+                        decltype(par_stage<Rng>::rebase(rng.base(), lo, hi, stopped)),
+                        semiregular_t<indirected<Fun>>>
+                {
+                    iter_transform_view<Rng, indirected<Fun>> &base = rng;
+                    return {par_stage<Rng>::rebase(rng.base(), lo, hi, stopped),
+                        range_access::fun(base)};
+                }
+                static source_t &source(transform_view<Rng, Fun> &rng)
+                {
+                    return par_stage<Rng>::source(rng.base());
+                }
+            };
+
+            template<typename Rng, typename Pred>
+            struct par_stage<remove_if_view<Rng, Pred>>
+            {
+                using source_t = typename par_stage<Rng>::source_t;
+
+                template<typename D>
+                static auto rebase(remove_if_view<Rng, Pred> &rng, D lo, D hi, bool *stopped) ->
+                    remove_if_view<
+                        decltype(par_stage<Rng>::rebase(rng.base(), lo, hi, stopped)),
+                        semiregular_t<Pred>>
+                {
+                    return {par_stage<Rng>::rebase(rng.base(), lo, hi, stopped),
+                        range_access::pred(rng)};
+                }
+                static source_t &source(remove_if_view<Rng, Pred> &rng)
+                {
+                    return par_stage<Rng>::source(rng.base());
+                }
+            };
+
+            template<typename Rng, typename Pred>
+            struct par_stage<take_while_view<Rng, Pred>>
+            {
+                using source_t = typename par_stage<Rng>::source_t;
+
+                template<typename D>
+                static auto rebase(take_while_view<Rng, Pred> &rng, D lo, D hi, bool *stopped) ->
+                    iter_take_while_view<
+                        decltype(par_stage<Rng>::rebase(rng.base(), lo, hi, stopped)),
+                        stop_recorder<semiregular_t<indirected<Pred>>>>
+                {
+                    iter_take_while_view<Rng, indirected<Pred>> &base = rng;
+                    return {par_stage<Rng>::rebase(rng.base(), lo, hi, stopped),
+                        {range_access::pred(base), stopped}};
+                }
+                static source_t &source(take_while_view<Rng, Pred> &rng)
+                {
+                    return par_stage<Rng>::source(rng.base());
+                }
+            };
+
+            // Whether the containers of the pieces can be joined by inserting
+            // each at the end of the first, as for sequences, or, as for
+            // associative containers, by inserting it where its elements go.
+            template<typename C, typename I = std::move_iterator<range_iterator_t<C>>,
+                typename = void>
+            struct end_insertable_
+              : std::false_type
+            {};
+            template<typename C, typename I>
+            struct end_insertable_<C, I, meta::void_<decltype(std::declval<C &>().insert(
+                std::declval<C &>().end(), std::declval<I>(), std::declval<I>()))>>
+              : std::true_type
+            {};
+            template<typename C, typename I = std::move_iterator<range_iterator_t<C>>,
+                typename = void>
+            struct range_insertable_
+              : std::false_type
+            {};
+            template<typename C, typename I>
+            struct range_insertable_<C, I, meta::void_<decltype(std::declval<C &>().insert(
+                std::declval<I>(), std::declval<I>()))>>
+              : std::true_type
+            {};
+
+            template<typename Rng, typename Source = typename par_stage<Rng>::source_t>
+            using ParallelPipeline = meta::strict_and<
+                RandomAccessRange<Source>,
+                SizedRange<Source>>;
+
+            template<typename ContainerMetafunctionClass>
+            struct par_to_container_fn
+              : pipeable<par_to_container_fn<ContainerMetafunctionClass>>
+            {
+            private:
+                static constexpr std::ptrdiff_t parallel_grain() { return 4096; }
+
+                template<typename Rng,
+                    typename Cont = meta::invoke<ContainerMetafunctionClass, range_value_t<Rng>>>
+                static Cont impl(Rng &rng, std::false_type)
+                {
+                    return to_container_fn<ContainerMetafunctionClass>{}(rng);
+                }
+                template<typename Rng,
+                    typename Cont = meta::invoke<ContainerMetafunctionClass, range_value_t<Rng>>>
+                static Cont impl(Rng &rng, std::true_type)
+                {
+                    using D = range_difference_t<typename par_stage<Rng>::source_t>;
+                    D const n = static_cast<D>(ranges::size(par_stage<Rng>::source(rng)));
+                    D const chunks = detail::parallel_chunk_count(n,
+                        D(par_to_container_fn::parallel_grain()));
+                    if(n == 0)
+                        return Cont{};
+                    std::vector<Cont> parts(static_cast<std::size_t>(chunks));
+                    // One flag per piece, in separate chars so that the pieces
+                    // can set theirs concurrently.
+                    std::vector<char> stopped(static_cast<std::size_t>(chunks), 0);
+                    std::atomic<D> first_stop(chunks);
+                    detail::parallel_for_chunks(n, chunks, [&](D k, D lo, D hi)
+                    {
+                        // A take_while has already stopped in an earlier piece.
+                        if(first_stop.load(std::memory_order_relaxed) < k)
+                            return;
+                        auto const i = static_cast<std::size_t>(k);
+                        bool stop = false;
+                        auto piece = par_stage<Rng>::rebase(rng, lo, hi, &stop);
+                        parts[i] = to_container_fn<ContainerMetafunctionClass>{}(piece);
+                        if(stop)
+                        {
+                            stopped[i] = 1;
+                            D seen = first_stop.load(std::memory_order_relaxed);
+                            while(k < seen && !first_stop.compare_exchange_weak(seen, k))
+                                ;
+                        }
+                    });
+                    // Concatenate the pieces in order, up to the first that stopped.
+                    std::size_t last = 0;
+                    while(last + 1 < parts.size() && !stopped[last])
+                        ++last;
+                    std::size_t total = 0;
+                    for(std::size_t i = 0; i <= last; ++i)
+                        total += static_cast<std::size_t>(ranges::size(parts[i]));
+                    Cont c = std::move(parts[0]);
+                    par_to_container_fn::reserve(c, total, Reservable<Cont>());
+                    for(std::size_t i = 1; i <= last; ++i)
+                        par_to_container_fn::append(c, parts[i],
+                            meta::_t<end_insertable_<Cont>>{});
+                    return c;
+                }
+
+                template<typename C>
+                static void append(C &c, C &part, std::true_type)
+                {
+                    c.insert(c.end(), std::make_move_iterator(ranges::begin(part)),
+                        std::make_move_iterator(ranges::end(part)));
+                }
+                template<typename C>
+                static void append(C &c, C &part, std::false_type)
+                {
+                    c.insert(std::make_move_iterator(ranges::begin(part)),
+                        std::make_move_iterator(ranges::end(part)));
+                }
+
+                template<typename C>
+                static void reserve(C &, std::size_t, std::false_type)
+                {}
+                template<typename C>
+                static void reserve(C &c, std::size_t n, std::true_type)
+                {
+                    using size_type = decltype(c.size());
+                    c.reserve(static_cast<size_type>(n));
+                }
+
+            public:
+                /// Evaluates a pipeline of `view::transform`, `view::filter`,
+                /// `view::remove_if` and `view::take_while` over a sized,
+                /// random-access source on the thread pool: the source is cut
+                /// into pieces, the pipeline is rebuilt over each piece and
+                /// collected concurrently, and the pieces' containers are
+                /// joined in order. The functions of the views are copied
+                /// for each piece and may be called from several threads at
+                /// once. Any other range, or a container that cannot insert a
+                /// range of elements, is collected as by `to_`.
+                template<typename Rng,
+                    typename Cont = meta::invoke<ContainerMetafunctionClass, range_value_t<Rng>>,
+                    CONCEPT_REQUIRES_(Range<Rng>() && detail::ConvertibleToContainer<Rng, Cont>())>
+                Cont operator()(Rng && rng) const
+                {
+                    static_assert(!is_infinite<Rng>::value,
+                        "Attempt to convert an infinite range to a container.");
+                    return par_to_container_fn::impl(rng, meta::bool_<
+                        !std::is_const<meta::_t<std::remove_reference<Rng>>>::value &&
+                        ParallelPipeline<uncvref_t<Rng>>() &&
+                        (meta::_t<end_insertable_<Cont>>::value ||
+                            meta::_t<range_insertable_<Cont>>::value)>{});
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-core
+        /// @{
+
+        /// \ingroup group-core
+        RANGES_INLINE_VARIABLE(detail::par_to_container_fn<meta::quote<std::vector>>,
+                               par_to_vector)
+
+        /// \brief For initializing a container of the specified type with the
+        /// elements of a pipeline of views, evaluated on the thread pool
+        template<template<typename...> class ContT>
+        detail::par_to_container_fn<meta::quote<ContT>> par_to()
+        {
+            return {};
+        }
+
+        /// \overload
+        template<typename Cont>
+        detail::par_to_container_fn<meta::id<Cont>> par_to()
+        {
+            return {};
+        }
+
+        /// @}
+    }
+}
+
+#endif
@@ -271,6 +271,33 @@ namespace ranges
             (
                 pos.distance_to(other)
             )
+            template<typename Cur, typename Fun, typename S>
+            static RANGES_CXX14_CONSTEXPR auto for_each_segment(Cur & pos, Fun & fun, S const &end)
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                pos.for_each_segment(fun, end)
+            )
+            template<typename Cur, typename V, typename S>
+            static RANGES_CXX14_CONSTEXPR auto read_block(Cur & pos, V *out, std::ptrdiff_t n,
+                S const &end)
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                pos.read_block(out, n, end)
+            )
+            // The function object of a view that applies one to its elements, so
+            // that the view can be rebuilt over a piece of its underlying range.
+            template<typename Rng>
+            static auto fun(Rng & rng)
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                (rng.fun_)
+            )
+            template<typename Rng>
+            static auto pred(Rng & rng)
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                (rng.pred_)
+            )
 
         private:
             template<typename Cur>
@@ -434,6 +434,9 @@ namespace ranges
         template<typename T>
         using rvalue_reference_wrapper = reference_wrapper<T, true>;
 
+        template<typename...Ts>
+        struct soa_vector;
+
         // Views
         //
         template<typename Rng, typename Pred>
@@ -481,6 +484,14 @@ namespace ranges
             struct counted_fn;
         }
 
+        template<typename Rng>
+        struct csv_fields_view;
+
+        namespace view
+        {
+            struct csv_fields_fn;
+        }
+
         struct default_sentinel { };
 
         template<typename I, typename D = meta::_t<difference_type<I>>>
@@ -616,6 +627,9 @@ namespace ranges
         template<typename Rng, typename Fun>
         struct split_view;
 
+        template<typename Rng, typename Finder>
+        struct contiguous_split_view;
+
         namespace view
         {
             struct split_fn;
@@ -685,6 +699,14 @@ namespace ranges
             struct tokenize_fn;
         }
 
+        template<typename Rng, typename Class>
+        struct tokenize_chars_view;
+
+        namespace view
+        {
+            struct tokenize_chars_fn;
+        }
+
         template<typename Rng, typename Fun>
         struct iter_transform_view;
 
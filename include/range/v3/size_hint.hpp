@@ -0,0 +1,87 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_SIZE_HINT_HPP
+#define RANGES_V3_SIZE_HINT_HPP
+
+#include <type_traits>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng, typename = void>
+            struct has_size_hint_
+              : std::false_type
+            {};
+            template<typename Rng>
+            struct has_size_hint_<Rng, meta::void_<decltype(std::declval<Rng &>().size_hint())>>
+              : std::true_type
+            {};
+        }
+        /// \endcond
+
+        /// \addtogroup group-core
+        /// @{
+
+        /// An upper bound on the number of elements in a range, for reserving
+        /// storage: the size of a sized range, or else what the range's
+        /// `size_hint()` member returns. Views that drop elements, such as
+        /// `view::filter` and `view::take_while`, have a `size_hint()` that
+        /// is that of the range they adapt.
+        struct size_hint_fn
+        {
+            template<typename Rng, CONCEPT_REQUIRES_(SizedRange<Rng>())>
+            constexpr auto operator()(Rng && rng) const ->
+                decltype(ranges::size(rng))
+            {
+                return ranges::size(rng);
+            }
+            template<typename Rng,
+                CONCEPT_REQUIRES_(!SizedRange<Rng>() &&
+                    detail::has_size_hint_<meta::_t<std::remove_reference<Rng>>>())>
+            constexpr auto operator()(Rng && rng) const ->
+                decltype(rng.size_hint())
+            {
+                return rng.size_hint();
+            }
+        };
+
+        /// \ingroup group-core
+        /// \sa `size_hint_fn`
+        RANGES_INLINE_VARIABLE(size_hint_fn, size_hint)
+
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng>
+            using SizeHintedRange = meta::strict_or<
+                SizedRange<Rng>,
+                has_size_hint_<meta::_t<std::remove_reference<Rng>>>>;
+        }
+        /// \endcond
+        /// @}
+    }
+}
+
+#endif
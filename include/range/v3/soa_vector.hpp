@@ -0,0 +1,491 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_SOA_VECTOR_HPP
+#define RANGES_V3_SOA_VECTOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/iterator_range.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/span.hpp>
+#include <range/v3/algorithm/partition.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/algorithm/unique.hpp>
+#include <range/v3/utility/concepts.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/swap.hpp>
+#include <range/v3/view/zip.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-core
+        /// @{
+
+        /// A sequence of tuples stored as one `std::vector` per element of the
+        /// tuple, so that each column is contiguous. Its range is the `view::zip`
+        /// of the columns, and `column<N>()` is a `span` of the `N`th of them.
+        ///
+        /// `sort`, `stable_sort`, `partition` and `unique` (as members, and the
+        /// algorithms of the same name when passed a `soa_vector` lvalue) work
+        /// out where each element goes from a projection of the elements, then
+        /// move the columns into place one after the other, rather than swapping
+        /// whole tuples element by element. Should moving or swapping an element
+        /// throw, the columns already moved are reordered and the rest are not:
+        /// the `soa_vector` is left valid, but its elements are unspecified.
+        template<typename...Ts>
+        struct soa_vector
+        {
+        private:
+            CONCEPT_ASSERT_MSG(sizeof...(Ts) != 0,
+                "A soa_vector needs at least one column.");
+            CONCEPT_ASSERT_MSG(meta::and_c<!std::is_same<Ts, bool>::value...>(),
+                "The columns of a soa_vector are contiguous, so they cannot be of type "
+                "bool; use char instead.");
+
+            using columns_t = std::tuple<std::vector<Ts>...>;
+            using index_t = meta::make_index_sequence<sizeof...(Ts)>;
+            using zip_t = zip_view<iterator_range<Ts *>...>;
+            using const_zip_t = zip_view<iterator_range<Ts const *>...>;
+            using value_t = iterator_value_t<range_iterator_t<zip_t>>;
+
+            columns_t cols_;
+
+            template<std::size_t...Is>
+            zip_t zip_(meta::index_sequence<Is...>)
+            {
+                return zip_t{iterator_range<Ts *>{std::get<Is>(cols_).data(),
+                    std::get<Is>(cols_).data() + size()}...};
+            }
+            template<std::size_t...Is>
+            const_zip_t zip_(meta::index_sequence<Is...>) const
+            {
+                return const_zip_t{iterator_range<Ts const *>{std::get<Is>(cols_).data(),
+                    std::get<Is>(cols_).data() + size()}...};
+            }
+
+            template<typename Fun, std::size_t...Is>
+            void each_column_(Fun fun, meta::index_sequence<Is...>)
+            {
+                (void)std::initializer_list<int>{(fun(std::get<Is>(cols_)), 0)...};
+            }
+            template<typename Fun>
+            void each_column_(Fun fun)
+            {
+                soa_vector::each_column_(std::move(fun), index_t{});
+            }
+
+            template<std::size_t...Is, typename...Us>
+            void emplace_back_(meta::index_sequence<Is...>, Us &&...us)
+            {
+                auto const n = size();
+                try
+                {
+                    (void)std::initializer_list<int>{
+                        (std::get<Is>(cols_).emplace_back(static_cast<Us &&>(us)), 0)...};
+                }
+                catch(...)
+                {
+                    // Keep the columns the same length.
+                    soa_vector::each_column_(truncate_fn{n});
+                    throw;
+                }
+            }
+            template<std::size_t...Is, typename Tup>
+            void push_back_(meta::index_sequence<Is...>, Tup &&tup)
+            {
+                soa_vector::emplace_back_(index_t{},
+                    std::get<Is>(static_cast<Tup &&>(tup))...);
+            }
+
+            struct reserve_fn
+            {
+                std::size_t n;
+
+                template<typename T>
+                void operator()(std::vector<T> &col) const
+                {
+                    col.reserve(n);
+                }
+            };
+            struct resize_fn
+            {
+                std::size_t n;
+
+                template<typename T>
+                void operator()(std::vector<T> &col) const
+                {
+                    col.resize(n);
+                }
+            };
+            struct clear_fn
+            {
+                template<typename T>
+                void operator()(std::vector<T> &col) const noexcept
+                {
+                    col.clear();
+                }
+            };
+            struct pop_back_fn
+            {
+                template<typename T>
+                void operator()(std::vector<T> &col) const
+                {
+                    col.pop_back();
+                }
+            };
+            struct truncate_fn
+            {
+                std::size_t n;
+
+                template<typename T>
+                void operator()(std::vector<T> &col) const
+                {
+                    if(col.size() > n)
+                        col.erase(col.begin() + static_cast<std::ptrdiff_t>(n), col.end());
+                }
+            };
+            struct erase_fn
+            {
+                std::ptrdiff_t first, last;
+
+                template<typename T>
+                void operator()(std::vector<T> &col) const
+                {
+                    col.erase(col.begin() + first, col.begin() + last);
+                }
+            };
+            struct swap_fn
+            {
+                std::vector<std::pair<std::size_t, std::size_t>> const &swaps;
+
+                template<typename T>
+                void operator()(std::vector<T> &col) const
+                {
+                    for(auto const &s : swaps)
+                        ranges::swap(col[s.first], col[s.second]);
+                }
+            };
+            struct gather_fn
+            {
+                std::vector<std::size_t> const &order;
+
+                template<typename T>
+                void operator()(std::vector<T> &col) const
+                {
+                    // Should a move throw, col keeps its size, but the
+                    // elements already moved are left moved-from.
+                    std::vector<T> tmp;
+                    tmp.reserve(col.size());
+                    for(auto i : order)
+                        tmp.push_back(std::move(col[i]));
+                    col.swap(tmp);
+                }
+            };
+            struct compact_fn
+            {
+                std::vector<std::size_t> const &order;
+
+                template<typename T>
+                void operator()(std::vector<T> &col) const
+                {
+                    std::size_t k = 0;
+                    for(auto i : order)
+                    {
+                        if(i != k)
+                            col[k] = std::move(col[i]);
+                        ++k;
+                    }
+                }
+            };
+
+            // Make the kth element the one at order[k], for a permutation
+            // order of the indices.
+            void permute_(std::vector<std::size_t> const &order)
+            {
+                RANGES_EXPECT(order.size() == size());
+                std::size_t k = 0;
+                for(; k != order.size(); ++k)
+                    if(order[k] != k)
+                        break;
+                if(k != order.size())
+                    soa_vector::each_column_(gather_fn{order});
+            }
+
+            template<typename P>
+            using projected_key_t = detail::decay_t<result_of_t<P &(value_t &)>>;
+
+            // Integer keys of up to 32 bits in ascending order are packed with
+            // their indices into 64-bit words, which then sort by key and by
+            // index: a stable order, found by sorting plain integers.
+            template<typename C, typename P, typename K = projected_key_t<P>>
+            using packed_keys = meta::bool_<std::is_integral<K>::value && sizeof(K) <= 4 &&
+                (std::is_same<C, less>::value || std::is_same<C, ordered_less>::value)>;
+
+            template<typename Sort, typename C, typename P>
+            std::vector<std::size_t> sorted_order_(std::true_type, Sort const &sort, C &pred,
+                P &proj)
+            {
+                using K = projected_key_t<P>;
+                if(size() > 0xFFFFFFFFu)
+                    return soa_vector::sorted_order_(std::false_type{}, sort, pred, proj);
+                std::vector<std::uint64_t> words;
+                words.reserve(size());
+                std::uint64_t i = 0;
+                for(auto &&ref : *this)
+                {
+                    K const key = invoke(proj, ref);
+                    auto const biased = static_cast<std::uint64_t>(static_cast<std::int64_t>(key) -
+                        static_cast<std::int64_t>(std::numeric_limits<K>::min()));
+                    words.push_back(biased << 32 | i++);
+                }
+                ranges::sort(words);
+                std::vector<std::size_t> order;
+                order.reserve(words.size());
+                for(auto w : words)
+                    order.push_back(static_cast<std::size_t>(w & 0xFFFFFFFFu));
+                return order;
+            }
+            template<typename Sort, typename C, typename P>
+            std::vector<std::size_t> sorted_order_(std::false_type, Sort const &sort, C &pred,
+                P &proj)
+            {
+                // The keys are copied out next to their indices so that the
+                // sort compares and moves them in one contiguous array. They
+                // are the projections of values, as the projections of the
+                // references may refer into the columns.
+                using entry_t = std::pair<projected_key_t<P>, std::size_t>;
+                std::vector<entry_t> entries;
+                entries.reserve(size());
+                std::size_t i = 0;
+                for(auto &&ref : *this)
+                    entries.emplace_back(invoke(proj, ref), i++);
+                sort(entries, std::ref(pred), &entry_t::first);
+                std::vector<std::size_t> order;
+                order.reserve(entries.size());
+                for(auto const &entry : entries)
+                    order.push_back(entry.second);
+                return order;
+            }
+        public:
+            using value_type = value_t;
+            using reference = iterator_reference_t<range_iterator_t<zip_t>>;
+            using const_reference = iterator_reference_t<range_iterator_t<const_zip_t>>;
+            using iterator = range_iterator_t<zip_t>;
+            using const_iterator = range_iterator_t<const_zip_t>;
+            using size_type = std::size_t;
+            using difference_type = std::ptrdiff_t;
+
+            soa_vector() = default;
+            explicit soa_vector(size_type n)
+              : cols_(std::vector<Ts>(n)...)
+            {}
+            template<typename I, typename S,
+                CONCEPT_REQUIRES_(InputIterator<I>() && Sentinel<S, I>() &&
+                    Constructible<value_type, iterator_reference_t<I>>())>
+            soa_vector(I first, S last)
+            {
+                for(; first != last; ++first)
+                    push_back(value_type(*first));
+            }
+            soa_vector(std::initializer_list<value_type> il)
+            {
+                reserve(il.size());
+                for(auto const &val : il)
+                    push_back(val);
+            }
+
+            /// The `N`th column.
+            template<std::size_t N>
+            span<meta::at_c<meta::list<Ts...>, N>> column() noexcept
+            {
+                return {std::get<N>(cols_).data(), static_cast<std::ptrdiff_t>(size())};
+            }
+            /// \overload
+            template<std::size_t N>
+            span<meta::at_c<meta::list<Ts...>, N> const> column() const noexcept
+            {
+                return {std::get<N>(cols_).data(), static_cast<std::ptrdiff_t>(size())};
+            }
+
+            iterator begin()
+            {
+                return ranges::begin(soa_vector::zip_(index_t{}));
+            }
+            iterator end()
+            {
+                return ranges::end(soa_vector::zip_(index_t{}));
+            }
+            const_iterator begin() const
+            {
+                return ranges::begin(soa_vector::zip_(index_t{}));
+            }
+            const_iterator end() const
+            {
+                return ranges::end(soa_vector::zip_(index_t{}));
+            }
+
+            size_type size() const noexcept
+            {
+                return std::get<0>(cols_).size();
+            }
+            bool empty() const noexcept
+            {
+                return size() == 0;
+            }
+            reference operator[](size_type n)
+            {
+                RANGES_EXPECT(n < size());
+                return begin()[static_cast<difference_type>(n)];
+            }
+            const_reference operator[](size_type n) const
+            {
+                RANGES_EXPECT(n < size());
+                return begin()[static_cast<difference_type>(n)];
+            }
+
+            void reserve(size_type n)
+            {
+                soa_vector::each_column_(reserve_fn{n});
+            }
+            void resize(size_type n)
+            {
+                soa_vector::each_column_(resize_fn{n});
+            }
+            void clear() noexcept
+            {
+                soa_vector::each_column_(clear_fn{});
+            }
+
+            /// Appends an element made of one value for each column.
+            template<typename...Us,
+                CONCEPT_REQUIRES_(sizeof...(Us) == sizeof...(Ts) &&
+                    meta::and_<Constructible<Ts, Us &&>...>())>
+            void emplace_back(Us &&...us)
+            {
+                soa_vector::emplace_back_(index_t{}, static_cast<Us &&>(us)...);
+            }
+            void push_back(value_type const &val)
+            {
+                soa_vector::push_back_(index_t{}, val);
+            }
+            void push_back(value_type &&val)
+            {
+                soa_vector::push_back_(index_t{}, std::move(val));
+            }
+            void pop_back()
+            {
+                RANGES_EXPECT(!empty());
+                soa_vector::each_column_(pop_back_fn{});
+            }
+            iterator erase(iterator first, iterator last)
+            {
+                auto const origin = begin();
+                auto const b = first - origin;
+                soa_vector::each_column_(erase_fn{b, last - origin});
+                return begin() + b;
+            }
+
+            /// Sorts the elements by the keys `proj` gives them, copied out of
+            /// the columns. Returns `end()`.
+            template<typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(Sortable<iterator, C, P>())>
+            iterator sort(C pred = C{}, P proj = P{})
+            {
+                soa_vector::permute_(soa_vector::sorted_order_(packed_keys<C, P>{}, ranges::sort,
+                    pred, proj));
+                return end();
+            }
+            /// Like `sort`, but elements with equivalent keys keep their order.
+            template<typename C = ordered_less, typename P = ident,
+                CONCEPT_REQUIRES_(Sortable<iterator, C, P>())>
+            iterator stable_sort(C pred = C{}, P proj = P{})
+            {
+                soa_vector::permute_(soa_vector::sorted_order_(packed_keys<C, P>{},
+                    ranges::stable_sort, pred, proj));
+                return end();
+            }
+            /// Moves the elements that satisfy `pred` before those that do not.
+            /// Returns an iterator to the first of those that do not.
+            template<typename C, typename P = ident,
+                CONCEPT_REQUIRES_(Partitionable<iterator, C, P>())>
+            iterator partition(C pred, P proj = P{})
+            {
+                // The elements out of place are paired up from both ends, as
+                // by partition on a bidirectional range, and each column then
+                // swaps them in turn.
+                std::vector<std::pair<std::size_t, std::size_t>> swaps;
+                auto const first = begin();
+                auto test = [&](std::size_t i)
+                {
+                    return invoke(pred, invoke(proj, first[static_cast<difference_type>(i)]));
+                };
+                std::size_t lo = 0, hi = size();
+                while(true)
+                {
+                    while(lo != hi && test(lo))
+                        ++lo;
+                    if(lo == hi)
+                        break;
+                    do
+                        --hi;
+                    while(lo != hi && !test(hi));
+                    if(lo == hi)
+                        break;
+                    swaps.emplace_back(lo++, hi);
+                }
+                if(!swaps.empty())
+                    soa_vector::each_column_(swap_fn{swaps});
+                return begin() + static_cast<difference_type>(lo);
+            }
+            /// Removes all but the first of each run of consecutive elements
+            /// equivalent under `pred`, moving the ones kept to the front.
+            /// Returns the end of the ones kept; the elements past it are valid
+            /// but unspecified.
+            template<typename C = equal_to, typename P = ident,
+                CONCEPT_REQUIRES_(Sortable<iterator, C, P>())>
+            iterator unique(C pred = C{}, P proj = P{})
+            {
+                std::vector<std::size_t> kept;
+                auto const first = begin();
+                for(std::size_t i = 0, n = size(); i != n; ++i)
+                    if(kept.empty() || !invoke(pred,
+                        invoke(proj, first[static_cast<difference_type>(kept.back())]),
+                        invoke(proj, first[static_cast<difference_type>(i)])))
+                        kept.push_back(i);
+                if(kept.size() != size())
+                    soa_vector::each_column_(compact_fn{kept});
+                return begin() + static_cast<difference_type>(kept.size());
+            }
+        };
+        /// @}
+    }
+}
+
+#endif
@@ -14,12 +14,18 @@
 #ifndef RANGES_V3_TO_CONTAINER_HPP
 #define RANGES_V3_TO_CONTAINER_HPP
 
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
+#include <range/v3/size_hint.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/action/concepts.hpp>
+#include <range/v3/algorithm/aux_/blocks.hpp>
 
 #ifndef RANGES_NO_STD_FORWARD_DECLARATIONS
 // Non-portable forward declarations of standard containers
@@ -46,49 +52,162 @@ namespace ranges
                 ConvertibleTo<range_value_t<Rng>, range_value_t<Cont>>,
                 Constructible<Cont, I, I>>;
 
-            template<typename ContainerMetafunctionClass>
+            template<typename Alloc, typename T>
+            using rebind_alloc_t = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+
+            // ContT<V, Alloc rebound to V>, for containers whose second template
+            // parameter is the allocator.
+            template<template<typename...> class ContT, typename Alloc>
+            struct quote_with_allocator
+            {
+                template<typename V>
+                using invoke = ContT<V, rebind_alloc_t<Alloc, V>>;
+            };
+
+            // Makes the containers of to_container_fn: with a copy of an
+            // allocator, rebound to the container's value type, or without one.
+            template<typename Alloc>
+            struct container_allocator
+            {
+                Alloc alloc_;
+
+                template<typename Rng, typename Cont, typename I = range_common_iterator_t<Rng>,
+                    typename A = rebind_alloc_t<Alloc, range_value_t<Cont>>>
+                using Concept = meta::strict_and<
+                    Range<Cont>,
+                    meta::not_<View<Cont>>,
+                    Movable<Cont>,
+                    ConvertibleTo<range_value_t<Rng>, range_value_t<Cont>>,
+                    Constructible<Cont, I, I, A>,
+                    Constructible<Cont, A>>;
+
+                template<typename Cont, typename...Args>
+                Cont make(Args &&...args) const
+                {
+                    using A = rebind_alloc_t<Alloc, range_value_t<Cont>>;
+                    return Cont(std::forward<Args>(args)..., A(alloc_));
+                }
+            };
+            template<>
+            struct container_allocator<void>
+            {
+                template<typename Rng, typename Cont>
+                using Concept = ConvertibleToContainer<Rng, Cont>;
+
+                template<typename Cont, typename...Args>
+                Cont make(Args &&...args) const
+                {
+                    return Cont(std::forward<Args>(args)...);
+                }
+            };
+
+            template<typename C, typename V, typename = void>
+            struct block_insertable_
+              : std::false_type
+            {};
+            template<typename C, typename V>
+            struct block_insertable_<C, V, meta::void_<decltype(std::declval<C &>().insert(
+                std::declval<C &>().end(), std::declval<V *>(), std::declval<V *>()))>>
+              : std::true_type
+            {};
+
+            template<typename ContainerMetafunctionClass, typename Alloc = void>
             struct to_container_fn
-              : pipeable<to_container_fn<ContainerMetafunctionClass>>
+              : pipeable<to_container_fn<ContainerMetafunctionClass, Alloc>>
             {
             private:
+                container_allocator<Alloc> alloc_;
+
+                template<typename Rng, typename Cont>
+                using ConvertibleConcept =
+                    typename container_allocator<Alloc>::template Concept<Rng, Cont>;
+
                 template <typename C, typename R>
                 using ReserveConcept =
                     meta::strict_and<
                         ReserveAndAssignable<C, range_common_iterator_t<R>>,
-                        SizedRange<R>>;
+                        SizeHintedRange<R>>;
+
+                template <typename C, typename R>
+                using BlockConcept =
+                    meta::strict_and<
+                        block_copyable<range_iterator_t<R>, range_sentinel_t<R>>,
+                        Reservable<C>,
+                        meta::_t<block_insertable_<C, range_value_t<R>>>>;
 
                 template<typename Rng,
                     typename Cont = meta::invoke<ContainerMetafunctionClass, range_value_t<Rng>>,
-                    CONCEPT_REQUIRES_(Range<Rng>() && detail::ConvertibleToContainer<Rng, Cont>())>
+                    CONCEPT_REQUIRES_(Range<Rng>() &&
+                        ConvertibleConcept<Rng, Cont>())>
                 Cont impl(Rng && rng, std::false_type) const
                 {
                     using I = range_common_iterator_t<Rng>;
-                    return Cont(I{begin(rng)}, I{end(rng)});
+                    return alloc_.template make<Cont>(I{begin(rng)}, I{end(rng)});
                 }
 
                 template<typename Rng,
                     typename Cont = meta::invoke<ContainerMetafunctionClass, range_value_t<Rng>>,
-                    CONCEPT_REQUIRES_(Range<Rng>() && detail::ConvertibleToContainer<Rng, Cont>() &&
-                                      ReserveConcept<Cont, Rng>())>
+                    CONCEPT_REQUIRES_(Range<Rng>() &&
+                        ConvertibleConcept<Rng, Cont>() &&
+                        ReserveConcept<Cont, Rng>())>
                 Cont impl(Rng && rng, std::true_type) const
                 {
-                    Cont c;
+                    Cont c = alloc_.template make<Cont>();
                     using size_type = decltype(c.size());
-                    c.reserve(static_cast<size_type>(size(rng)));
+                    c.reserve(static_cast<size_type>(size_hint(rng)));
                     using I = range_common_iterator_t<Rng>;
                     c.assign(I{begin(rng)}, I{end(rng)});
                     return c;
                 }
 
+                template<typename C, typename Rng>
+                static void reserve(C &, Rng &, std::false_type)
+                {}
+                template<typename C, typename Rng>
+                static void reserve(C &c, Rng &rng, std::true_type)
+                {
+                    using size_type = decltype(c.size());
+                    c.reserve(static_cast<size_type>(size_hint(rng)));
+                }
+
+                template<typename Rng,
+                    typename Cont = meta::invoke<ContainerMetafunctionClass, range_value_t<Rng>>>
+                Cont blocks(Rng && rng, std::false_type) const
+                {
+                    return impl(std::forward<Rng>(rng), ReserveConcept<Cont, Rng>());
+                }
+                // Views that hand out blocks are appended a block at a time, so
+                // that the work of the views is done in a loop over each block.
+                template<typename Rng,
+                    typename Cont = meta::invoke<ContainerMetafunctionClass, range_value_t<Rng>>>
+                Cont blocks(Rng && rng, std::true_type) const
+                {
+                    Cont c = alloc_.template make<Cont>();
+                    to_container_fn::reserve(c, rng, SizeHintedRange<Rng>());
+                    range_value_t<Rng> buf[block_size()];
+                    auto it = begin(rng);
+                    auto const last = end(rng);
+                    while(std::ptrdiff_t const n = detail::read_block(it, last, buf, block_size()))
+                        c.insert(c.end(), buf, buf + n);
+                    return c;
+                }
+
             public:
+                to_container_fn() = default;
+                template<typename A, CONCEPT_REQUIRES_(Same<A, Alloc>())>
+                explicit to_container_fn(A alloc)
+                  : alloc_{std::move(alloc)}
+                {}
+
                 template<typename Rng,
                     typename Cont = meta::invoke<ContainerMetafunctionClass, range_value_t<Rng>>,
-                    CONCEPT_REQUIRES_(Range<Rng>() && detail::ConvertibleToContainer<Rng, Cont>())>
+                    CONCEPT_REQUIRES_(Range<Rng>() &&
+                        ConvertibleConcept<Rng, Cont>())>
                 Cont operator()(Rng && rng) const
                 {
                     static_assert(!is_infinite<Rng>::value,
                         "Attempt to convert an infinite range to a container.");
-                    return impl(std::forward<Rng>(rng), ReserveConcept<Cont, Rng>());
+                    return blocks(std::forward<Rng>(rng), BlockConcept<Cont, Rng>());
                 }
             };
         }
@@ -109,6 +228,17 @@ namespace ranges
             return {};
         }
 
+        /// \brief As above, but the container is given a copy of `alloc`,
+        /// rebound to its value type, as its second template argument
+        template<template<typename...> class ContT, typename Alloc,
+            CONCEPT_REQUIRES_(!Range<Alloc>())>
+        detail::to_container_fn<detail::quote_with_allocator<ContT, Alloc>, Alloc>
+        to_(Alloc alloc)
+        {
+            return detail::to_container_fn<detail::quote_with_allocator<ContT, Alloc>, Alloc>{
+                std::move(alloc)};
+        }
+
         /// \overload
         template<template<typename...> class ContT, typename Rng,
             typename Cont = meta::invoke<meta::quote<ContT>, range_value_t<Rng>>,
@@ -134,6 +264,15 @@ namespace ranges
             return {};
         }
 
+        /// \brief As above, but the container is constructed with a copy of
+        /// `alloc`, rebound to its value type
+        template<typename Cont, typename Alloc,
+            CONCEPT_REQUIRES_(!Range<Alloc>())>
+        detail::to_container_fn<meta::id<Cont>, Alloc> to_(Alloc alloc)
+        {
+            return detail::to_container_fn<meta::id<Cont>, Alloc>{std::move(alloc)};
+        }
+
         /// \overload
         template<typename Cont, typename Rng,
             CONCEPT_REQUIRES_(Range<Rng>() && detail::ConvertibleToContainer<Rng, Cont>())>
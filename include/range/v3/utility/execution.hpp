@@ -0,0 +1,92 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_EXECUTION_HPP
+#define RANGES_V3_UTILITY_EXECUTION_HPP
+
+#include <type_traits>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-utility
+        /// @{
+
+        /// Requests that an algorithm run sequentially on the calling thread.
+        struct sequenced_policy
+        {};
+
+        /// Permits an algorithm to run on the shared thread pool. Element access
+        /// functions may be invoked concurrently from several threads.
+        struct parallel_policy
+        {};
+
+        /// As `parallel_policy`, additionally permitting element access functions
+        /// to be interleaved on a single thread.
+        struct parallel_unsequenced_policy
+        {};
+
+        template<typename T>
+        struct is_execution_policy
+          : std::false_type
+        {};
+
+        template<>
+        struct is_execution_policy<sequenced_policy>
+          : std::true_type
+        {};
+
+        template<>
+        struct is_execution_policy<parallel_policy>
+          : std::true_type
+        {};
+
+        template<>
+        struct is_execution_policy<parallel_unsequenced_policy>
+          : std::true_type
+        {};
+
+        /// \ingroup group-concepts
+        template<typename E>
+        using ExecutionPolicy = meta::bool_<is_execution_policy<uncvref_t<E>>::value>;
+
+        /// \cond
+        namespace detail
+        {
+            // True when the algorithm should fork onto the thread pool: the
+            // caller asked for it and the iterators permit splitting in O(1).
+            template<typename E, typename I>
+            using parallelizable = meta::bool_<
+                !std::is_same<uncvref_t<E>, sequenced_policy>::value &&
+                RandomAccessIterator<I>::value>;
+        }
+        /// \endcond
+
+        /// \ingroup group-utility
+        RANGES_INLINE_VARIABLE(sequenced_policy, seq)
+
+        /// \ingroup group-utility
+        RANGES_INLINE_VARIABLE(parallel_policy, par)
+
+        /// \ingroup group-utility
+        RANGES_INLINE_VARIABLE(parallel_unsequenced_policy, par_unseq)
+        /// @}
+    }
+}
+
+#endif
@@ -19,6 +19,22 @@
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 
+#ifndef RANGES_NO_STD_FORWARD_DECLARATIONS
+// Non-portable forward declarations of standard library iterator wrappers
+#if defined(_LIBCPP_VERSION)
+RANGES_BEGIN_NAMESPACE_STD
+    template<class Iter>
+    class __wrap_iter;
+RANGES_END_NAMESPACE_STD
+#elif defined(__GLIBCXX__)
+namespace __gnu_cxx
+{
+    template<typename Iter, typename Container>
+    class __normal_iterator;
+}
+#endif
+#endif
+
 namespace ranges
 {
     inline namespace v3
@@ -66,6 +82,40 @@ namespace ranges
 
         template<typename I>
         using iterator_size = meta::defer<iterator_size_t, I>;
+
+        /// \cond
+        namespace detail
+        {
+            template<typename I>
+            struct is_contiguous_iterator_
+              : std::is_pointer<I>
+            {};
+
+#ifndef RANGES_NO_STD_FORWARD_DECLARATIONS
+#if defined(_LIBCPP_VERSION)
+            template<typename T>
+            struct is_contiguous_iterator_<std::__wrap_iter<T *>>
+              : std::true_type
+            {};
+#elif defined(__GLIBCXX__)
+            template<typename T, typename Container>
+            struct is_contiguous_iterator_<__gnu_cxx::__normal_iterator<T *, Container>>
+              : std::true_type
+            {};
+#endif
+#endif
+        }
+        /// \endcond
+
+        /// Whether the elements denoted by a valid range `[i, i + n)` occupy
+        /// contiguous storage, so that `std::addressof(*i) + k` addresses
+        /// `*(i + k)`. True for pointers and for the standard library's
+        /// `vector`, `array` and `basic_string` iterators; specialize it for
+        /// other contiguous iterator types.
+        template<typename I>
+        struct is_contiguous_iterator
+          : detail::is_contiguous_iterator_<I>
+        {};
         /// @}
     }
 }
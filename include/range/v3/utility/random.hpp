@@ -43,6 +43,7 @@
 #ifndef RANGES_V3_UTILITY_RANDOM_HPP
 #define RANGES_V3_UTILITY_RANDOM_HPP
 
+#include <climits>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -50,6 +51,7 @@
 #include <atomic>
 #include <chrono>
 #include <initializer_list>
+#include <limits>
 #include <mutex>
 #include <new>
 #include <random>
@@ -58,6 +60,9 @@
 #include <utility>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/algorithm/generate.hpp>
 #include <range/v3/utility/concepts.hpp>
@@ -111,11 +116,152 @@ namespace ranges
                             (uncvref_t<Gen>::min() < uncvref_t<Gen>::max())>())
                     ));
             };
+
+            // Only what the engines here ask of a seed sequence.
+            struct SeedSequence
+            {
+                template<typename Seq, typename I = std::array<std::uint32_t, 8>::iterator>
+                auto requires_(Seq && seq) -> decltype(
+                    concepts::valid_expr(
+                        ((void)seq.generate(std::declval<I>(), std::declval<I>()), 42)
+                    ));
+            };
         }
 
         template<typename Gen>
         using UniformRandomNumberGenerator =
             concepts::models<concepts::UniformRandomNumberGenerator, Gen>;
+
+        template<typename Seq>
+        using SeedSequence = concepts::models<concepts::SeedSequence, Seq>;
+        /// @}
+
+        /// \addtogroup group-utility
+        /// @{
+
+        /// A small, fast, non-cryptographic 64-bit engine: Blackman and Vigna's
+        /// xoshiro256** ("Scrambled Linear Pseudorandom Number Generators",
+        /// ACM TOMS 47(4), 2021). It has 32 bytes of state and a period of
+        /// 2^256 - 1, and passes BigCrush; it is not suitable where the
+        /// output must be unpredictable. Define `RANGES_DEFAULT_URNG_XOSHIRO256`
+        /// to make it the engine of the algorithms that are not given one.
+        class xoshiro256starstar
+        {
+            std::uint64_t s_[4];
+
+            static constexpr std::uint64_t rotl(std::uint64_t x, int k) noexcept
+            {
+                return (x << k) | (x >> (64 - k));
+            }
+            static std::uint64_t splitmix64(std::uint64_t &x) noexcept
+            {
+                std::uint64_t z = (x += 0x9e3779b97f4a7c15u);
+                z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9u;
+                z = (z ^ (z >> 27)) * 0x94d049bb133111ebu;
+                return z ^ (z >> 31);
+            }
+        public:
+            using result_type = std::uint64_t;
+
+            static constexpr result_type min() noexcept
+            {
+                return 0;
+            }
+            static constexpr result_type max() noexcept
+            {
+                return std::numeric_limits<result_type>::max();
+            }
+
+            xoshiro256starstar() noexcept
+              : xoshiro256starstar(result_type{0})
+            {}
+            /// The state is expanded from the seed with splitmix64, as the
+            /// authors recommend.
+            explicit xoshiro256starstar(result_type seed) noexcept
+            {
+                this->seed(seed);
+            }
+            template<typename SeedSeq,
+                CONCEPT_REQUIRES_(SeedSequence<SeedSeq &>())>
+            explicit xoshiro256starstar(SeedSeq &seq)
+            {
+                this->seed(seq);
+            }
+
+            void seed(result_type seed) noexcept
+            {
+                for(auto &s : s_)
+                    s = xoshiro256starstar::splitmix64(seed);
+            }
+            template<typename SeedSeq,
+                CONCEPT_REQUIRES_(SeedSequence<SeedSeq &>())>
+            void seed(SeedSeq &seq)
+            {
+                std::array<std::uint32_t, 8> words;
+                seq.generate(words.begin(), words.end());
+                for(std::size_t i = 0; i < 4; ++i)
+                    s_[i] = std::uint64_t{words[2 * i]} << 32 | words[2 * i + 1];
+                // The one state the engine cannot leave.
+                if((s_[0] | s_[1] | s_[2] | s_[3]) == 0)
+                    s_[0] = 1;
+            }
+
+            result_type operator()() noexcept
+            {
+                result_type const result = rotl(s_[1] * 5, 7) * 9;
+                std::uint64_t const t = s_[1] << 17;
+                s_[2] ^= s_[0];
+                s_[3] ^= s_[1];
+                s_[1] ^= s_[2];
+                s_[0] ^= s_[3];
+                s_[2] ^= t;
+                s_[3] = rotl(s_[3], 45);
+                return result;
+            }
+
+            void discard(unsigned long long z) noexcept
+            {
+                for(; z != 0; --z)
+                    (*this)();
+            }
+
+            /// Advances the engine by 2^128 draws, as if by `discard`: the
+            /// engine and its copies, jumped once, twice, ..., give that many
+            /// non-overlapping streams for parallel computations.
+            void jump() noexcept
+            {
+                static constexpr std::uint64_t coeffs[] = {
+                    0x180ec6d33cfd0abau, 0xd5a61266f0c9392cu,
+                    0xa9582618e03fc9aau, 0x39abdc4529b1661cu};
+                std::uint64_t t[4] = {0, 0, 0, 0};
+                for(std::uint64_t c : coeffs)
+                {
+                    for(int b = 0; b < 64; ++b)
+                    {
+                        if(c & (std::uint64_t{1} << b))
+                        {
+                            for(std::size_t i = 0; i < 4; ++i)
+                                t[i] ^= s_[i];
+                        }
+                        (*this)();
+                    }
+                }
+                for(std::size_t i = 0; i < 4; ++i)
+                    s_[i] = t[i];
+            }
+
+            friend bool operator==(xoshiro256starstar const &x,
+                xoshiro256starstar const &y) noexcept
+            {
+                return x.s_[0] == y.s_[0] && x.s_[1] == y.s_[1] &&
+                    x.s_[2] == y.s_[2] && x.s_[3] == y.s_[3];
+            }
+            friend bool operator!=(xoshiro256starstar const &x,
+                xoshiro256starstar const &y) noexcept
+            {
+                return !(x == y);
+            }
+        };
         /// @}
 
         /// \cond
@@ -514,8 +660,174 @@ namespace ranges
                 using auto_seed_256 = auto_seeded<seed_seq_fe256>;
             }
 
+            // The number of random bits in each result of an engine whose results
+            // are all the 32- or 64-bit words, or 0 for any other engine.
+            template<typename Gen, typename G = uncvref_t<Gen>>
+            using engine_word_bits = meta::size_t<
+                G::min() != 0 ? 0 :
+                G::max() == std::numeric_limits<std::uint64_t>::max() ? 64 :
+                G::max() == std::numeric_limits<std::uint32_t>::max() ? 32 : 0>;
+
+            template<typename Gen>
+            std::uint32_t random_bits_(Gen &gen, meta::id<std::uint32_t>, meta::size_t<64>)
+            {
+                // The high half, which is the better one of some engines.
+                return static_cast<std::uint32_t>(static_cast<std::uint64_t>(gen()) >> 32);
+            }
+            template<typename Gen>
+            std::uint32_t random_bits_(Gen &gen, meta::id<std::uint32_t>, meta::size_t<32>)
+            {
+                return static_cast<std::uint32_t>(gen());
+            }
+            template<typename Gen>
+            std::uint64_t random_bits_(Gen &gen, meta::id<std::uint64_t>, meta::size_t<64>)
+            {
+                return static_cast<std::uint64_t>(gen());
+            }
+            template<typename Gen>
+            std::uint64_t random_bits_(Gen &gen, meta::id<std::uint64_t>, meta::size_t<32>)
+            {
+                std::uint64_t const hi = static_cast<std::uint32_t>(gen());
+                return hi << 32 | static_cast<std::uint32_t>(gen());
+            }
+            template<typename UInt, typename Gen>
+            UInt random_bits_(Gen &gen, meta::id<UInt>, meta::size_t<0>)
+            {
+                return std::uniform_int_distribution<UInt>{}(gen);
+            }
+
+            // A uniformly random 32- or 64-bit word: the results of an engine
+            // whose results are words, and otherwise a draw of
+            // std::uniform_int_distribution.
+            template<typename UInt, typename Gen>
+            UInt random_bits(Gen &gen)
+            {
+                static_assert(std::is_same<UInt, std::uint32_t>::value ||
+                    std::is_same<UInt, std::uint64_t>::value,
+                    "random_bits draws 32- or 64-bit words");
+                return detail::random_bits_(gen, meta::id<UInt>{}, engine_word_bits<Gen>{});
+            }
+
+            // The high and low words of the 128-bit product of x and y.
+#ifdef __SIZEOF_INT128__
+            inline std::uint64_t mul_64x64(std::uint64_t x, std::uint64_t y,
+                std::uint64_t &lo) noexcept
+            {
+                __extension__ using uint128_t = unsigned __int128;
+                uint128_t const p = static_cast<uint128_t>(x) * y;
+                lo = static_cast<std::uint64_t>(p);
+                return static_cast<std::uint64_t>(p >> 64);
+            }
+#else
+            inline std::uint64_t mul_64x64(std::uint64_t x, std::uint64_t y,
+                std::uint64_t &lo) noexcept
+            {
+                std::uint64_t const mask = 0xffffffffu;
+                std::uint64_t const x0 = x & mask, x1 = x >> 32;
+                std::uint64_t const y0 = y & mask, y1 = y >> 32;
+                std::uint64_t const p00 = x0 * y0, p01 = x0 * y1;
+                std::uint64_t const p10 = x1 * y0, p11 = x1 * y1;
+                std::uint64_t const mid = (p00 >> 32) + (p01 & mask) + (p10 & mask);
+                lo = (mid << 32) | (p00 & mask);
+                return p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+            }
+#endif
+
+            // A uniformly random integer in [0, bound), with Lemire's nearly
+            // divisionless method (D. Lemire, "Fast Random Integer Generation in
+            // an Interval", ACM TOMCS 29(1), 2019): the high word of the product
+            // of a random word and the bound, rejected only when the low word
+            // falls in the bound's short last interval. Unlike
+            // std::uniform_int_distribution, it divides only when the low word
+            // is less than the bound. Words is a nullary callable returning
+            // uniformly random std::uint64_ts.
+            template<typename Words>
+            std::uint64_t bounded_random_words(Words &words, std::uint64_t bound)
+            {
+                RANGES_EXPECT(bound > 0);
+                std::uint64_t lo;
+                std::uint64_t hi = detail::mul_64x64(words(), bound, lo);
+                if(lo < bound)
+                {
+                    std::uint64_t const threshold = (0 - bound) % bound;
+                    while(lo < threshold)
+                        hi = detail::mul_64x64(words(), bound, lo);
+                }
+                return hi;
+            }
+
+            // Two independent uniformly random integers in [0, bound0) and
+            // [0, bound1) from one random word, as long as the product of the
+            // bounds fits in one (N. Brackett-Rozinsky and D. Lemire, "Batched
+            // Ranged Random Integer Generation", SPE 55(1), 2025).
+            template<typename Words>
+            void bounded_random_words(Words &words, std::uint64_t bound0,
+                std::uint64_t bound1, std::uint64_t &r0, std::uint64_t &r1)
+            {
+                RANGES_EXPECT(bound0 > 0 && bound1 > 0);
+                RANGES_EXPECT(bound0 <= std::numeric_limits<std::uint64_t>::max() / bound1);
+                std::uint64_t const product = bound0 * bound1;
+                std::uint64_t lo;
+                r0 = detail::mul_64x64(words(), bound0, lo);
+                r1 = detail::mul_64x64(lo, bound1, lo);
+                if(lo < product)
+                {
+                    std::uint64_t const threshold = (0 - product) % product;
+                    while(lo < threshold)
+                    {
+                        r0 = detail::mul_64x64(words(), bound0, lo);
+                        r1 = detail::mul_64x64(lo, bound1, lo);
+                    }
+                }
+            }
+
+            template<typename Gen>
+            struct random_words
+            {
+                Gen &gen;
+                std::uint64_t operator()()
+                {
+                    return detail::random_bits<std::uint64_t>(gen);
+                }
+            };
+
+            template<typename Gen>
+            std::uint64_t bounded_random_(Gen &gen, std::uint64_t bound, meta::size_t<64>)
+            {
+                random_words<Gen> words{gen};
+                return detail::bounded_random_words(words, bound);
+            }
+            template<typename Gen, std::size_t Bits>
+            std::uint64_t bounded_random_(Gen &gen, std::uint64_t bound, meta::size_t<Bits>)
+            {
+                // One 32-bit word is enough for most bounds.
+                std::uint64_t const words32 = std::uint64_t{1} << 32;
+                if(bound > words32)
+                    return detail::bounded_random_(gen, bound, meta::size_t<64>{});
+                RANGES_EXPECT(bound > 0);
+                std::uint64_t p = detail::random_bits<std::uint32_t>(gen) * bound;
+                if((p & 0xffffffffu) < bound)
+                {
+                    std::uint64_t const threshold = (words32 - bound) % bound;
+                    while((p & 0xffffffffu) < threshold)
+                        p = detail::random_bits<std::uint32_t>(gen) * bound;
+                }
+                return p >> 32;
+            }
+
+            // A uniformly random integer in [0, bound) from gen.
+            template<typename Gen>
+            std::uint64_t bounded_random(Gen &gen, std::uint64_t bound)
+            {
+                return detail::bounded_random_(gen, bound, engine_word_bits<Gen>{});
+            }
+
             using default_URNG =
+#ifdef RANGES_DEFAULT_URNG_XOSHIRO256
+                xoshiro256starstar;
+#else
                 meta::if_c<(sizeof(void*) >= 8), std::mt19937_64, std::mt19937>;
+#endif
 
 #if !RANGES_CXX_THREAD_LOCAL
             template<typename URNG>
@@ -571,6 +883,50 @@ namespace ranges
             }
         }
         /// \endcond
+
+        /// \addtogroup group-utility
+        /// @{
+        struct fill_random_fn
+        {
+            /// Fills the range with uniformly random unsigned integers, drawn
+            /// as whole words of the engine's results rather than with
+            /// `std::uniform_int_distribution`: one result of a 64-bit engine,
+            /// or one or two of a 32-bit engine, per element.
+            template<typename I, typename S, typename Gen = detail::default_random_engine&,
+                CONCEPT_REQUIRES_(ForwardIterator<I>() && Sentinel<S, I>() &&
+                    UnsignedIntegral<iterator_value_t<I>>() &&
+                    Writable<I, iterator_value_t<I>>() &&
+                    UniformRandomNumberGenerator<Gen>())>
+            I operator()(I first, S last, Gen && gen = detail::get_random_engine()) const
+            {
+                using T = iterator_value_t<I>;
+                static_assert(sizeof(T) <= 8, "fill_random fills integers of up to 64 bits");
+                using W = meta::if_c<(sizeof(T) > 4), std::uint64_t, std::uint32_t>;
+                // The high bits of each word, which are the better ones of some
+                // engines.
+                constexpr int shift = (sizeof(W) - sizeof(T)) * CHAR_BIT;
+                for(; first != last; ++first)
+                    *first = static_cast<T>(detail::random_bits<W>(gen) >> shift);
+                return first;
+            }
+
+            template<typename Rng, typename Gen = detail::default_random_engine&,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(ForwardRange<Rng>() &&
+                    UnsignedIntegral<iterator_value_t<I>>() &&
+                    Writable<I, iterator_value_t<I>>() &&
+                    UniformRandomNumberGenerator<Gen>())>
+            range_safe_iterator_t<Rng>
+            operator()(Rng && rng, Gen && gen = detail::get_random_engine()) const
+            {
+                return (*this)(begin(rng), end(rng), std::forward<Gen>(gen));
+            }
+        };
+
+        /// \sa `fill_random_fn`
+        /// \ingroup group-utility
+        RANGES_INLINE_VARIABLE(fill_random_fn, fill_random)
+        /// @}
     }
 }
 
@@ -0,0 +1,357 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_UTILITY_THREAD_POOL_HPP
+#define RANGES_V3_UTILITY_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <range/v3/range_fwd.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // A fixed-size pool of worker threads. Each worker owns a task deque;
+            // it pops from the back of its own deque and steals from the front of
+            // the others' when it runs dry. Threads that are not workers (and
+            // workers that are blocked in a fork-join) help out by calling
+            // try_run_one, so nested parallelism cannot deadlock the pool.
+            struct thread_pool
+            {
+            private:
+                struct task_queue
+                {
+                    std::mutex mtx;
+                    std::deque<std::function<void()>> tasks;
+                };
+
+                std::vector<std::unique_ptr<task_queue>> queues_;
+                std::vector<std::thread> workers_;
+                std::mutex mtx_;
+                std::condition_variable cv_;
+                std::atomic<std::size_t> pending_;
+                std::atomic<std::size_t> next_;
+                bool done_;
+
+                // The pool and index of the worker running on this thread, set
+                // when the worker starts.
+                struct worker_id
+                {
+                    thread_pool const *pool;
+                    std::size_t index;
+                };
+#if RANGES_CXX_THREAD_LOCAL
+                static worker_id &current_worker()
+                {
+#if RANGES_CXX_THREAD_LOCAL >= RANGES_CXX_THREAD_LOCAL_11
+                    static thread_local worker_id id{nullptr, 0};
+#else
+                    static __thread worker_id id = {nullptr, 0};
+#endif
+                    return id;
+                }
+                std::size_t this_worker() const
+                {
+                    worker_id const &id = current_worker();
+                    return id.pool == this ? id.index : workers_.size();
+                }
+#else
+                std::size_t this_worker() const
+                {
+                    auto const id = std::this_thread::get_id();
+                    for(std::size_t i = 0; i < workers_.size(); ++i)
+                        if(workers_[i].get_id() == id)
+                            return i;
+                    return workers_.size();
+                }
+#endif
+                bool pop(std::size_t i, bool back, std::function<void()> &task)
+                {
+                    task_queue &q = *queues_[i];
+                    std::lock_guard<std::mutex> lk{q.mtx};
+                    if(q.tasks.empty())
+                        return false;
+                    if(back)
+                    {
+                        task = std::move(q.tasks.back());
+                        q.tasks.pop_back();
+                    }
+                    else
+                    {
+                        task = std::move(q.tasks.front());
+                        q.tasks.pop_front();
+                    }
+                    pending_.fetch_sub(1, std::memory_order_relaxed);
+                    return true;
+                }
+                bool try_run_one(std::size_t self)
+                {
+                    std::function<void()> task;
+                    std::size_t const n = queues_.size();
+                    bool found = self < n && pop(self, true, task);
+                    for(std::size_t i = 1; !found && i <= n; ++i)
+                        found = pop((self + i) % n, false, task);
+                    if(found)
+                        task();
+                    return found;
+                }
+                void work(std::size_t self)
+                {
+                    // Wait for the constructor to finish populating workers_.
+                    { std::lock_guard<std::mutex> lk{mtx_}; }
+#if RANGES_CXX_THREAD_LOCAL
+                    current_worker() = worker_id{this, self};
+#endif
+                    while(true)
+                    {
+                        if(try_run_one(self))
+                            continue;
+                        std::unique_lock<std::mutex> lk{mtx_};
+                        cv_.wait(lk, [this]{
+                            return done_ || pending_.load(std::memory_order_relaxed) != 0;
+                        });
+                        if(done_)
+                            return;
+                    }
+                }
+            public:
+                static std::size_t default_concurrency()
+                {
+                    // The calling thread participates in every fork-join, so one
+                    // fewer worker than there are hardware threads keeps every
+                    // core busy without oversubscribing.
+                    std::size_t const n = std::thread::hardware_concurrency();
+                    return n > 1 ? n - 1 : 1;
+                }
+
+                explicit thread_pool(std::size_t n = thread_pool::default_concurrency())
+                  : pending_(0), next_(0), done_(false)
+                {
+                    n = n ? n : 1;
+                    queues_.reserve(n);
+                    workers_.reserve(n);
+                    std::lock_guard<std::mutex> lk{mtx_};
+                    for(std::size_t i = 0; i < n; ++i)
+                        queues_.emplace_back(new task_queue);
+                    for(std::size_t i = 0; i < n; ++i)
+                        workers_.emplace_back(&thread_pool::work, this, i);
+                }
+                thread_pool(thread_pool const &) = delete;
+                thread_pool &operator=(thread_pool const &) = delete;
+                ~thread_pool()
+                {
+                    {
+                        std::lock_guard<std::mutex> lk{mtx_};
+                        done_ = true;
+                    }
+                    cv_.notify_all();
+                    for(auto &t : workers_)
+                        t.join();
+                }
+
+                /// The number of worker threads, not counting callers that help.
+                std::size_t size() const
+                {
+                    return workers_.size();
+                }
+
+                /// Queue a task. Workers push onto their own deque; other threads
+                /// distribute their tasks round-robin.
+                void submit(std::function<void()> task)
+                {
+                    std::size_t i = this_worker();
+                    if(i == workers_.size())
+                        i = next_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+                    {
+                        // Count the task under the lock so a worker about to
+                        // sleep cannot miss it, and before it becomes visible so
+                        // the count never underflows.
+                        std::lock_guard<std::mutex> lk{mtx_};
+                        pending_.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    {
+                        task_queue &q = *queues_[i];
+                        std::lock_guard<std::mutex> lk{q.mtx};
+                        q.tasks.push_back(std::move(task));
+                    }
+                    cv_.notify_one();
+                }
+
+                /// Run one queued task on the calling thread, if there is one.
+                bool try_run_one()
+                {
+                    return try_run_one(this_worker());
+                }
+
+                /// Block until `ready()` holds or there is a task to run. Whoever
+                /// makes `ready()` hold must then call notify_all.
+                template<typename Pred>
+                void wait_for_work(Pred ready)
+                {
+                    std::unique_lock<std::mutex> lk{mtx_};
+                    cv_.wait(lk, [&]{
+                        return ready() || pending_.load(std::memory_order_relaxed) != 0;
+                    });
+                }
+
+                /// Wake the threads blocked in wait_for_work, and the idle
+                /// workers.
+                void notify_all()
+                {
+                    // Taking the lock orders this after a waiter's last look at
+                    // its predicate, so the wakeup cannot be missed.
+                    { std::lock_guard<std::mutex> lk{mtx_}; }
+                    cv_.notify_all();
+                }
+            };
+
+            /// The pool used by the parallel algorithms. It is created on first
+            /// use and lives until program exit.
+            inline thread_pool &default_thread_pool()
+            {
+                static thread_pool pool;
+                return pool;
+            }
+
+            // A set of tasks that can be waited on as a unit. While waiting, the
+            // calling thread executes queued tasks, and blocks only when there
+            // are none. The first exception thrown by a task is rethrown from
+            // wait().
+            struct task_group
+            {
+            private:
+                thread_pool &pool_;
+                std::atomic<std::size_t> count_;
+                std::mutex mtx_;
+                std::exception_ptr error_;
+
+                bool done() const
+                {
+                    return count_.load(std::memory_order_acquire) == 0;
+                }
+                void join()
+                {
+                    while(!done())
+                        if(!pool_.try_run_one())
+                            pool_.wait_for_work([this]{ return done(); });
+                }
+            public:
+                explicit task_group(thread_pool &pool = default_thread_pool())
+                  : pool_(pool), count_(0)
+                {}
+                task_group(task_group const &) = delete;
+                task_group &operator=(task_group const &) = delete;
+                ~task_group()
+                {
+                    join();
+                }
+                template<typename F>
+                void run(F fun)
+                {
+                    count_.fetch_add(1, std::memory_order_relaxed);
+                    pool_.submit([this, fun]() mutable {
+                        try
+                        {
+                            fun();
+                        }
+                        catch(...)
+                        {
+                            std::lock_guard<std::mutex> lk{mtx_};
+                            if(!error_)
+                                error_ = std::current_exception();
+                        }
+                        // Must be the last access to *this; wait() may return
+                        // and destroy the group as soon as the count hits zero.
+                        thread_pool &pool = pool_;
+                        if(count_.fetch_sub(1, std::memory_order_release) == 1)
+                            pool.notify_all();
+                    });
+                }
+                void wait()
+                {
+                    join();
+                    if(error_)
+                    {
+                        std::exception_ptr e = error_;
+                        error_ = nullptr;
+                        std::rethrow_exception(e);
+                    }
+                }
+            };
+
+            /// Evaluate `f()` and `g()`, possibly concurrently, and return when
+            /// both have finished.
+            template<typename F, typename G>
+            void fork_join(F &&f, G &&g)
+            {
+                task_group group;
+                group.run(std::ref(g));
+                f();
+                group.wait();
+            }
+
+            /// How many pieces to cut `n` elements into so that each piece has
+            /// at least `grain` elements and every thread has a few to steal.
+            template<typename D>
+            D parallel_chunk_count(D n, D grain)
+            {
+                D const max_chunks = static_cast<D>(4 * (default_thread_pool().size() + 1));
+                D const chunks = grain > 0 ? n / grain : n;
+                return chunks < 1 ? D(1) : (chunks < max_chunks ? chunks : max_chunks);
+            }
+
+            /// Like parallel_chunk_count, but from `n` and `grain` alone, for the
+            /// algorithms whose results depend on where the pieces fall, such
+            /// as floating-point reductions: they then come out the same on
+            /// every machine.
+            template<typename D>
+            D fixed_chunk_count(D n, D grain)
+            {
+                D const max_chunks = D(64);
+                D const chunks = grain > 0 ? n / grain : n;
+                return chunks < 1 ? D(1) : (chunks < max_chunks ? chunks : max_chunks);
+            }
+
+            /// Split [0, n) into `chunks` contiguous pieces of nearly equal size
+            /// and call `fun(k, lo, hi)` for each piece `k`, using the default
+            /// thread pool. Returns when all pieces are done.
+            template<typename D, typename F>
+            void parallel_for_chunks(D n, D chunks, F &&fun)
+            {
+                D const q = n / chunks, r = n % chunks;
+                auto lo = [=](D k) { return k * q + (k < r ? k : r); };
+                task_group group;
+                for(D k = 1; k < chunks; ++k)
+                    group.run([&fun, k, lo]{ fun(k, lo(k), lo(k + 1)); });
+                fun(D(0), lo(0), lo(1));
+                group.wait();
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
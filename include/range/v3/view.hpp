@@ -26,6 +26,7 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/view/concat.hpp>
 #include <range/v3/view/const.hpp>
 #include <range/v3/view/counted.hpp>
+#include <range/v3/view/csv_fields.hpp>
 #include <range/v3/view/chunk.hpp>
 #include <range/v3/view/cycle.hpp>
 #include <range/v3/view/delimit.hpp>
@@ -42,6 +43,7 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/view/intersperse.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/join.hpp>
+#include <range/v3/view/lines.hpp>
 #include <range/v3/view/map.hpp>
 #include <range/v3/view/move.hpp>
 #include <range/v3/view/partial_sum.hpp>
@@ -64,6 +66,7 @@ RANGES_DISABLE_WARNINGS
 #include <range/v3/view/take_while.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/view/tokenize.hpp>
+#include <range/v3/view/tokenize_chars.hpp>
 #include <range/v3/view/unbounded.hpp>
 #include <range/v3/view/unique.hpp>
 #include <range/v3/view/zip_with.hpp>
@@ -14,9 +14,11 @@
 #ifndef RANGES_V3_VIEW_ANY_VIEW_HPP
 #define RANGES_V3_VIEW_ANY_VIEW_HPP
 
+#include <cstddef>
 #include <memory>
-#include <utility>
+#include <new>
 #include <type_traits>
+#include <utility>
 #include <range/v3/detail/satisfy_boost_range.hpp>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
@@ -24,7 +26,7 @@
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/view_facade.hpp>
 #include <range/v3/view/all.hpp>
-#include <range/v3/utility/polymorphic_cast.hpp>
+#include <range/v3/utility/compressed_pair.hpp>
 
 namespace ranges
 {
@@ -41,169 +43,374 @@ namespace ranges
         /// \cond
         namespace detail
         {
-            struct any_object
+            // Erased objects no bigger than this (four pointers: an iterator
+            // range over a pair of pointers, say), no more aligned than a
+            // pointer and nothrow-movable are stored inline; others live on the
+            // heap.
+            constexpr std::size_t any_buffer_size = 4 * sizeof(void *);
+
+            using any_buffer =
+                meta::_t<std::aligned_storage<any_buffer_size, alignof(void *)>>;
+
+            template<typename T>
+            using any_fits_inline = meta::bool_<
+                sizeof(T) <= sizeof(any_buffer) &&
+                alignof(T) <= alignof(any_buffer) &&
+                std::is_nothrow_move_constructible<T>::value>;
+
+            // Whether the iterators of a range cannot refer into the range
+            // itself, so that it can be stored inline, and relocated when its
+            // any_view is moved, without invalidating them. Only the ranges
+            // that are no more than a pair of iterators are known to be.
+            template<typename Rng>
+            struct any_relocatable_range
+              : std::false_type
+            {};
+            template<typename I, typename S>
+            struct any_relocatable_range<iterator_range<I, S>>
+              : std::true_type
+            {};
+            template<typename I, typename S>
+            struct any_relocatable_range<sized_iterator_range<I, S>>
+              : std::true_type
+            {};
+
+            // How an erased T is created, accessed, copied, moved and destroyed
+            // inside an any_buffer.
+            template<typename T, typename Alloc, bool Inline = any_fits_inline<T>::value>
+            struct any_handler
             {
-                virtual ~any_object() = default;
+                template<typename... Args>
+                static void create(any_buffer &b, Alloc const &, Args &&... args)
+                {
+                    ::new(static_cast<void *>(&b)) T(static_cast<Args &&>(args)...);
+                }
+                static T &get(any_buffer &b)
+                {
+                    return *static_cast<T *>(static_cast<void *>(&b));
+                }
+                static T const &get(any_buffer const &b)
+                {
+                    return *static_cast<T const *>(static_cast<void const *>(&b));
+                }
+                static void destroy(any_buffer &b)
+                {
+                    get(b).~T();
+                }
+                static void copy(any_buffer &to, any_buffer const &from)
+                {
+                    ::new(static_cast<void *>(&to)) T(get(from));
+                }
+                static void move(any_buffer &to, any_buffer &from)
+                {
+                    ::new(static_cast<void *>(&to)) T(std::move(get(from)));
+                    get(from).~T();
+                }
             };
 
-            template<class T>
-            struct object : any_object
+            // Objects that do not fit inline are allocated with (a rebound copy
+            // of) Alloc, which is kept with the object so that copies can be
+            // allocated and the storage freed the same way.
+            template<typename T, typename Alloc>
+            struct any_handler<T, Alloc, false>
             {
             private:
-                T obj;
+                struct node
+                {
+                    Alloc alloc;
+                    T obj;
+                    template<typename... Args>
+                    node(Alloc const &a, Args &&... args)
+                      : alloc(a), obj(static_cast<Args &&>(args)...)
+                    {}
+                };
+                using node_alloc =
+                    typename std::allocator_traits<Alloc>::template rebind_alloc<node>;
+                using node_traits = std::allocator_traits<node_alloc>;
+                using node_pointer = typename node_traits::pointer;
+
+                static node *ptr(any_buffer const &b)
+                {
+                    return *static_cast<node * const *>(static_cast<void const *>(&b));
+                }
             public:
-                object() = default;
-                object(T o) : obj(std::move(o)) {}
-                T &get() { return obj; }
-                T const &get() const { return obj; }
+                template<typename... Args>
+                static void create(any_buffer &b, Alloc const &alloc, Args &&... args)
+                {
+                    node_alloc a(alloc);
+                    node_pointer p = node_traits::allocate(a, 1);
+                    try
+                    {
+                        ::new(static_cast<void *>(std::addressof(*p)))
+                            node(alloc, static_cast<Args &&>(args)...);
+                    }
+                    catch(...)
+                    {
+                        node_traits::deallocate(a, p, 1);
+                        throw;
+                    }
+                    ::new(static_cast<void *>(&b)) node *(std::addressof(*p));
+                }
+                static T &get(any_buffer &b)
+                {
+                    return ptr(b)->obj;
+                }
+                static T const &get(any_buffer const &b)
+                {
+                    return ptr(b)->obj;
+                }
+                static Alloc const &allocator(any_buffer const &b)
+                {
+                    return ptr(b)->alloc;
+                }
+                static void destroy(any_buffer &b)
+                {
+                    node *p = ptr(b);
+                    node_alloc a(p->alloc);
+                    p->~node();
+                    node_traits::deallocate(a, std::pointer_traits<node_pointer>::pointer_to(*p), 1);
+                }
+                static void copy(any_buffer &to, any_buffer const &from)
+                {
+                    node const *p = ptr(from);
+                    create(to, p->alloc, p->obj);
+                }
+                static void move(any_buffer &to, any_buffer &from)
+                {
+                    ::new(static_cast<void *>(&to)) node *(ptr(from));
+                }
             };
 
-            template<typename Ref, category Cat = category::input>
-            struct any_cursor_interface
+            // Identifies a type without RTTI, for sanity checks.
+            template<typename T>
+            struct any_type_id
             {
-                virtual ~any_cursor_interface() = default;
-                virtual any_object const &iter() const = 0;
-                virtual Ref read() const = 0;
-                virtual bool equal(any_cursor_interface const &) const = 0;
-                virtual void next() = 0;
-                virtual any_cursor_interface *clone_() const = 0;
-                any_cursor_interface *clone() const
-                {
-                    return this->clone_();
-                }
+                static constexpr char id = 0;
             };
 
-            template<typename Ref>
-            struct any_cursor_interface<Ref, category::forward>
-              : any_cursor_interface<Ref, category::input>
+            template<typename T>
+            constexpr char any_type_id<T>::id;
+
+            // The leading entries of every function table below.
+            struct any_box_ops
             {
-                any_cursor_interface *clone() const
-                {
-                    return static_cast<any_cursor_interface *>(this->clone_());
-                }
+                void (*destroy)(any_buffer &);
+                void (*copy)(any_buffer &, any_buffer const &);
+                void (*move)(any_buffer &, any_buffer &);
             };
 
-            template<typename Ref>
-            struct any_cursor_interface<Ref, category::bidirectional>
-              : any_cursor_interface<Ref, category::forward>
+            template<typename H>
+            constexpr any_box_ops any_box_ops_for()
+            {
+                return {&H::destroy, &H::copy, &H::move};
+            }
+
+            // An erased object together with a pointer to a statically
+            // allocated table of functions (VTable, whose first member is an
+            // any_box_ops named box) that know its type.
+            template<typename VTable>
+            struct any_box
             {
-                virtual void prev() = 0;
-                any_cursor_interface *clone() const
+            private:
+                VTable const *vtable_ = nullptr;
+                any_buffer buffer_;
+            public:
+                any_box() = default;
+                any_box(any_box &&that) noexcept
+                {
+                    *this = std::move(that);
+                }
+                any_box(any_box const &that)
+                {
+                    *this = that;
+                }
+                ~any_box()
                 {
-                    return static_cast<any_cursor_interface *>(this->clone_());
+                    reset();
+                }
+                any_box &operator=(any_box &&that) noexcept
+                {
+                    if(this != &that)
+                    {
+                        reset();
+                        if(that.vtable_)
+                        {
+                            that.vtable_->box.move(buffer_, that.buffer_);
+                            vtable_ = that.vtable_;
+                            that.vtable_ = nullptr;
+                        }
+                    }
+                    return *this;
+                }
+                any_box &operator=(any_box const &that)
+                {
+                    if(this != &that)
+                    {
+                        reset();
+                        if(that.vtable_)
+                        {
+                            that.vtable_->box.copy(buffer_, that.buffer_);
+                            vtable_ = that.vtable_;
+                        }
+                    }
+                    return *this;
+                }
+                template<typename H, typename Alloc, typename... Args>
+                void emplace(VTable const &vtable, Alloc const &alloc, Args &&... args)
+                {
+                    reset();
+                    H::create(buffer_, alloc, static_cast<Args &&>(args)...);
+                    vtable_ = &vtable;
+                }
+                void reset()
+                {
+                    if(vtable_)
+                    {
+                        vtable_->box.destroy(buffer_);
+                        vtable_ = nullptr;
+                    }
+                }
+                explicit operator bool() const
+                {
+                    return vtable_ != nullptr;
+                }
+                VTable const &vtable() const
+                {
+                    RANGES_EXPECT(vtable_);
+                    return *vtable_;
+                }
+                any_buffer &buffer()
+                {
+                    return buffer_;
+                }
+                any_buffer const &buffer() const
+                {
+                    return buffer_;
                 }
             };
 
             template<typename Ref>
-            struct any_cursor_interface<Ref, category::random_access>
-              : any_cursor_interface<Ref, category::bidirectional>
+            struct any_cursor_vtable
             {
-                virtual void advance(std::ptrdiff_t) = 0;
-                virtual std::ptrdiff_t distance_to(any_cursor_interface const &) const = 0;
-                any_cursor_interface *clone() const
-                {
-                    return static_cast<any_cursor_interface *>(this->clone_());
-                }
+                any_box_ops box;
+                void const *iter_type;
+                Ref (*read)(any_buffer const &);
+                bool (*equal)(any_buffer const &, any_buffer const &);
+                void (*next)(any_buffer &);
+                // The following are only called for cursors of a category
+                // that supports them.
+                void (*prev)(any_buffer &);
+                void (*advance)(any_buffer &, std::ptrdiff_t);
+                std::ptrdiff_t (*distance_to)(any_buffer const &, any_buffer const &);
             };
 
-            template<typename S, typename I>
-            struct any_sentinel_impl;
-
-            template<typename I, typename Ref, category Cat>
-            struct any_cursor_impl
-              : any_cursor_interface<Ref, Cat>
+            template<typename I, typename Ref, category Cat, typename Alloc>
+            struct any_cursor_ops
             {
             private:
-                template<typename S, typename II>
-                friend struct any_sentinel_impl;
                 CONCEPT_ASSERT(ConvertibleTo<iterator_reference_t<I>, Ref>());
-                using Input = any_cursor_interface<Ref, category::input>;
-                object<I> it_;
+                using H = any_handler<I, Alloc>;
 
-                CONCEPT_REQUIRES(EqualityComparable<I>())
-                bool equal_(Input const &that) const
+                static Ref read(any_buffer const &b)
+                {
+                    return *H::get(b);
+                }
+                static bool equal_(std::true_type, any_buffer const &b, any_buffer const &that)
                 {
-                    any_cursor_impl const *pthat =
-                        polymorphic_downcast<any_cursor_impl const *>(&that);
-                    return pthat->it_.get() == it_.get();
+                    return H::get(that) == H::get(b);
                 }
-                CONCEPT_REQUIRES(!EqualityComparable<I>())
-                bool equal_(Input const &) const
+                static bool equal_(std::false_type, any_buffer const &, any_buffer const &)
                 {
                     return true;
                 }
-
-            public:
-                any_cursor_impl() = default;
-                any_cursor_impl(I it)
-                  : it_{std::move(it)}
-                {}
-                object<I> const &iter() const // override
+                static bool equal(any_buffer const &b, any_buffer const &that)
+                {
+                    return equal_(meta::bool_<(EqualityComparable<I>())>{}, b, that);
+                }
+                static void next(any_buffer &b)
+                {
+                    ++H::get(b);
+                }
+                static void prev_(std::true_type, any_buffer &b)
                 {
-                    return it_;
+                    --H::get(b);
                 }
-                Ref read() const // override
+                static void prev_(std::false_type, any_buffer &)
                 {
-                    return *it_.get();
+                    RANGES_EXPECT(false);
                 }
-                bool equal(Input const &that) const // override
+                static void prev(any_buffer &b)
                 {
-                    return equal_(that);
+                    prev_(meta::bool_<(Cat >= category::bidirectional)>{}, b);
                 }
-                void next() // override
+                static void advance_(std::true_type, any_buffer &b, std::ptrdiff_t n)
                 {
-                    ++it_.get();
+                    H::get(b) += static_cast<iterator_difference_t<I>>(n);
                 }
-                any_cursor_impl *clone_() const // override
+                static void advance_(std::false_type, any_buffer &, std::ptrdiff_t)
                 {
-                    return new any_cursor_impl{it_.get()};
+                    RANGES_EXPECT(false);
                 }
-                void prev() // override (sometimes; it's complicated)
+                static void advance(any_buffer &b, std::ptrdiff_t n)
                 {
-                    --it_.get();
+                    advance_(meta::bool_<(Cat >= category::random_access)>{}, b, n);
                 }
-                void advance(std::ptrdiff_t n) // override-ish
+                static std::ptrdiff_t distance_to_(std::true_type, any_buffer const &b,
+                    any_buffer const &that)
                 {
-                    it_.get() += n;
+                    return static_cast<std::ptrdiff_t>(H::get(that) - H::get(b));
                 }
-                std::ptrdiff_t distance_to(
-                    any_cursor_interface<Ref, category::random_access> const &that) const // override-ish
+                static std::ptrdiff_t distance_to_(std::false_type, any_buffer const &,
+                    any_buffer const &)
                 {
-                    any_cursor_impl const *pthat =
-                        polymorphic_downcast<any_cursor_impl const *>(&that);
-                    return static_cast<std::ptrdiff_t>(pthat->it_.get() - it_.get());
+                    RANGES_EXPECT(false);
+                    return 0;
                 }
+                static std::ptrdiff_t distance_to(any_buffer const &b, any_buffer const &that)
+                {
+                    return distance_to_(meta::bool_<(Cat >= category::random_access)>{}, b, that);
+                }
+            public:
+                using handler = H;
+                static constexpr any_cursor_vtable<Ref> vtable = {
+                    any_box_ops_for<H>(), &any_type_id<H>::id,
+                    &read, &equal, &next, &prev, &advance, &distance_to
+                };
             };
 
-            struct any_sentinel_interface
+            template<typename I, typename Ref, category Cat, typename Alloc>
+            constexpr any_cursor_vtable<Ref> any_cursor_ops<I, Ref, Cat, Alloc>::vtable;
+
+            struct any_sentinel_vtable
             {
-                virtual ~any_sentinel_interface() = default;
-                virtual bool equal(any_object const &) const = 0;
-                virtual any_sentinel_interface *clone() const = 0;
+                any_box_ops box;
+                // Identifies how the iterators this sentinel compares against
+                // are stored.
+                void const *iter_type;
+                bool (*equal)(any_buffer const &, any_buffer const &);
             };
 
-            template<typename S, typename I>
-            struct any_sentinel_impl
-              : any_sentinel_interface
+            template<typename S, typename I, typename Alloc>
+            struct any_sentinel_ops
             {
             private:
-                S s_;
-            public:
-                any_sentinel_impl() = default;
-                any_sentinel_impl(S s)
-                  : s_(std::move(s))
-                {}
-                bool equal(any_object const &that) const override
-                {
-                    object<I> const *pthat = polymorphic_downcast<object<I> const *>(&that);
-                    return s_ == pthat->get();
-                }
-                any_sentinel_impl *clone() const override
+                using H = any_handler<S, Alloc>;
+                using IH = any_handler<I, Alloc>;
+
+                static bool equal(any_buffer const &b, any_buffer const &it)
                 {
-                    return new any_sentinel_impl{s_};
+                    return H::get(b) == IH::get(it);
                 }
+            public:
+                using handler = H;
+                static constexpr any_sentinel_vtable vtable = {
+                    any_box_ops_for<H>(), &any_type_id<IH>::id, &equal
+                };
             };
 
+            template<typename S, typename I, typename Alloc>
+            constexpr any_sentinel_vtable any_sentinel_ops<S, I, Alloc>::vtable;
+
             template<typename Ref, category Cat>
             struct any_cursor;
 
@@ -212,25 +419,17 @@ namespace ranges
             private:
                 template<typename, category>
                 friend struct any_cursor;
-                std::unique_ptr<any_sentinel_interface> ptr_;
+                any_box<any_sentinel_vtable> box_;
             public:
                 any_sentinel() = default;
-                template<typename Rng,
+                template<typename Rng, typename Alloc = std::allocator<char>,
                     CONCEPT_REQUIRES_(!Same<detail::decay_t<Rng>, any_sentinel>()),
                     CONCEPT_REQUIRES_(InputRange<Rng>())>
-                any_sentinel(Rng &&rng, end_tag)
-                  : ptr_{new any_sentinel_impl<range_sentinel_t<Rng>, range_iterator_t<Rng>>{
-                        end(rng)}}
-                {}
-                any_sentinel(any_sentinel &&) = default;
-                any_sentinel(any_sentinel const &that)
-                  : ptr_{that.ptr_ ? that.ptr_->clone() : nullptr}
-                {}
-                any_sentinel &operator=(any_sentinel &&) = default;
-                any_sentinel &operator=(any_sentinel const &that)
-                {
-                    ptr_.reset(that.ptr_ ? that.ptr_->clone() : nullptr);
-                    return *this;
+                any_sentinel(Rng &&rng, end_tag, Alloc const &alloc = Alloc{})
+                {
+                    using ops = any_sentinel_ops<range_sentinel_t<Rng>, range_iterator_t<Rng>,
+                        Alloc>;
+                    box_.template emplace<typename ops::handler>(ops::vtable, alloc, end(rng));
                 }
             };
 
@@ -239,102 +438,134 @@ namespace ranges
             {
             private:
                 friend struct any_sentinel;
-                std::unique_ptr<any_cursor_interface<Ref, Cat>> ptr_;
+                any_box<any_cursor_vtable<Ref>> box_;
             public:
                 using single_pass = meta::bool_<Cat == category::input>;
                 any_cursor() = default;
-                template<typename Rng,
+                template<typename Rng, typename Alloc = std::allocator<char>,
                     CONCEPT_REQUIRES_(!Same<detail::decay_t<Rng>, any_cursor>()),
                     CONCEPT_REQUIRES_(InputRange<Rng>() &&
                                       ConvertibleTo<range_reference_t<Rng>, Ref>())>
-                any_cursor(Rng &&rng, begin_tag)
-                  : ptr_{new any_cursor_impl<range_iterator_t<Rng>, Ref, Cat>{begin(rng)}}
-                {}
-                any_cursor(any_cursor &&) = default;
-                any_cursor(any_cursor const &that)
-                  : ptr_{that.ptr_ ? that.ptr_->clone() : nullptr}
-                {}
-                any_cursor &operator=(any_cursor &&) = default;
-                any_cursor &operator=(any_cursor const &that)
-                {
-                    ptr_.reset(that.ptr_ ? that.ptr_->clone() : nullptr);
-                    return *this;
+                any_cursor(Rng &&rng, begin_tag, Alloc const &alloc = Alloc{})
+                {
+                    using ops = any_cursor_ops<range_iterator_t<Rng>, Ref, Cat, Alloc>;
+                    box_.template emplace<typename ops::handler>(ops::vtable, alloc, begin(rng));
                 }
                 Ref read() const
                 {
-                    RANGES_EXPECT(ptr_);
-                    return ptr_->read();
+                    return box_.vtable().read(box_.buffer());
                 }
                 bool equal(any_cursor const &that) const
                 {
-                    RANGES_EXPECT(!ptr_ == !that.ptr_);
-                    return (!ptr_ && !that.ptr_) || ptr_->equal(*that.ptr_);
+                    RANGES_EXPECT(!box_ == !that.box_);
+                    return !box_ || box_.vtable().equal(box_.buffer(), that.box_.buffer());
                 }
                 bool equal(any_sentinel const &that) const
                 {
-                    RANGES_EXPECT(!ptr_ == !that.ptr_);
-                    return (!ptr_ && !that.ptr_) || that.ptr_->equal(ptr_->iter());
+                    RANGES_EXPECT(!box_ == !that.box_);
+                    if(!box_)
+                        return true;
+                    RANGES_EXPECT(box_.vtable().iter_type == that.box_.vtable().iter_type);
+                    return that.box_.vtable().equal(that.box_.buffer(), box_.buffer());
                 }
                 void next()
                 {
-                    RANGES_EXPECT(ptr_);
-                    ptr_->next();
+                    box_.vtable().next(box_.buffer());
                 }
                 CONCEPT_REQUIRES(Cat >= category::bidirectional)
                 void prev()
                 {
-                    RANGES_EXPECT(ptr_);
-                    ptr_->prev();
+                    box_.vtable().prev(box_.buffer());
                 }
                 CONCEPT_REQUIRES(Cat >= category::random_access)
                 void advance(std::ptrdiff_t n)
                 {
-                    RANGES_EXPECT(ptr_);
-                    ptr_->advance(n);
+                    box_.vtable().advance(box_.buffer(), n);
                 }
                 CONCEPT_REQUIRES(Cat >= category::random_access)
                 std::ptrdiff_t distance_to(any_cursor const &that) const
                 {
-                    RANGES_EXPECT(!ptr_ == !that.ptr_);
-                    return !ptr_ ? 0 : ptr_->distance_to(*that.ptr_);
+                    RANGES_EXPECT(!box_ == !that.box_);
+                    return !box_ ? 0 : box_.vtable().distance_to(box_.buffer(), that.box_.buffer());
                 }
             };
 
             template<typename Ref, category Cat>
-            struct any_view_interface
+            struct any_view_vtable
             {
-                virtual ~any_view_interface() = default;
-                virtual any_cursor<Ref, Cat> begin_cursor() = 0;
-                virtual any_sentinel end_cursor() = 0;
-                virtual any_view_interface *clone() const = 0;
+                any_box_ops box;
+                any_cursor<Ref, Cat> (*begin_cursor)(any_buffer &);
+                any_sentinel (*end_cursor)(any_buffer &);
             };
 
-            template<typename Rng, typename Ref, category Cat>
-            struct any_view_impl
-              : any_view_interface<Ref, Cat>
+            template<typename Rng, typename Ref, category Cat, typename Alloc>
+            struct any_view_ops
             {
             private:
                 CONCEPT_ASSERT(ConvertibleTo<range_reference_t<Rng>, Ref>());
-                Rng rng_;
-            public:
-                any_view_impl() = default;
-                any_view_impl(Rng rng)
-                  : rng_(std::move(rng))
-                {}
-                any_cursor<Ref, Cat> begin_cursor() override
+                // The cursors and sentinels that do not fit inline are allocated
+                // with the range's allocator. A range stored inline keeps it
+                // alongside; one allocated finds it in its node.
+                using pair = compressed_pair<Rng, Alloc>;
+                using is_inline =
+                    meta::bool_<any_relocatable_range<Rng>() && any_fits_inline<pair>()>;
+                using H = any_handler<meta::if_<is_inline, pair, Rng>, Alloc, is_inline::value>;
+
+                static Rng &range(any_buffer &b, std::true_type)
                 {
-                    return {rng_, begin_tag{}};
+                    return H::get(b).first();
                 }
-                any_sentinel end_cursor() override
+                static Rng &range(any_buffer &b, std::false_type)
                 {
-                    return {rng_, end_tag{}};
+                    return H::get(b);
                 }
-                any_view_interface<Ref, Cat> *clone() const override
+                static Alloc const &allocator(any_buffer const &b, std::true_type)
                 {
-                    return new any_view_impl{rng_};
+                    return H::get(b).second();
                 }
+                static Alloc const &allocator(any_buffer const &b, std::false_type)
+                {
+                    return H::allocator(b);
+                }
+                static any_cursor<Ref, Cat> begin_cursor(any_buffer &b)
+                {
+                    return {range(b, is_inline{}), begin_tag{}, allocator(b, is_inline{})};
+                }
+                static any_sentinel end_cursor(any_buffer &b)
+                {
+                    return {range(b, is_inline{}), end_tag{}, allocator(b, is_inline{})};
+                }
+            public:
+                struct handler
+                  : H
+                {
+                    template<typename R>
+                    static void create(any_buffer &b, Alloc const &alloc, R &&rng)
+                    {
+                        handler::create_(b, alloc, static_cast<R &&>(rng), is_inline{});
+                    }
+                private:
+                    template<typename R>
+                    static void create_(any_buffer &b, Alloc const &alloc, R &&rng,
+                        std::true_type)
+                    {
+                        H::create(b, alloc, static_cast<R &&>(rng), alloc);
+                    }
+                    template<typename R>
+                    static void create_(any_buffer &b, Alloc const &alloc, R &&rng,
+                        std::false_type)
+                    {
+                        H::create(b, alloc, static_cast<R &&>(rng));
+                    }
+                };
+                static constexpr any_view_vtable<Ref, Cat> vtable = {
+                    any_box_ops_for<H>(), &begin_cursor, &end_cursor
+                };
             };
 
+            template<typename Rng, typename Ref, category Cat, typename Alloc>
+            constexpr any_view_vtable<Ref, Cat> any_view_ops<Rng, Ref, Cat, Alloc>::vtable;
+
             constexpr category to_cat_(concepts::InputRange *) { return category::input; }
             constexpr category to_cat_(concepts::ForwardRange *) { return category::forward; }
             constexpr category to_cat_(concepts::BidirectionalRange *) { return category::bidirectional; }
@@ -343,6 +574,15 @@ namespace ranges
         /// \endcond
 
         /// \brief A type-erased view
+        ///
+        /// The erased iterators and sentinels of `any_view`'s own iterators are
+        /// stored inline when they are small enough (see
+        /// `detail::any_buffer_size`), so that copying an iterator does not
+        /// allocate. So is the erased range when it is only a pair of iterators,
+        /// as for a container; any other range is allocated, so that moving the
+        /// `any_view` does not invalidate its iterators. Larger objects are
+        /// allocated with `std::allocator`, or with the allocator passed to the
+        /// `std::allocator_arg_t` constructor.
         /// \ingroup group-views
         template<typename Ref, category Cat = category::input>
         struct any_view
@@ -350,22 +590,24 @@ namespace ranges
         {
         private:
             friend range_access;
-            std::unique_ptr<detail::any_view_interface<Ref, Cat>> ptr_;
+            detail::any_box<detail::any_view_vtable<Ref, Cat>> box_;
             detail::any_cursor<Ref, Cat> begin_cursor()
             {
-                return ptr_ ? ptr_->begin_cursor() : detail::value_init{};
+                return box_ ? box_.vtable().begin_cursor(box_.buffer()) : detail::value_init{};
             }
             detail::any_sentinel end_cursor()
             {
-                return ptr_ ? ptr_->end_cursor() : detail::value_init{};
+                return box_ ? box_.vtable().end_cursor(box_.buffer()) : detail::value_init{};
             }
-            template<typename Rng>
-            any_view(Rng && rng, std::true_type)
-              : ptr_{new detail::any_view_impl<view::all_t<Rng>, Ref, Cat>{
-                    view::all(std::forward<Rng>(rng))}}
-            {}
-            template<typename Rng>
-            any_view(Rng &&, std::false_type)
+            template<typename Rng, typename Alloc>
+            any_view(Rng && rng, Alloc const &alloc, std::true_type)
+            {
+                using ops = detail::any_view_ops<view::all_t<Rng>, Ref, Cat, Alloc>;
+                box_.template emplace<typename ops::handler>(ops::vtable, alloc,
+                    view::all(std::forward<Rng>(rng)));
+            }
+            template<typename Rng, typename Alloc>
+            any_view(Rng &&, Alloc const &, std::false_type)
             {
                 static_assert(detail::to_cat_(range_concept<Rng>{}) >= Cat,
                     "The range passed to any_view() does not model the requested category");
@@ -380,19 +622,20 @@ namespace ranges
                     InputRange<Rng>,
                     meta::defer<CompatibleRange, Rng>>::value)>
             any_view(Rng && rng)
-              : any_view(std::forward<Rng>(rng),
+              : any_view(std::forward<Rng>(rng), std::allocator<char>{},
                   meta::bool_<detail::to_cat_(range_concept<Rng>{}) >= Cat>{})
             {}
-            any_view(any_view &&) = default;
-            any_view(any_view const &that)
-              : ptr_{that.ptr_ ? that.ptr_->clone() : nullptr}
+            /// Erase `rng`, using `alloc` for the range, iterators and
+            /// sentinels that are too big to be stored inline.
+            template<typename Alloc, typename Rng,
+                CONCEPT_REQUIRES_(meta::and_<
+                    meta::not_<Same<detail::decay_t<Rng>, any_view>>,
+                    InputRange<Rng>,
+                    meta::defer<CompatibleRange, Rng>>::value)>
+            any_view(std::allocator_arg_t, Alloc const &alloc, Rng && rng)
+              : any_view(std::forward<Rng>(rng), alloc,
+                  meta::bool_<detail::to_cat_(range_concept<Rng>{}) >= Cat>{})
             {}
-            any_view &operator=(any_view &&) = default;
-            any_view &operator=(any_view const &that)
-            {
-                ptr_.reset(that.ptr_ ? that.ptr_->clone() : nullptr);
-                return *this;
-            }
         };
 
         template<typename Ref>
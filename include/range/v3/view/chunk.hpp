@@ -14,8 +14,10 @@
 #ifndef RANGES_V3_VIEW_CHUNK_HPP
 #define RANGES_V3_VIEW_CHUNK_HPP
 
+#include <cstddef>
 #include <utility>
 #include <functional>
+#include <vector>
 #include <meta/meta.hpp>
 #include <range/v3/detail/satisfy_boost_range.hpp>
 #include <range/v3/range_fwd.hpp>
@@ -24,7 +26,9 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/span.hpp>
 #include <range/v3/view_adaptor.hpp>
+#include <range/v3/view_facade.hpp>
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/view.hpp>
 #include <range/v3/view/take.hpp>
@@ -125,11 +129,77 @@ namespace ranges
             }
         };
 
+        /// The chunks of an input range, which can be read only once. Each
+        /// chunk is read into a buffer that the view reuses for the next one,
+        /// and is a `span` of the buffer, so reading the chunks allocates
+        /// nothing after the first. A chunk is valid until the iterator is
+        /// incremented.
+        template<typename Rng>
+        struct input_chunk_view
+          : view_facade<
+                input_chunk_view<Rng>,
+                is_infinite<Rng>::value ? infinite : is_finite<Rng>::value ? finite : unknown>
+        {
+        private:
+            CONCEPT_ASSERT(InputRange<Rng>());
+            friend range_access;
+            using value_t = range_value_t<Rng>;
+            Rng rng_;
+            range_difference_t<Rng> n_;
+            range_iterator_t<Rng> it_;
+            std::vector<value_t> buf_;
+
+            void fill()
+            {
+                buf_.clear();
+                auto const end = ranges::end(rng_);
+                for(auto n = n_; n != 0 && it_ != end; --n, ++it_)
+                    buf_.push_back(*it_);
+            }
+            struct cursor
+            {
+            private:
+                input_chunk_view *rng_;
+            public:
+                cursor() = default;
+                explicit cursor(input_chunk_view &rng)
+                  : rng_(&rng)
+                {}
+                span<value_t> read() const
+                {
+                    return {rng_->buf_.data(), static_cast<std::ptrdiff_t>(rng_->buf_.size())};
+                }
+                void next()
+                {
+                    rng_->fill();
+                }
+                bool equal(default_sentinel) const
+                {
+                    return rng_->buf_.empty();
+                }
+            };
+            cursor begin_cursor()
+            {
+                it_ = ranges::begin(rng_);
+                buf_.reserve(static_cast<std::size_t>(n_));
+                fill();
+                return cursor{*this};
+            }
+        public:
+            input_chunk_view() = default;
+            input_chunk_view(Rng rng, range_difference_t<Rng> n)
+              : rng_(std::move(rng)), n_(n), it_{}, buf_{}
+            {
+                RANGES_EXPECT(0 < n_);
+            }
+        };
+
         namespace view
         {
             // In:  Range<T>
             // Out: Range<Range<T>>, where each inner range has $n$ elements.
-            //                       The last range may have fewer.
+            //                       The last range may have fewer. The chunks
+            //                       of an input range are spans of a buffer.
             struct chunk_fn
             {
             private:
@@ -148,6 +218,18 @@ namespace ranges
                 {
                     return {all(std::forward<Rng>(rng)), n};
                 }
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(InputRange<Rng>() && !ForwardRange<Rng>())>
+                input_chunk_view<all_t<Rng>> operator()(Rng && rng,
+                    range_difference_t<Rng> n) const
+                {
+                    CONCEPT_ASSERT_MSG(Constructible<range_value_t<Rng>,
+                            range_reference_t<Rng>>() && Movable<range_value_t<Rng>>(),
+                        "view::chunk copies the elements of an input range into a buffer, so "
+                        "their value type must be constructible from their reference type, "
+                        "and movable.");
+                    return {all(std::forward<Rng>(rng)), n};
+                }
 
                 // For the sake of better error messages:
             #ifndef RANGES_DOXYGEN_INVOKED
@@ -162,11 +244,11 @@ namespace ranges
                 }
             public:
                 template<typename Rng, typename T,
-                    CONCEPT_REQUIRES_(!(ForwardRange<Rng>() && Integral<T>()))>
+                    CONCEPT_REQUIRES_(!(InputRange<Rng>() && Integral<T>()))>
                 void operator()(Rng &&, T) const
                 {
-                    CONCEPT_ASSERT_MSG(ForwardRange<Rng>(),
-                        "The first argument to view::chunk must be a model of the ForwardRange concept");
+                    CONCEPT_ASSERT_MSG(InputRange<Rng>(),
+                        "The first argument to view::chunk must be a model of the InputRange concept");
                     CONCEPT_ASSERT_MSG(Integral<T>(),
                         "The second argument to view::chunk must be a model of the Integral concept");
                 }
@@ -182,5 +264,6 @@ namespace ranges
 }
 
 RANGES_SATISFY_BOOST_RANGE(::ranges::v3::chunk_view)
+RANGES_SATISFY_BOOST_RANGE(::ranges::v3::input_chunk_view)
 
 #endif
@@ -291,6 +291,58 @@ namespace ranges
                         return cursor::distance_to_(meta::size_t<0>{}, *this, that);
                     return -cursor::distance_to_(meta::size_t<0>{}, that, *this);
                 }
+                // Hands fun the part of each range between here and last in turn;
+                // see detail::segmented.
+                template<typename Fun>
+                void for_each_segment(Fun &fun, cursor const &last)
+                {
+                    this->for_each_segment_(meta::size_t<0>{}, fun, last);
+                }
+                template<typename Fun>
+                void for_each_segment(Fun &fun, sentinel<IsConst> const &last)
+                {
+                    this->for_each_segment_(meta::size_t<0>{}, fun, last);
+                }
+            private:
+                template<std::size_t N, typename Fun>
+                bool last_segment_(meta::size_t<N>, Fun &fun, cursor const &last)
+                {
+                    if(last.its_.index() != N)
+                        return false;
+                    fun(ranges::get<N>(its_), ranges::get<N>(last.its_));
+                    return true;
+                }
+                template<std::size_t N, typename Fun>
+                static bool last_segment_(meta::size_t<N>, Fun &, sentinel<IsConst> const &)
+                {
+                    return false;
+                }
+                template<std::size_t N, typename Fun, typename End>
+                void for_each_segment_(meta::size_t<N>, Fun &fun, End const &last)
+                {
+                    if(its_.index() == N)
+                    {
+                        if(this->last_segment_(meta::size_t<N>{}, fun, last))
+                            return;
+                        auto &it = ranges::get<N>(its_);
+                        fun(it, end(std::get<N>(rng_->rngs_)));
+                        if(it != end(std::get<N>(rng_->rngs_)))
+                            return;
+                        ranges::emplace<N + 1>(its_, begin(std::get<N + 1>(rng_->rngs_)));
+                    }
+                    this->for_each_segment_(meta::size_t<N + 1>{}, fun, last);
+                }
+                template<typename Fun>
+                void for_each_segment_(meta::size_t<cranges - 1>, Fun &fun, cursor const &last)
+                {
+                    fun(ranges::get<cranges - 1>(its_), ranges::get<cranges - 1>(last.its_));
+                }
+                template<typename Fun>
+                void for_each_segment_(meta::size_t<cranges - 1>, Fun &fun,
+                    sentinel<IsConst> const &last)
+                {
+                    fun(ranges::get<cranges - 1>(its_), last.end_);
+                }
             };
             cursor<false> begin_cursor()
             {
@@ -0,0 +1,322 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_CSV_FIELDS_HPP
+#define RANGES_V3_VIEW_CSV_FIELDS_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/detail/satisfy_boost_range.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/iterator_range.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/algorithm/aux_/simd.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/tokenize_chars.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            template<typename I, typename S>
+            I find_char(std::true_type, I first, S last, char c)
+            {
+                auto const n = static_cast<std::size_t>(last - first);
+                return n == 0 ? first : first + static_cast<iterator_difference_t<I>>(
+                    simd::find(std::addressof(*first), n, c));
+            }
+            template<typename I, typename S>
+            I find_char(std::false_type, I first, S last, char c)
+            {
+                for(; first != last; ++first)
+                    if(*first == c)
+                        break;
+                return first;
+            }
+
+            // The delimiter and the quote of a text of comma-separated values,
+            // and the class of the delimiter and the line breaks.
+            struct csv_syntax
+            {
+                simd::byte_class special;
+                char delim, quote;
+
+                csv_syntax(char d, char q)
+                  : special([d](unsigned char c) {
+                        return c == static_cast<unsigned char>(d) || c == '\n' || c == '\r';
+                    })
+                  , delim(d), quote(q)
+                {}
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// A field of comma-separated values, as the subrange of the text
+        /// between its delimiters, or between its quotes if it is quoted. A
+        /// doubled quote within a quoted field stands for one quote; `str()`
+        /// returns the field with them undoubled.
+        template<typename I>
+        struct csv_field
+          : iterator_range<I>
+        {
+        private:
+            bool quoted_ = false;
+            bool escaped_ = false;
+            bool end_of_record_ = false;
+            char quote_ = '"';
+        public:
+            csv_field() = default;
+            csv_field(I first, I last, bool quoted, bool escaped, bool end_of_record,
+                char quote)
+              : iterator_range<I>{std::move(first), std::move(last)}
+              , quoted_(quoted), escaped_(escaped), end_of_record_(end_of_record)
+              , quote_(quote)
+            {}
+            /// Whether the field was enclosed in quotes.
+            bool quoted() const noexcept
+            {
+                return quoted_;
+            }
+            /// Whether the field holds doubled quotes.
+            bool escaped() const noexcept
+            {
+                return escaped_;
+            }
+            /// Whether the field is the last of its record.
+            bool end_of_record() const noexcept
+            {
+                return end_of_record_;
+            }
+            /// The contents of the field.
+            std::string str() const
+            {
+                std::string s;
+                for(I i = this->begin(); i != this->end(); ++i)
+                {
+                    s += *i;
+                    // The field is inside its quotes, so a quote in it is
+                    // followed by another.
+                    if(escaped_ && *i == quote_)
+                        ++i;
+                }
+                return s;
+            }
+        };
+
+        /// The fields of a text of comma-separated values, in the format of
+        /// RFC 4180, in order and across records; each field says whether it
+        /// ends its record. Records end with CRLF, LF or CR, and a text that
+        /// ends with one has no empty record after it. A quoted field may hold
+        /// delimiters, line breaks and doubled quotes; anything between its
+        /// closing quote and the next delimiter is skipped. Contiguous texts
+        /// are scanned with vector instructions where available.
+        template<typename Rng>
+        struct csv_fields_view
+          : view_facade<csv_fields_view<Rng>, finite>
+        {
+        private:
+            friend range_access;
+            Rng rng_;
+            // Shared with the cursors, which may outlive the view.
+            std::shared_ptr<detail::csv_syntax const> syntax_;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                using CRng = meta::invoke<meta::add_const_if_c<IsConst>, Rng>;
+                using I = range_iterator_t<CRng>;
+                using S = range_sentinel_t<CRng>;
+                std::shared_ptr<detail::csv_syntax const> syntax_;
+                csv_field<I> field_;
+                // Where the next field starts, and whether there is one.
+                I next_;
+                S last_;
+                bool more_, done_;
+
+                I find_special(I first) const
+                {
+                    return detail::find_char_class(detail::contiguous_chars<I, S>{},
+                        std::move(first), last_, syntax_->special, true);
+                }
+                I find_quote(I first) const
+                {
+                    return detail::find_char(detail::contiguous_chars<I, S>{},
+                        std::move(first), last_, syntax_->quote);
+                }
+                void parse(I p)
+                {
+                    char const delim = syntax_->delim, quote = syntax_->quote;
+                    bool quoted = false, escaped = false;
+                    I b = p, e = p;
+                    if(p != last_ && *p == quote)
+                    {
+                        quoted = true;
+                        b = ++p;
+                        for(;;)
+                        {
+                            e = p = find_quote(p);
+                            if(p == last_)
+                                break;
+                            if(++p == last_ || *p != quote)
+                                break;
+                            escaped = true;
+                            ++p;
+                        }
+                        p = find_special(p);
+                    }
+                    else
+                        e = p = find_special(p);
+                    bool end_of_record = true;
+                    if(p == last_)
+                        more_ = false;
+                    else if(*p == delim)
+                    {
+                        ++p;
+                        more_ = true;
+                        end_of_record = false;
+                    }
+                    else
+                    {
+                        if(*p == '\r')
+                        {
+                            if(++p != last_ && *p == '\n')
+                                ++p;
+                        }
+                        else
+                            ++p;
+                        more_ = p != last_;
+                    }
+                    next_ = p;
+                    field_ = csv_field<I>{b, e, quoted, escaped, end_of_record, quote};
+                }
+            public:
+                cursor() = default;
+                cursor(std::shared_ptr<detail::csv_syntax const> syntax, I first, S last)
+                  : syntax_(std::move(syntax)), next_(first), last_(last), more_(false)
+                  , done_(first == last)
+                {
+                    if(!done_)
+                        parse(std::move(first));
+                }
+                csv_field<I> read() const
+                {
+                    return field_;
+                }
+                void next()
+                {
+                    RANGES_EXPECT(!done_);
+                    if(more_)
+                        parse(next_);
+                    else
+                        done_ = true;
+                }
+                bool equal(default_sentinel) const
+                {
+                    return done_;
+                }
+                bool equal(cursor const &that) const
+                {
+                    // Each field starts past the start of the one before it.
+                    return done_ == that.done_ &&
+                        (done_ || field_.begin() == that.field_.begin());
+                }
+            };
+            cursor<false> begin_cursor()
+            {
+                return {syntax_, ranges::begin(rng_), ranges::end(rng_)};
+            }
+            CONCEPT_REQUIRES(Range<Rng const>())
+            cursor<true> begin_cursor() const
+            {
+                return {syntax_, ranges::begin(rng_), ranges::end(rng_)};
+            }
+        public:
+            csv_fields_view() = default;
+            csv_fields_view(Rng rng, char delim, char quote)
+              : rng_(std::move(rng))
+              , syntax_(std::make_shared<detail::csv_syntax const>(delim, quote))
+            {
+                RANGES_EXPECT(delim != quote && delim != '\n' && delim != '\r');
+            }
+        };
+
+        namespace view
+        {
+            struct csv_fields_fn
+            {
+            private:
+                friend view_access;
+                template<typename Char, CONCEPT_REQUIRES_(Same<Char, char>())>
+                static auto bind(csv_fields_fn csv_fields, Char delim, char quote = '"')
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(csv_fields, std::placeholders::_1, delim, quote))
+                )
+            public:
+                template<typename Rng>
+                using Concept = meta::and_<
+                    ForwardRange<Rng>,
+                    Same<range_value_t<Rng>, char>>;
+
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(Concept<Rng>())>
+                csv_fields_view<all_t<Rng>> operator()(Rng && rng, char delim = ',',
+                    char quote = '"') const
+                {
+                    return {all(static_cast<Rng &&>(rng)), delim, quote};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(!Concept<Rng>())>
+                void operator()(Rng &&, char = ',', char = '"') const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardRange<Rng>(),
+                        "The object on which view::csv_fields operates must be a model of "
+                        "the ForwardRange concept.");
+                    CONCEPT_ASSERT_MSG(Same<range_value_t<Rng>, char>(),
+                        "view::csv_fields operates on ranges of char.");
+                }
+            #endif
+            };
+
+            /// \relates csv_fields_fn
+            /// \ingroup group-views
+            RANGES_INLINE_VARIABLE(view<csv_fields_fn>, csv_fields)
+        }
+        /// @}
+    }
+}
+
+RANGES_SATISFY_BOOST_RANGE(::ranges::v3::csv_fields_view)
+
+#endif
@@ -22,6 +22,7 @@
 #include <range/v3/size.hpp>
 #include <range/v3/numeric.hpp> // for accumulate
 #include <range/v3/begin_end.hpp>
+#include <range/v3/distance.hpp>
 #include <range/v3/empty.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -81,8 +82,10 @@ namespace ranges
             {
                 return detail::join_cardinality<Rng>::value;
             }
+            // O(segments): the sizes of the inner ranges are summed.
             CONCEPT_REQUIRES(detail::join_cardinality<Rng>::value < 0 &&
-                range_cardinality<Rng>::value >= 0 && ForwardRange<Rng>() &&
+                detail::join_cardinality<Rng>::value != infinite &&
+                ForwardRange<Rng>() && Range<Rng const>() &&
                 SizedRange<range_reference_t<Rng>>())
             size_type size() const
             {
@@ -146,6 +149,22 @@ namespace ranges
                 (
                     iter_move(inner_it_)
                 )
+                // Hands fun each inner range in turn; see detail::segmented.
+                template<typename Fun>
+                void for_each_segment(Fun &fun, default_sentinel)
+                {
+                    auto const last = ranges::end(rng_->outer_);
+                    if (outer_it_ == last)
+                        return;
+                    while (true)
+                    {
+                        fun(inner_it_, ranges::end(rng_->inner_));
+                        if (inner_it_ != ranges::end(rng_->inner_) || ++outer_it_ == last)
+                            return;
+                        rng_->inner_ = view::all(*outer_it_);
+                        inner_it_ = ranges::begin(rng_->inner_);
+                    }
+                }
             };
             cursor begin_cursor()
             {
@@ -178,15 +197,18 @@ namespace ranges
             {
                 return detail::join_cardinality<Rng, ValRng>::value;
             }
+            // O(segments): the sizes of the inner ranges are summed.
             CONCEPT_REQUIRES(detail::join_cardinality<Rng, ValRng>::value < 0 &&
-                range_cardinality<Rng>::value >= 0 && ForwardRange<Rng>() &&
+                detail::join_cardinality<Rng, ValRng>::value != infinite &&
+                ForwardRange<Rng>() && Range<Rng const>() &&
                 SizedRange<range_reference_t<Rng>>() && SizedRange<ValRng>())
             size_type size() const
             {
+                auto const segments = static_cast<size_type>(ranges::distance(outer_));
                 return accumulate(view::transform(outer_, ranges::size), size_type{0}) +
-                        (range_cardinality<Rng>::value == 0 ?
-                            0 :
-                            ranges::size(val_) * (range_cardinality<Rng>::value - 1));;
+                    (segments == 0 ?
+                        size_type{0} :
+                        static_cast<size_type>(ranges::size(val_)) * (segments - 1));
             }
         private:
             friend range_access;
@@ -289,6 +311,35 @@ namespace ranges
                         return iter_move(ranges::get<1>(cur_));
                     }
                 }
+                // Hands fun the inner ranges and the separators between them in
+                // turn; see detail::segmented.
+                template<typename Fun>
+                void for_each_segment(Fun &fun, default_sentinel)
+                {
+                    auto const last = ranges::end(rng_->outer_);
+                    if (outer_it_ == last)
+                        return;
+                    while (true)
+                    {
+                        if (cur_.index() == 0)
+                        {
+                            auto& it = ranges::get<0>(cur_);
+                            fun(it, ranges::end(rng_->val_));
+                            if (it != ranges::end(rng_->val_))
+                                return;
+                            rng_->inner_ = view::all(*outer_it_);
+                            ranges::emplace<1>(cur_, ranges::begin(rng_->inner_));
+                        }
+                        else
+                        {
+                            auto& it = ranges::get<1>(cur_);
+                            fun(it, ranges::end(rng_->inner_));
+                            if (it != ranges::end(rng_->inner_) || ++outer_it_ == last)
+                                return;
+                            ranges::emplace<0>(cur_, ranges::begin(rng_->val_));
+                        }
+                    }
+                }
             };
             cursor begin_cursor()
             {
@@ -0,0 +1,189 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_LINES_HPP
+#define RANGES_V3_VIEW_LINES_HPP
+
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/span.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// The lines of a contiguous range of `char`, such as an `mmap_file`, as
+        /// `span`s into it, without the `'\n'` that ends each. As with
+        /// `std::getline`, a final line without a `'\n'` is included, but there
+        /// is no empty line after a final `'\n'`.
+        template<typename Rng>
+        struct lines_view
+          : view_facade<lines_view<Rng>, finite>
+        {
+        private:
+            friend range_access;
+            Rng rng_;
+
+            template<typename Char>
+            struct cursor
+            {
+            private:
+                // The current line is [line_, eol_), and eol_ is either a '\n'
+                // or end_.
+                Char *line_ = nullptr;
+                Char *eol_ = nullptr;
+                Char *end_ = nullptr;
+
+                void find_eol()
+                {
+                    void const *p = line_ == end_ ? nullptr :
+                        std::memchr(line_, '\n', static_cast<std::size_t>(end_ - line_));
+                    eol_ = p ? line_ + (static_cast<char const *>(p) - line_) : end_;
+                }
+            public:
+                cursor() = default;
+                cursor(Char *first, Char *last)
+                  : line_(first), end_(last)
+                {
+                    find_eol();
+                }
+                span<Char> read() const
+                {
+                    return {line_, eol_};
+                }
+                void next()
+                {
+                    RANGES_EXPECT(line_ != end_);
+                    line_ = eol_ == end_ ? end_ : eol_ + 1;
+                    find_eol();
+                }
+                bool equal(cursor const &that) const
+                {
+                    return line_ == that.line_;
+                }
+            };
+
+            template<typename R, typename Char = meta::_t<std::remove_reference<
+                range_reference_t<R>>>>
+            static std::pair<Char *, Char *> bounds(R &rng)
+            {
+                auto const n = ranges::size(rng);
+                if(n == 0)
+                    return {nullptr, nullptr};
+                Char *const first = std::addressof(*ranges::begin(rng));
+                return {first, first + n};
+            }
+
+            template<typename R, typename Char = meta::_t<std::remove_reference<
+                range_reference_t<R>>>>
+            static cursor<Char> begin_cursor_(R &rng)
+            {
+                auto const b = lines_view::bounds(rng);
+                return {b.first, b.second};
+            }
+            template<typename R, typename Char = meta::_t<std::remove_reference<
+                range_reference_t<R>>>>
+            static cursor<Char> end_cursor_(R &rng)
+            {
+                auto const b = lines_view::bounds(rng);
+                return {b.second, b.second};
+            }
+
+            auto begin_cursor() -> decltype(lines_view::begin_cursor_(rng_))
+            {
+                return lines_view::begin_cursor_(rng_);
+            }
+            auto end_cursor() -> decltype(lines_view::end_cursor_(rng_))
+            {
+                return lines_view::end_cursor_(rng_);
+            }
+            template<typename BaseRng = Rng,
+                CONCEPT_REQUIRES_(SizedRange<BaseRng const>())>
+            auto begin_cursor() const ->
+                decltype(lines_view::begin_cursor_(std::declval<BaseRng const &>()))
+            {
+                return lines_view::begin_cursor_(rng_);
+            }
+            template<typename BaseRng = Rng,
+                CONCEPT_REQUIRES_(SizedRange<BaseRng const>())>
+            auto end_cursor() const ->
+                decltype(lines_view::end_cursor_(std::declval<BaseRng const &>()))
+            {
+                return lines_view::end_cursor_(rng_);
+            }
+        public:
+            lines_view() = default;
+            explicit lines_view(Rng rng)
+              : rng_(std::move(rng))
+            {}
+        };
+
+        namespace view
+        {
+            struct lines_fn
+            {
+                template<typename Rng>
+                using Concept = meta::and_<
+                    RandomAccessRange<Rng>,
+                    SizedRange<Rng>,
+                    is_contiguous_iterator<range_iterator_t<Rng>>,
+                    std::is_same<range_value_t<Rng>, char>>;
+
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(Concept<Rng>())>
+                lines_view<all_t<Rng>> operator()(Rng && rng) const
+                {
+                    return lines_view<all_t<Rng>>{all(static_cast<Rng &&>(rng))};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(!Concept<Rng>())>
+                void operator()(Rng &&) const
+                {
+                    CONCEPT_ASSERT_MSG(RandomAccessRange<Rng>() && SizedRange<Rng>(),
+                        "The argument to view::lines must be a model of the RandomAccessRange "
+                        "and SizedRange concepts.");
+                    CONCEPT_ASSERT_MSG(is_contiguous_iterator<range_iterator_t<Rng>>(),
+                        "The elements of the range passed to view::lines must be stored "
+                        "contiguously.");
+                    CONCEPT_ASSERT_MSG(std::is_same<range_value_t<Rng>, char>(),
+                        "The range passed to view::lines must be a range of char.");
+                }
+            #endif
+            };
+
+            /// \relates lines_fn
+            /// \ingroup group-views
+            RANGES_INLINE_VARIABLE(view<lines_fn>, lines)
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -14,6 +14,7 @@
 #ifndef RANGES_V3_VIEW_REMOVE_IF_HPP
 #define RANGES_V3_VIEW_REMOVE_IF_HPP
 
+#include <cstddef>
 #include <utility>
 #include <type_traits>
 #include <meta/meta.hpp>
@@ -23,11 +24,13 @@
 #include <range/v3/range_traits.hpp>
 #include <range/v3/view_adaptor.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/size_hint.hpp>
 #include <range/v3/detail/optional.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/semiregular.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/algorithm/find_if_not.hpp>
+#include <range/v3/algorithm/aux_/blocks.hpp>
 #include <range/v3/view/view.hpp>
 
 RANGES_DISABLE_WARNINGS
@@ -85,6 +88,92 @@ namespace ranges
                     auto &pred = rng_->pred_;
                     do --it; while(invoke(pred, *it));
                 }
+                // Reads a block of the underlying range into out, keeping the
+                // values that are not removed. The first of them is where the
+                // cursor was, so it is kept. The predicate sees the underlying
+                // references, as it does an element at a time.
+                template<typename I, typename S, typename V,
+                    CONCEPT_REQUIRES_(RandomAccessIterator<I>() && SizedSentinel<S, I>() &&
+                        !detail::blocked<I, S>() && Same<V, iterator_value_t<I>>())>
+                std::ptrdiff_t read_block(I &it, S const &end, V *out, std::ptrdiff_t n)
+                {
+                    auto const left = static_cast<std::ptrdiff_t>(end - it);
+                    n = left < n ? left : n;
+                    std::ptrdiff_t const kept = this->copy_kept(std::is_trivial<V>{}, it, out, n);
+                    it += static_cast<iterator_difference_t<I>>(n);
+                    this->satisfy(it);
+                    return kept;
+                }
+                // The blocks of an underlying range whose references are values
+                // are filtered once read: the predicate sees the same values.
+                template<typename I, typename S, typename V,
+                    CONCEPT_REQUIRES_(detail::blocked<I, S>() && detail::block_readable<I, S>() &&
+                        Same<V, iterator_value_t<I>>() && Same<iterator_reference_t<I>, V>() &&
+                        Invocable<Pred &, V &>())>
+                std::ptrdiff_t read_block(I &it, S const &end, V *out, std::ptrdiff_t n)
+                {
+                    std::ptrdiff_t const k = detail::read_block(it, end, out, n);
+                    std::ptrdiff_t const kept = this->compact(std::is_trivial<V>{}, out, k);
+                    this->satisfy(it);
+                    return kept;
+                }
+                // Values that are cheap to copy are kept without a branch.
+                template<typename I, typename V>
+                std::ptrdiff_t copy_kept(std::true_type, I it, V *out, std::ptrdiff_t n)
+                {
+                    auto &pred = rng_->pred_;
+                    std::ptrdiff_t kept = 0;
+                    for(std::ptrdiff_t i = 0; i < n; ++i)
+                    {
+                        auto &&x = *(it + static_cast<iterator_difference_t<I>>(i));
+                        bool const keep = !invoke(pred, x);
+                        out[kept] = x;
+                        kept += keep;
+                    }
+                    return kept;
+                }
+                template<typename I, typename V>
+                std::ptrdiff_t copy_kept(std::false_type, I it, V *out, std::ptrdiff_t n)
+                {
+                    auto &pred = rng_->pred_;
+                    std::ptrdiff_t kept = 0;
+                    for(std::ptrdiff_t i = 0; i < n; ++i)
+                    {
+                        auto &&x = *(it + static_cast<iterator_difference_t<I>>(i));
+                        if(!invoke(pred, x))
+                            out[kept++] = x;
+                    }
+                    return kept;
+                }
+                template<typename V>
+                std::ptrdiff_t compact(std::true_type, V *out, std::ptrdiff_t n)
+                {
+                    auto &pred = rng_->pred_;
+                    std::ptrdiff_t kept = 0;
+                    for(std::ptrdiff_t i = 0; i < n; ++i)
+                    {
+                        bool const keep = !invoke(pred, out[i]);
+                        out[kept] = out[i];
+                        kept += keep;
+                    }
+                    return kept;
+                }
+                template<typename V>
+                std::ptrdiff_t compact(std::false_type, V *out, std::ptrdiff_t n)
+                {
+                    auto &pred = rng_->pred_;
+                    std::ptrdiff_t kept = 0;
+                    for(std::ptrdiff_t i = 0; i < n; ++i)
+                    {
+                        if(!invoke(pred, out[i]))
+                        {
+                            if(kept != i)
+                                out[kept] = std::move(out[i]);
+                            ++kept;
+                        }
+                    }
+                    return kept;
+                }
                 void advance() = delete;
                 void distance_to() = delete;
             };
@@ -104,6 +193,12 @@ namespace ranges
               : remove_if_view::view_adaptor{std::move(rng)}
               , pred_(std::move(pred))
             {}
+            /// At most as many elements as the underlying range has.
+            CONCEPT_REQUIRES(detail::SizeHintedRange<Rng>())
+            range_size_t<Rng> size_hint()
+            {
+                return static_cast<range_size_t<Rng>>(ranges::size_hint(this->base()));
+            }
         };
 
         namespace view
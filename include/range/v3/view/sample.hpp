@@ -18,6 +18,7 @@
 #include <range/v3/detail/satisfy_boost_range.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/view_facade.hpp>
+#include <range/v3/algorithm/aux_/sample_skip.hpp>
 #include <range/v3/algorithm/shuffle.hpp>
 #include <range/v3/utility/compressed_pair.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
@@ -29,47 +30,6 @@ namespace ranges
 {
     inline namespace v3
     {
-        /// \cond
-        namespace detail
-        {
-            template<typename Rng, bool = SizedSentinel<range_sentinel_t<Rng>, range_iterator_t<Rng>>::value>
-            class size_tracker
-            {
-                range_difference_t<Rng> size_;
-            public:
-                CONCEPT_ASSERT(ForwardRange<Rng>() || SizedRange<Rng>());
-                size_tracker() = default;
-                size_tracker(Rng &rng)
-                  : size_(ranges::distance(rng))
-                {}
-                void decrement()
-                {
-                    --size_;
-                }
-                range_difference_t<Rng> get(Rng &, range_iterator_t<Rng> &) const
-                {
-                    return size_;
-                }
-            };
-
-            // Impl for SizedSentinel (no need to store anything)
-            template<typename Rng>
-            class size_tracker<Rng, true>
-            {
-            public:
-                size_tracker() = default;
-                size_tracker(Rng &)
-                {}
-                void decrement()
-                {}
-                range_difference_t<Rng> get(Rng &rng, range_iterator_t<Rng> const &it) const
-                {
-                    return ranges::end(rng) - it;
-                }
-            };
-        }
-        /// \endcond
-
         /// \addtogroup group-views
         /// @{
 
@@ -94,40 +54,27 @@ namespace ranges
               : tagged_compressed_tuple<
                     tag::range(sample_view const *),
                     tag::current(range_iterator_t<Rng const>),
-                    tag::size(detail::size_tracker<Rng const>)>
+                    tag::size(detail::sample_skipper<D>)>
             {
                 using base_t = tagged_compressed_tuple<
                     tag::range(sample_view const*),
                     tag::current(range_iterator_t<Rng const>),
-                    tag::size(detail::size_tracker<Rng const>)>;
+                    tag::size(detail::sample_skipper<D>)>;
                 using base_t::current;
                 using base_t::range;
                 using base_t::size;
 
-                D pop_size()
-                {
-                    RANGES_EXPECT(range());
-                    return size().get(range()->range(), current());
-                }
+                // Skips to the next element of the sample: the random numbers
+                // drawn are per element of the sample, and random-access
+                // ranges jump rather than step.
                 void advance()
                 {
                     RANGES_EXPECT(range());
+                    RANGES_EXPECT(range()->size() == size().remaining());
                     if (range()->size() > 0)
                     {
-                        using Dist = std::uniform_int_distribution<D>;
-                        using Param_t = typename Dist::param_type;
-                        Dist dist{};
-                        URNG& engine = range()->engine().get();
-
-                        for (; ; ++current(), size().decrement())
-                        {
-                            RANGES_ASSERT(current() != ranges::end(range()->range()));
-                            auto n = pop_size();
-                            RANGES_EXPECT(n > 0);
-                            const Param_t interval{ 0, n - 1 };
-                            if (dist(engine, interval) < range()->size())
-                                break;
-                        }
+                        ranges::advance(current(), size().next(range()->engine().get()));
+                        RANGES_ASSERT(current() != ranges::end(range()->range()));
                     }
                 }
             public:
@@ -136,11 +83,12 @@ namespace ranges
 
                 cursor() = default;
                 explicit cursor(sample_view const &rng)
-                : base_t{&rng, ranges::begin(rng.range()), rng.range()}
+                : base_t{&rng, ranges::begin(rng.range()), detail::sample_skipper<D>{}}
                 {
-                    auto n = pop_size();
+                    auto n = ranges::distance(rng.range());
                     if (rng.size() > n)
                         rng.size() = n;
+                    size() = detail::sample_skipper<D>{n, rng.size()};
                     advance();
                 }
                 range_reference_t<Rng> read() const
@@ -159,7 +107,6 @@ namespace ranges
                     --range()->size();
                     RANGES_ASSERT(current() != ranges::end(range()->range()));
                     ++current();
-                    size().decrement();
                     advance();
                 }
             };
@@ -15,6 +15,8 @@
 #ifndef RANGES_V3_VIEW_SET_ALGORITHM_HPP
 #define RANGES_V3_VIEW_SET_ALGORITHM_HPP
 
+#include <initializer_list>
+#include <tuple>
 #include <utility>
 #include <iterator>
 #include <algorithm>
@@ -26,6 +28,8 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/view_facade.hpp>
+#include <range/v3/algorithm/aux_/gallop.hpp>
+#include <range/v3/algorithm/aux_/simd.hpp>
 #include <range/v3/utility/move.hpp>
 #include <range/v3/utility/semiregular.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -110,6 +114,14 @@ namespace ranges
                 range_iterator_t<R2> it2_;
                 range_sentinel_t<R2> end2_;
 
+                // Whether the second range is much the larger, to be galloped
+                // through to each element of the first.
+                bool gallop_ = false;
+
+                RANGES_NOINLINE void skip_less2()
+                {
+                    it2_ = detail::skip_less(std::move(it2_), end2_, it1_, pred_, proj2_, proj1_);
+                }
                 void satisfy()
                 {
                     while(it1_ != end1_)
@@ -117,6 +129,13 @@ namespace ranges
                         if(it2_ == end2_)
                             return;
 
+                        if(gallop_)
+                        {
+                            skip_less2();
+                            if(it2_ == end2_)
+                                return;
+                        }
+
                         if(invoke(pred_, invoke(proj1_, *it1_), invoke(proj2_, *it2_)))
                             return;
 
@@ -137,7 +156,8 @@ namespace ranges
                                       range_iterator_t<R1> it1, range_sentinel_t<R1> end1,
                                       range_iterator_t<R2> it2, range_sentinel_t<R2> end2)
                   : pred_(std::move(pred)), proj1_(std::move(proj1)), proj2_(std::move(proj2)),
-                    it1_(std::move(it1)), end1_(std::move(end1)), it2_(std::move(it2)), end2_(std::move(end2))
+                    it1_(std::move(it1)), end1_(std::move(end1)), it2_(std::move(it2)), end2_(std::move(end2)),
+                    gallop_(detail::gallop_through(it2_, end2_, it1_, end1_))
                 {
                     satisfy();
                 }
@@ -279,7 +299,26 @@ namespace ranges
                 range_iterator_t<R2> it2_;
                 range_sentinel_t<R2> end2_;
 
-                void satisfy()
+                // Whether one range is much the larger, for each in turn to
+                // gallop to the other's element rather than merge.
+                bool gallop_ = false;
+
+                RANGES_NOINLINE void satisfy_galloping()
+                {
+                    while(it1_ != end1_ && it2_ != end2_)
+                    {
+                        it1_ = detail::skip_less(std::move(it1_), end1_, it2_, pred_, proj1_,
+                            proj2_);
+                        if(it1_ == end1_)
+                            return;
+                        it2_ = detail::skip_less(std::move(it2_), end2_, it1_, pred_, proj2_,
+                            proj1_);
+                        if(it2_ == end2_ ||
+                            !invoke(pred_, invoke(proj1_, *it1_), invoke(proj2_, *it2_)))
+                            return;
+                    }
+                }
+                void merge(std::false_type)
                 {
                     while(it1_ != end1_ && it2_ != end2_)
                     {
@@ -294,6 +333,47 @@ namespace ranges
                         }
                     }
                 }
+                RANGES_NOINLINE void skip_unmatched()
+                {
+                    std::size_t i = 0, j = 0;
+                    detail::simd::skip_unmatched(detail::scalar_pointer(it1_),
+                        static_cast<std::size_t>(end1_ - it1_), detail::scalar_pointer(it2_),
+                        static_cast<std::size_t>(end2_ - it2_), i, j);
+                    it1_ += static_cast<range_difference_t<R1>>(i);
+                    it2_ += static_cast<range_difference_t<R2>>(j);
+                    merge(std::false_type{});
+                }
+                // Contiguous 32- and 64-bit integers that do not match within a
+                // few steps skip, a block at a time with SIMD compares, to the
+                // first block that may hold a match.
+                void merge(std::true_type)
+                {
+                    auto const n1 = end1_ - it1_;
+                    auto const n2 = end2_ - it2_;
+                    auto const lim1 = n1 > 16 ? it1_ + 16 : end1_;
+                    auto const lim2 = n2 > 16 ? it2_ + 16 : end2_;
+                    while(it1_ != lim1 && it2_ != lim2)
+                    {
+                        if(*it1_ < *it2_)
+                            ++it1_;
+                        else
+                        {
+                            if(!(*it2_ < *it1_))
+                                return;
+
+                            ++it2_;
+                        }
+                    }
+                    if(it1_ != end1_ && it2_ != end2_)
+                        skip_unmatched();
+                }
+                void satisfy()
+                {
+                    if(gallop_)
+                        return satisfy_galloping();
+                    merge(detail::scalar_intersectable<range_iterator_t<R1>, range_sentinel_t<R1>,
+                        P1, range_iterator_t<R2>, range_sentinel_t<R2>, P2, C>{});
+                }
 
             public:
                 using value_type = range_value_t<R1>;
@@ -305,7 +385,9 @@ namespace ranges
                                         range_iterator_t<R1> it1, range_sentinel_t<R1> end1,
                                         range_iterator_t<R2> it2, range_sentinel_t<R2> end2)
                   : pred_(std::move(pred)), proj1_(std::move(proj1)), proj2_(std::move(proj2)),
-                    it1_(std::move(it1)), end1_(std::move(end1)), it2_(std::move(it2)), end2_(std::move(end2))
+                    it1_(std::move(it1)), end1_(std::move(end1)), it2_(std::move(it2)), end2_(std::move(end2)),
+                    gallop_(detail::gallop_through(it1_, end1_, it2_, end2_) ||
+                        detail::gallop_through(it2_, end2_, it1_, end1_))
                 {
                     satisfy();
                 }
@@ -341,6 +423,144 @@ namespace ranges
                        (c1 >= 0 || c1 == finite) || (c2 >= 0 || c2 == finite) ? finite : unknown;
             }
 
+            // The intersection of several ranges, with Veldhuizen's leapfrog
+            // join ("Leapfrog Triejoin", ICDT 2014): each range in turn gallops
+            // to the greatest element seen so far, until they all agree. The
+            // elements are those of the first range, with the least of their
+            // multiplicities in the ranges.
+            template<typename...Rngs>
+            struct set_intersection_n_view
+              : view_facade<set_intersection_n_view<Rngs...>,
+                    (meta::or_c<(range_cardinality<Rngs>::value == unknown)...>::value ?
+                        unknown :
+                     meta::or_c<(range_cardinality<Rngs>::value >= 0 ||
+                        range_cardinality<Rngs>::value == finite)...>::value ?
+                        finite : unknown)>
+            {
+            private:
+                friend range_access;
+                using indices_t = meta::make_index_sequence<sizeof...(Rngs)>;
+                std::tuple<Rngs...> rngs_;
+
+                template<bool IsConst>
+                struct cursor
+                {
+                private:
+                    template<typename T>
+                    using constify_if = meta::invoke<meta::add_const_if_c<IsConst>, T>;
+                    using R1 = constify_if<meta::front<meta::list<Rngs...>>>;
+                    using candidate_t = common_type_t<range_value_t<constify_if<Rngs>>...>;
+
+                    std::tuple<range_iterator_t<constify_if<Rngs>>...> its_;
+                    std::tuple<range_sentinel_t<constify_if<Rngs>>...> ends_;
+
+                    // Gallops it to candidate; returns false at the end of its
+                    // range.
+                    template<typename I, typename S>
+                    static bool leap(I &it, S const &end, candidate_t &candidate, bool &raised)
+                    {
+                        ordered_less pred;
+                        ident proj;
+                        candidate_t const *const c = &candidate;
+                        it = detail::skip_less(std::move(it), end, c, pred, proj, proj);
+                        if(it == end)
+                            return false;
+                        if(candidate < *it)
+                        {
+                            candidate = *it;
+                            raised = true;
+                        }
+                        return true;
+                    }
+                    template<std::size_t...Is>
+                    bool at_end(meta::index_sequence<Is...>) const
+                    {
+                        bool end = false;
+                        (void)std::initializer_list<int>{
+                            (end = end || std::get<Is>(its_) == std::get<Is>(ends_), 0)...};
+                        return end;
+                    }
+                    template<std::size_t...Is>
+                    void satisfy(meta::index_sequence<Is...> is)
+                    {
+                        if(this->at_end(is))
+                            return;
+                        candidate_t candidate = *std::get<0>(its_);
+                        for(bool raised = true; raised;)
+                        {
+                            raised = false;
+                            bool end = false;
+                            (void)std::initializer_list<int>{
+                                (end = end || !cursor::leap(std::get<Is>(its_),
+                                    std::get<Is>(ends_), candidate, raised), 0)...};
+                            if(end)
+                                return;
+                        }
+                    }
+                    template<std::size_t...Is>
+                    void increment(meta::index_sequence<Is...>)
+                    {
+                        (void)std::initializer_list<int>{(++std::get<Is>(its_), 0)...};
+                    }
+                public:
+                    using value_type = range_value_t<R1>;
+                    using single_pass =
+                        meta::or_<SinglePass<range_iterator_t<constify_if<Rngs>>>...>;
+
+                    cursor() = default;
+                    cursor(std::tuple<range_iterator_t<constify_if<Rngs>>...> its,
+                        std::tuple<range_sentinel_t<constify_if<Rngs>>...> ends)
+                      : its_(std::move(its)), ends_(std::move(ends))
+                    {
+                        satisfy(indices_t{});
+                    }
+                    auto read() const
+                    RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                    (
+                        *std::get<0>(its_)
+                    )
+                    void next()
+                    {
+                        increment(indices_t{});
+                        satisfy(indices_t{});
+                    }
+                    bool equal(cursor const &that) const
+                    {
+                        // does not support comparing iterators from different ranges
+                        return std::get<0>(its_) == std::get<0>(that.its_);
+                    }
+                    bool equal(default_sentinel) const
+                    {
+                        return at_end(indices_t{});
+                    }
+                    auto move() const
+                    RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                    (
+                        iter_move(std::get<0>(its_))
+                    )
+                };
+
+                template<bool IsConst, typename Tuple, std::size_t...Is>
+                static cursor<IsConst> make_cursor(Tuple &rngs, meta::index_sequence<Is...>)
+                {
+                    return {std::make_tuple(ranges::begin(std::get<Is>(rngs))...),
+                            std::make_tuple(ranges::end(std::get<Is>(rngs))...)};
+                }
+                cursor<false> begin_cursor()
+                {
+                    return set_intersection_n_view::make_cursor<false>(rngs_, indices_t{});
+                }
+                CONCEPT_REQUIRES(meta::and_c<(bool)Range<Rngs const>()...>::value)
+                cursor<true> begin_cursor() const
+                {
+                    return set_intersection_n_view::make_cursor<true>(rngs_, indices_t{});
+                }
+            public:
+                set_intersection_n_view() = default;
+                explicit set_intersection_n_view(Rngs...rngs)
+                  : rngs_(std::move(rngs)...)
+                {}
+            };
         }
         /// \endcond
 
@@ -380,12 +600,44 @@ namespace ranges
                 }
 
 
+                template<typename...Rngs>
+                using NConcept = meta::and_<
+                    InputRange<Rngs>...,
+                    SemiRegular<common_type_t<range_value_t<Rngs>...>>,
+                    IndirectRelation<ordered_less,
+                        common_type_t<range_value_t<Rngs>...> const *,
+                        range_iterator_t<Rngs>>...,
+                    IndirectRelation<ordered_less, range_iterator_t<Rngs>,
+                        common_type_t<range_value_t<Rngs>...> const *>...,
+                    ConvertibleTo<range_reference_t<Rngs>,
+                        common_type_t<range_value_t<Rngs>...>>...>;
+
+                /// \overload
+                /// The intersection of three or more ranges sorted by
+                /// `ordered_less`, made by galloping each in turn to the greatest
+                /// element seen, so that the cost follows the smallest range.
+                /// The elements are those of the first range.
+                template<typename Rng1, typename Rng2, typename Rng3, typename...Rngs,
+                    CONCEPT_REQUIRES_(NConcept<Rng1, Rng2, Rng3, Rngs...>())>
+                detail::set_intersection_n_view<all_t<Rng1>, all_t<Rng2>, all_t<Rng3>,
+                    all_t<Rngs>...>
+                operator()(Rng1 && rng1, Rng2 && rng2, Rng3 && rng3, Rngs &&...rngs) const
+                {
+                    return detail::set_intersection_n_view<all_t<Rng1>, all_t<Rng2>,
+                        all_t<Rng3>, all_t<Rngs>...>{
+                            all(std::forward<Rng1>(rng1)),
+                            all(std::forward<Rng2>(rng2)),
+                            all(std::forward<Rng3>(rng3)),
+                            all(std::forward<Rngs>(rngs))...};
+                }
+
             #ifndef RANGES_DOXYGEN_INVOKED
                 template<typename Rng1, typename Rng2,
                     typename C, typename P1, typename P2,
                     typename I1 = range_iterator_t<Rng1>,
                     typename I2 = range_iterator_t<Rng2>,
-                    CONCEPT_REQUIRES_(!Concept<Rng1, Rng2, C, P1, P2>())>
+                    CONCEPT_REQUIRES_(!Concept<Rng1, Rng2, C, P1, P2>() &&
+                        !(Range<C>() && Range<P1>() && Range<P2>()))>
                 void operator()(Rng1 &&, Rng2 &&,
                     C, P1, P2) const
                 {
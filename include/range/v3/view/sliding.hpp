@@ -16,15 +16,19 @@
 #ifndef RANGES_V3_VIEW_SLIDING_HPP
 #define RANGES_V3_VIEW_SLIDING_HPP
 
+#include <cstddef>
 #include <utility>
 #include <functional>
+#include <vector>
 #include <meta/meta.hpp>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/span.hpp>
 #include <range/v3/detail/optional.hpp>
 #include <range/v3/view_adaptor.hpp>
+#include <range/v3/view_facade.hpp>
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/counted.hpp>
 #include <range/v3/view/view.hpp>
@@ -321,10 +325,104 @@ namespace ranges
             using sliding_view::sv_base::sv_base;
         };
 
+        /// The windows of an input range, which can be read only once. The
+        /// elements are read into a buffer of `capacity` elements, and each
+        /// window is a `span` of the buffer, so reading the windows allocates
+        /// nothing after the first. When a window reaches the end of the buffer,
+        /// its last `n - 1` elements are moved to the front; a larger buffer moves
+        /// them less often. A window is valid until the iterator is incremented.
+        template<typename Rng>
+        struct input_sliding_view
+          : view_facade<
+                input_sliding_view<Rng>,
+                is_infinite<Rng>::value ? infinite : is_finite<Rng>::value ? finite : unknown>
+        {
+        private:
+            CONCEPT_ASSERT(InputRange<Rng>());
+            friend range_access;
+            using value_t = range_value_t<Rng>;
+            Rng rng_;
+            range_difference_t<Rng> n_;
+            std::size_t capacity_;
+            range_iterator_t<Rng> it_;
+            std::vector<value_t> buf_;
+            // Where the window starts in the buffer.
+            std::size_t first_;
+            bool done_;
+
+            void next()
+            {
+                if(it_ == ranges::end(rng_))
+                {
+                    done_ = true;
+                    return;
+                }
+                if(buf_.size() == capacity_)
+                {
+                    buf_.erase(buf_.begin(), buf_.begin() +
+                        static_cast<std::ptrdiff_t>(first_ + 1));
+                    first_ = 0;
+                }
+                else
+                    ++first_;
+                buf_.push_back(*it_);
+                ++it_;
+            }
+            struct cursor
+            {
+            private:
+                input_sliding_view *rng_;
+            public:
+                cursor() = default;
+                explicit cursor(input_sliding_view &rng)
+                  : rng_(&rng)
+                {}
+                span<value_t> read() const
+                {
+                    return {rng_->buf_.data() + rng_->first_, rng_->n_};
+                }
+                void next()
+                {
+                    rng_->next();
+                }
+                bool equal(default_sentinel) const
+                {
+                    return rng_->done_;
+                }
+            };
+            cursor begin_cursor()
+            {
+                it_ = ranges::begin(rng_);
+                buf_.clear();
+                buf_.reserve(capacity_);
+                first_ = 0;
+                auto const end = ranges::end(rng_);
+                for(auto n = n_; n != 0 && it_ != end; --n, ++it_)
+                    buf_.push_back(*it_);
+                done_ = buf_.size() != static_cast<std::size_t>(n_);
+                return cursor{*this};
+            }
+        public:
+            input_sliding_view() = default;
+            input_sliding_view(Rng rng, range_difference_t<Rng> n)
+              : input_sliding_view(std::move(rng), n, 2 * static_cast<std::size_t>(n))
+            {}
+            input_sliding_view(Rng rng, range_difference_t<Rng> n, std::size_t capacity)
+              : rng_(std::move(rng)), n_(n), capacity_(capacity), it_{}, buf_{}, first_(0)
+              , done_(true)
+            {
+                RANGES_EXPECT(0 < n_);
+                RANGES_EXPECT(static_cast<std::size_t>(n_) <= capacity_);
+            }
+        };
+
         namespace view
         {
             // In:  Range<T>
             // Out: Range<Range<T>>, where each inner range has $n$ elements.
+            //      The windows of an input range are spans of a buffer of
+            //      `capacity` elements, by default $2n$. Forward ranges need
+            //      no buffer, and ignore the capacity.
             struct sliding_fn
             {
             private:
@@ -336,6 +434,17 @@ namespace ranges
                 (
                     make_pipeable(std::bind(sliding, std::placeholders::_1, n))
                 )
+                template<typename Int,
+                    CONCEPT_REQUIRES_(Integral<Int>())>
+                static auto bind(sliding_fn sliding, Int n, std::size_t capacity)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(sliding, std::placeholders::_1, n, capacity))
+                )
+                template<typename Rng>
+                using InputConcept = meta::strict_and<
+                    InputRange<Rng>,
+                    meta::not_<ForwardRange<Rng>>>;
             public:
                 template<typename Rng,
                     CONCEPT_REQUIRES_(ForwardRange<Rng>())>
@@ -343,6 +452,32 @@ namespace ranges
                 {
                     return {all(std::forward<Rng>(rng)), n};
                 }
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(ForwardRange<Rng>())>
+                sliding_view<all_t<Rng>> operator()(Rng && rng, range_difference_t<Rng> n,
+                    std::size_t) const
+                {
+                    return {all(std::forward<Rng>(rng)), n};
+                }
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(InputConcept<Rng>())>
+                input_sliding_view<all_t<Rng>> operator()(Rng && rng,
+                    range_difference_t<Rng> n) const
+                {
+                    return (*this)(std::forward<Rng>(rng), n, 2 * static_cast<std::size_t>(n));
+                }
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(InputConcept<Rng>())>
+                input_sliding_view<all_t<Rng>> operator()(Rng && rng,
+                    range_difference_t<Rng> n, std::size_t capacity) const
+                {
+                    CONCEPT_ASSERT_MSG(Constructible<range_value_t<Rng>,
+                            range_reference_t<Rng>>() && Movable<range_value_t<Rng>>(),
+                        "view::sliding copies the elements of an input range into a buffer, so "
+                        "their value type must be constructible from their reference type, "
+                        "and movable.");
+                    return {all(std::forward<Rng>(rng)), n, capacity};
+                }
 
                 // For the sake of better error messages:
             #ifndef RANGES_DOXYGEN_INVOKED
@@ -357,11 +492,20 @@ namespace ranges
                 }
             public:
                 template<typename Rng, typename T,
-                    CONCEPT_REQUIRES_(!(ForwardRange<Rng>() && Integral<T>()))>
+                    CONCEPT_REQUIRES_(!(InputRange<Rng>() && Integral<T>()))>
                 void operator()(Rng &&, T) const
                 {
-                    CONCEPT_ASSERT_MSG(ForwardRange<Rng>(),
-                        "The first argument to view::sliding must be a model of the ForwardRange concept");
+                    CONCEPT_ASSERT_MSG(InputRange<Rng>(),
+                        "The first argument to view::sliding must be a model of the InputRange concept");
+                    CONCEPT_ASSERT_MSG(Integral<T>(),
+                        "The second argument to view::sliding must be a model of the Integral concept");
+                }
+                template<typename Rng, typename T,
+                    CONCEPT_REQUIRES_(!(InputRange<Rng>() && Integral<T>()))>
+                void operator()(Rng &&, T, std::size_t) const
+                {
+                    CONCEPT_ASSERT_MSG(InputRange<Rng>(),
+                        "The first argument to view::sliding must be a model of the InputRange concept");
                     CONCEPT_ASSERT_MSG(Integral<T>(),
                         "The second argument to view::sliding must be a model of the Integral concept");
                 }
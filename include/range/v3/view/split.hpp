@@ -14,6 +14,8 @@
 #ifndef RANGES_V3_VIEW_SPLIT_HPP
 #define RANGES_V3_VIEW_SPLIT_HPP
 
+#include <cstring>
+#include <tuple>
 #include <utility>
 #include <type_traits>
 #include <meta/meta.hpp>
@@ -25,6 +27,7 @@
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/view_facade.hpp>
 #include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/semiregular.hpp>
 #include <range/v3/utility/static_const.hpp>
@@ -40,6 +43,39 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            // Whether the elements of [first, last) are bytes that can be
+            // searched for V with memchr.
+            template<typename I, typename V>
+            using split_memchr_t = meta::bool_<
+                is_contiguous_iterator<I>::value &&
+                std::is_same<iterator_value_t<I>, V>::value &&
+                std::is_integral<V>::value && sizeof(V) == 1 &&
+                !std::is_same<V, bool>::value>;
+
+            template<typename I, typename V>
+            I split_find(std::true_type, I first, I last, V const &val)
+            {
+                if(first == last)
+                    return last;
+                auto const p = reinterpret_cast<unsigned char const *>(std::addressof(*first));
+                void const *const q = std::memchr(p, static_cast<unsigned char>(val),
+                    static_cast<std::size_t>(last - first));
+                return q ? first + (static_cast<unsigned char const *>(q) - p) : last;
+            }
+            template<typename I, typename V>
+            I split_find(std::false_type, I first, I last, V const &val)
+            {
+                for(; first != last; ++first)
+                    if(*first == val)
+                        break;
+                return first;
+            }
+        }
+        /// \endcond
+
         /// \addtogroup group-views
         /// @{
         template<typename Rng, typename Fun>
@@ -135,6 +171,82 @@ namespace ranges
             {}
         };
 
+        /// The fields of a contiguous range between occurrences of a delimiter,
+        /// as `view::split` returns them for a contiguous range and an element
+        /// or pattern delimiter. Each delimiter is found once, with `memchr` for
+        /// ranges of bytes, and each field is a sized, contiguous subrange of
+        /// the range.
+        template<typename Rng, typename Finder>
+        struct contiguous_split_view
+          : view_facade<contiguous_split_view<Rng, Finder>, finite>
+        {
+        private:
+            friend range_access;
+            Rng rng_;
+            Finder find_;
+
+            template<typename I>
+            struct cursor
+            {
+            private:
+                Finder find_;
+                // The current field is [cur_, field_end_), and the delimiter
+                // after it is [field_end_, delim_end_), which is empty at the
+                // end of the range.
+                I cur_, field_end_, delim_end_, last_;
+
+                void find_field()
+                {
+                    if(cur_ == last_)
+                        field_end_ = delim_end_ = last_;
+                    else
+                        std::tie(field_end_, delim_end_) = find_(cur_, last_);
+                }
+            public:
+                cursor() = default;
+                cursor(Finder find, I first, I last)
+                  : find_(std::move(find)), cur_(first), last_(last)
+                {
+                    find_field();
+                }
+                iterator_range<I> read() const
+                {
+                    return {cur_, field_end_};
+                }
+                void next()
+                {
+                    RANGES_EXPECT(cur_ != last_);
+                    cur_ = delim_end_;
+                    find_field();
+                }
+                bool equal(default_sentinel) const
+                {
+                    return cur_ == last_;
+                }
+                bool equal(cursor const &that) const
+                {
+                    return cur_ == that.cur_;
+                }
+            };
+            cursor<range_iterator_t<Rng>> begin_cursor()
+            {
+                return {find_, ranges::begin(rng_), ranges::end(rng_)};
+            }
+            template<typename BaseRng = Rng,
+                CONCEPT_REQUIRES_(BoundedRange<BaseRng const>() &&
+                    RandomAccessRange<BaseRng const>())>
+            cursor<range_iterator_t<BaseRng const>> begin_cursor() const
+            {
+                return {find_, ranges::begin(rng_), ranges::end(rng_)};
+            }
+        public:
+            contiguous_split_view() = default;
+            contiguous_split_view(Rng rng, Finder find)
+              : rng_(std::move(rng))
+              , find_(std::move(find))
+            {}
+        };
+
         namespace view
         {
             struct split_fn
@@ -170,6 +282,60 @@ namespace ranges
                         return *cur == val_ ? P{true, ranges::next(cur)} : P{false, cur};
                     }
                 };
+                // Find the next delimiter in [first, last) for a
+                // contiguous_split_view, and return where it starts and ends, or
+                // {last, last} if there is none.
+                template<typename V>
+                struct element_finder
+                {
+                    V val_;
+                    template<typename I>
+                    std::pair<I, I> operator()(I first, I last) const
+                    {
+                        first = detail::split_find(detail::split_memchr_t<I, V>{},
+                            first, last, val_);
+                        return {first, first == last ? last : ranges::next(first)};
+                    }
+                };
+                template<typename SubView>
+                struct pattern_finder
+                {
+                    SubView sub_;
+                    template<typename I>
+                    std::pair<I, I> operator()(I first, I last) const
+                    {
+                        auto pat_begin = ranges::begin(sub_);
+                        auto const pat_end = ranges::end(sub_);
+                        // An empty pattern splits the range into its elements.
+                        if(pat_begin == pat_end)
+                        {
+                            ++first;
+                            return {first, first};
+                        }
+                        range_value_t<SubView> const head = *pat_begin;
+                        ++pat_begin;
+                        for(;; ++first)
+                        {
+                            first = detail::split_find(
+                                detail::split_memchr_t<I, range_value_t<SubView>>{},
+                                first, last, head);
+                            if(first == last)
+                                break;
+                            auto cur = ranges::next(first);
+                            auto pat_cur = pat_begin;
+                            for(; pat_cur != pat_end && cur != last && *cur == *pat_cur;
+                                ++cur, ++pat_cur)
+                            {}
+                            if(pat_cur == pat_end)
+                                return {first, cur};
+                            // The pattern runs off the end of the range here, so
+                            // it does at every later position too.
+                            if(cur == last)
+                                break;
+                        }
+                        return {last, last};
+                    }
+                };
                 template<typename Rng, typename Sub>
                 struct subrange_pred
                 {
@@ -224,6 +390,14 @@ namespace ranges
                     ForwardRange<Sub>,
                     EqualityComparable<range_value_t<Rng>, range_value_t<Sub>>>;
 
+                /// Ranges split by an element or a pattern into a
+                /// contiguous_split_view.
+                template<typename Rng>
+                using ContiguousConcept = meta::and_<
+                    BoundedRange<Rng>,
+                    RandomAccessRange<Rng>,
+                    is_contiguous_iterator<range_iterator_t<Rng>>>;
+
                 template<typename Rng, typename Fun,
                     CONCEPT_REQUIRES_(FunctionConcept<Rng, Fun>())>
                 split_view<all_t<Rng>, Fun> operator()(Rng && rng, Fun fun) const
@@ -237,17 +411,31 @@ namespace ranges
                     return {all(std::forward<Rng>(rng)), predicate_pred<Rng, Fun>{std::move(fun)}};
                 }
                 template<typename Rng,
-                    CONCEPT_REQUIRES_(ElementConcept<Rng>())>
+                    CONCEPT_REQUIRES_(ElementConcept<Rng>() && !ContiguousConcept<Rng>())>
                 split_view<all_t<Rng>, element_pred<Rng>> operator()(Rng && rng, range_value_t<Rng> val) const
                 {
                     return {all(std::forward<Rng>(rng)), {std::move(val)}};
                 }
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(ElementConcept<Rng>() && ContiguousConcept<Rng>())>
+                contiguous_split_view<all_t<Rng>, element_finder<range_value_t<Rng>>>
+                operator()(Rng && rng, range_value_t<Rng> val) const
+                {
+                    return {all(std::forward<Rng>(rng)), {std::move(val)}};
+                }
                 template<typename Rng, typename Sub,
-                    CONCEPT_REQUIRES_(SubRangeConcept<Rng, Sub>())>
+                    CONCEPT_REQUIRES_(SubRangeConcept<Rng, Sub>() && !ContiguousConcept<Rng>())>
                 split_view<all_t<Rng>, subrange_pred<Rng, Sub>> operator()(Rng && rng, Sub && sub) const
                 {
                     return {all(std::forward<Rng>(rng)), {std::forward<Sub>(sub)}};
                 }
+                template<typename Rng, typename Sub,
+                    CONCEPT_REQUIRES_(SubRangeConcept<Rng, Sub>() && ContiguousConcept<Rng>())>
+                contiguous_split_view<all_t<Rng>, pattern_finder<all_t<Sub>>>
+                operator()(Rng && rng, Sub && sub) const
+                {
+                    return {all(std::forward<Rng>(rng)), {all(std::forward<Sub>(sub))}};
+                }
 
             #ifndef RANGES_DOXYGEN_INVOKED
                 template<typename Rng, typename T,
@@ -281,5 +469,6 @@ namespace ranges
 }
 
 RANGES_SATISFY_BOOST_RANGE(::ranges::v3::split_view)
+RANGES_SATISFY_BOOST_RANGE(::ranges::v3::contiguous_split_view)
 
 #endif
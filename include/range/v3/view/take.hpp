@@ -14,12 +14,14 @@
 #ifndef RANGES_V3_VIEW_TAKE_HPP
 #define RANGES_V3_VIEW_TAKE_HPP
 
+#include <cstddef>
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/view_adaptor.hpp>
 #include <range/v3/algorithm/min.hpp>
+#include <range/v3/algorithm/aux_/blocks.hpp>
 #include <range/v3/detail/satisfy_boost_range.hpp>
 #include <range/v3/utility/counted_iterator.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -53,6 +55,22 @@ namespace ranges
                 {
                     return {ranges::begin(rng.base()), rng.n_};
                 }
+                // Reads a block of the underlying range no longer than the
+                // count that is left.
+                template<typename V, typename I = range_iterator_t<add_const_if<IsConst, Rng>>,
+                    CONCEPT_REQUIRES_(detail::block_readable<I, S<IsConst>>())>
+                std::ptrdiff_t read_block(CI<IsConst> &it, S<IsConst> const &end, V *out,
+                    std::ptrdiff_t n)
+                {
+                    auto const left = static_cast<std::ptrdiff_t>(it.count());
+                    if(left == 0)
+                        return 0;
+                    I base = it.base();
+                    n = detail::read_block(base, end, out, left < n ? left : n);
+                    it = CI<IsConst>{std::move(base),
+                        it.count() - static_cast<range_difference_t<Rng>>(n)};
+                    return n;
+                }
             };
 
             template<bool IsConst>
@@ -21,6 +21,7 @@
 #include <range/v3/detail/satisfy_boost_range.hpp>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/size_hint.hpp>
 #include <range/v3/view_adaptor.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/semiregular.hpp>
@@ -76,6 +77,12 @@ namespace ranges
               : iter_take_while_view::view_adaptor{std::move(rng)}
               , pred_(std::move(pred))
             {}
+            /// At most as many elements as the underlying range has.
+            CONCEPT_REQUIRES(detail::SizeHintedRange<Rng>())
+            range_size_t<Rng> size_hint()
+            {
+                return static_cast<range_size_t<Rng>>(ranges::size_hint(this->base()));
+            }
         };
 
         template<typename Rng, typename Pred>
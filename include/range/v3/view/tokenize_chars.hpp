@@ -0,0 +1,362 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_TOKENIZE_CHARS_HPP
+#define RANGES_V3_VIEW_TOKENIZE_CHARS_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <meta/meta.hpp>
+#include <range/v3/detail/satisfy_boost_range.hpp>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/iterator_range.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/view_facade.hpp>
+#include <range/v3/algorithm/aux_/simd.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// Classes of characters for `view::tokenize_chars`, in the "C" locale.
+        /// A class is an empty literal type whose `constexpr` call operator
+        /// takes a `char` and says whether it is in the class.
+        namespace char_class
+        {
+            /// \addtogroup group-views
+            /// @{
+            struct space
+            {
+                constexpr bool operator()(char c) const noexcept
+                {
+                    return c == ' ' || (c >= '\t' && c <= '\r');
+                }
+            };
+            struct blank
+            {
+                constexpr bool operator()(char c) const noexcept
+                {
+                    return c == ' ' || c == '\t';
+                }
+            };
+            struct digit
+            {
+                constexpr bool operator()(char c) const noexcept
+                {
+                    return c >= '0' && c <= '9';
+                }
+            };
+            struct xdigit
+            {
+                constexpr bool operator()(char c) const noexcept
+                {
+                    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') ||
+                        (c >= 'A' && c <= 'F');
+                }
+            };
+            struct upper
+            {
+                constexpr bool operator()(char c) const noexcept
+                {
+                    return c >= 'A' && c <= 'Z';
+                }
+            };
+            struct lower
+            {
+                constexpr bool operator()(char c) const noexcept
+                {
+                    return c >= 'a' && c <= 'z';
+                }
+            };
+            struct alpha
+            {
+                constexpr bool operator()(char c) const noexcept
+                {
+                    return upper{}(c) || lower{}(c);
+                }
+            };
+            struct alnum
+            {
+                constexpr bool operator()(char c) const noexcept
+                {
+                    return alpha{}(c) || digit{}(c);
+                }
+            };
+            struct punct
+            {
+                constexpr bool operator()(char c) const noexcept
+                {
+                    return c > ' ' && c < '\x7F' && !alnum{}(c);
+                }
+            };
+            /// The characters of identifiers: letters, digits and `'_'`.
+            struct word
+            {
+                constexpr bool operator()(char c) const noexcept
+                {
+                    return alnum{}(c) || c == '_';
+                }
+            };
+
+            /// The characters `Cs...`.
+            template<char...Cs>
+            struct any_of;
+            template<>
+            struct any_of<>
+            {
+                constexpr bool operator()(char) const noexcept
+                {
+                    return false;
+                }
+            };
+            template<char C, char...Cs>
+            struct any_of<C, Cs...>
+            {
+                constexpr bool operator()(char c) const noexcept
+                {
+                    return c == C || any_of<Cs...>{}(c);
+                }
+            };
+
+            /// The characters in any of the classes `Cs...`.
+            template<typename...Cs>
+            struct or_;
+            template<>
+            struct or_<>
+            {
+                constexpr bool operator()(char) const noexcept
+                {
+                    return false;
+                }
+            };
+            template<typename C, typename...Cs>
+            struct or_<C, Cs...>
+            {
+                constexpr bool operator()(char c) const noexcept
+                {
+                    return C{}(c) || or_<Cs...>{}(c);
+                }
+            };
+
+            /// The characters not in the class `C`.
+            template<typename C>
+            struct not_
+            {
+                constexpr bool operator()(char c) const noexcept
+                {
+                    return !C{}(c);
+                }
+            };
+            /// @}
+        }
+
+        /// \cond
+        namespace detail
+        {
+            // The members of a character class, indexed by unsigned char and
+            // computed at compile time.
+            template<typename Class, typename = meta::make_index_sequence<256>>
+            struct char_class_table;
+
+            template<typename Class, std::size_t...Is>
+            struct char_class_table<Class, meta::index_sequence<Is...>>
+            {
+                static constexpr bool value[256] =
+                    {Class{}(static_cast<char>(static_cast<unsigned char>(Is)))...};
+
+                static simd::byte_class const &bytes()
+                {
+                    static simd::byte_class const cls{
+                        [](unsigned char c) { return char_class_table::value[c]; }};
+                    return cls;
+                }
+            };
+
+            template<typename Class, std::size_t...Is>
+            constexpr bool char_class_table<Class, meta::index_sequence<Is...>>::value[256];
+
+            // Whether the characters of [I, S) can be scanned as a
+            // `char const *` range.
+            template<typename I, typename S>
+            using contiguous_chars = meta::bool_<
+                is_contiguous_iterator<I>::value && SizedSentinel<S, I>::value>;
+
+            // The first position in [first, last) whose character is a member
+            // of cls if member is true, or is not if it is false.
+            template<typename I, typename S>
+            I find_char_class(std::true_type, I first, S last,
+                simd::byte_class const &cls, bool member)
+            {
+                auto const n = static_cast<std::size_t>(last - first);
+                if(n == 0)
+                    return first;
+                auto const p = reinterpret_cast<unsigned char const *>(std::addressof(*first));
+                return first + static_cast<iterator_difference_t<I>>(
+                    simd::find_class(p, n, cls, member));
+            }
+            template<typename I, typename S>
+            I find_char_class(std::false_type, I first, S last,
+                simd::byte_class const &cls, bool member)
+            {
+                for(; first != last; ++first)
+                    if(cls(static_cast<unsigned char>(*first)) == member)
+                        break;
+                return first;
+            }
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// The maximal runs of characters of a character class in a range of
+        /// `char`, such as the words of a text for `char_class::alnum`. The
+        /// characters between them are skipped. Each token is a subrange of the
+        /// range, sized when the range is random-access. Contiguous ranges are
+        /// scanned with vector instructions where available.
+        template<typename Rng, typename Class>
+        struct tokenize_chars_view
+          : view_facade<tokenize_chars_view<Rng, Class>, finite>
+        {
+        private:
+            friend range_access;
+            Rng rng_;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                using CRng = meta::invoke<meta::add_const_if_c<IsConst>, Rng>;
+                using I = range_iterator_t<CRng>;
+                using S = range_sentinel_t<CRng>;
+                // The current token is [tok_, tok_end_); tok_ is last_ at the
+                // end.
+                I tok_, tok_end_;
+                S last_;
+
+                static I find(I first, S last, bool member)
+                {
+                    return detail::find_char_class(detail::contiguous_chars<I, S>{},
+                        std::move(first), last,
+                        detail::char_class_table<Class>::bytes(), member);
+                }
+                void find_token(I first)
+                {
+                    tok_ = cursor::find(std::move(first), last_, true);
+                    tok_end_ = tok_ == last_ ? tok_ : cursor::find(ranges::next(tok_), last_, false);
+                }
+            public:
+                cursor() = default;
+                cursor(I first, S last)
+                  : last_(last)
+                {
+                    find_token(std::move(first));
+                }
+                iterator_range<I> read() const
+                {
+                    return {tok_, tok_end_};
+                }
+                void next()
+                {
+                    RANGES_EXPECT(tok_ != last_);
+                    find_token(tok_end_);
+                }
+                bool equal(default_sentinel) const
+                {
+                    return tok_ == last_;
+                }
+                bool equal(cursor const &that) const
+                {
+                    return tok_ == that.tok_;
+                }
+            };
+            cursor<false> begin_cursor()
+            {
+                return {ranges::begin(rng_), ranges::end(rng_)};
+            }
+            CONCEPT_REQUIRES(Range<Rng const>())
+            cursor<true> begin_cursor() const
+            {
+                return {ranges::begin(rng_), ranges::end(rng_)};
+            }
+        public:
+            tokenize_chars_view() = default;
+            explicit tokenize_chars_view(Rng rng)
+              : rng_(std::move(rng))
+            {}
+        };
+
+        namespace view
+        {
+            struct tokenize_chars_fn
+            {
+            private:
+                friend view_access;
+                template<typename Class>
+                static auto bind(tokenize_chars_fn tokenize_chars, Class cls)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(tokenize_chars, std::placeholders::_1, cls))
+                )
+            public:
+                template<typename Rng, typename Class>
+                using Concept = meta::and_<
+                    ForwardRange<Rng>,
+                    Same<range_value_t<Rng>, char>,
+                    std::is_empty<Class>>;
+
+                template<typename Rng, typename Class,
+                    CONCEPT_REQUIRES_(Concept<Rng, Class>())>
+                tokenize_chars_view<all_t<Rng>, Class> operator()(Rng && rng, Class) const
+                {
+                    return tokenize_chars_view<all_t<Rng>, Class>{all(static_cast<Rng &&>(rng))};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename Class,
+                    CONCEPT_REQUIRES_(!Concept<Rng, Class>())>
+                void operator()(Rng &&, Class) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardRange<Rng>(),
+                        "The object on which view::tokenize_chars operates must be a model of "
+                        "the ForwardRange concept.");
+                    CONCEPT_ASSERT_MSG(Same<range_value_t<Rng>, char>(),
+                        "view::tokenize_chars operates on ranges of char.");
+                    CONCEPT_ASSERT_MSG(std::is_empty<Class>(),
+                        "The character class passed to view::tokenize_chars must be an empty "
+                        "type with a constexpr call operator, such as char_class::space.");
+                }
+            #endif
+            };
+
+            /// \relates tokenize_chars_fn
+            /// \ingroup group-views
+            RANGES_INLINE_VARIABLE(view<tokenize_chars_fn>, tokenize_chars)
+        }
+        /// @}
+    }
+}
+
+RANGES_SATISFY_BOOST_RANGE(::ranges::v3::tokenize_chars_view)
+
+#endif
@@ -14,6 +14,7 @@
 #ifndef RANGES_V3_VIEW_TRANSFORM_HPP
 #define RANGES_V3_VIEW_TRANSFORM_HPP
 
+#include <cstddef>
 #include <utility>
 #include <iterator>
 #include <type_traits>
@@ -21,9 +22,11 @@
 #include <range/v3/detail/satisfy_boost_range.hpp>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/size.hpp>
+#include <range/v3/size_hint.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/view_adaptor.hpp>
+#include <range/v3/algorithm/aux_/blocks.hpp>
 #include <range/v3/algorithm/max.hpp>
 #include <range/v3/algorithm/min.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -50,6 +53,15 @@ namespace ranges
                             unknown :
                             infinite;
             }
+
+            template<typename Fun>
+            struct is_indirected
+              : std::false_type
+            {};
+            template<typename Fn>
+            struct is_indirected<indirected<Fn>>
+              : std::true_type
+            {};
         }
         /// \endcond
 
@@ -88,6 +100,35 @@ namespace ranges
                 (
                     invoke(fun_, move_tag{}, it)
                 )
+                // The function is applied to a block of the underlying range in
+                // one loop: through the iterator if it is random-access, or else
+                // to a block of the underlying values if the function only
+                // dereferences its argument.
+                template<typename I, typename S, typename V,
+                    CONCEPT_REQUIRES_(RandomAccessIterator<I>() && SizedSentinel<S, I>() &&
+                        !detail::blocked<I, S>())>
+                std::ptrdiff_t read_block(I &it, S const &end, V *out, std::ptrdiff_t n)
+                {
+                    auto const left = static_cast<std::ptrdiff_t>(end - it);
+                    n = left < n ? left : n;
+                    for(std::ptrdiff_t i = 0; i < n; ++i)
+                        out[i] = invoke(fun_, it + static_cast<iterator_difference_t<I>>(i));
+                    it += static_cast<iterator_difference_t<I>>(n);
+                    return n;
+                }
+                template<typename I, typename S, typename V,
+                    typename BV = iterator_value_t<I>,
+                    CONCEPT_REQUIRES_(detail::blocked<I, S>() &&
+                        detail::is_indirected<Fun>() && detail::block_readable<I, S>() &&
+                        Invocable<Fun const &, BV *>())>
+                std::ptrdiff_t read_block(I &it, S const &end, V *out, std::ptrdiff_t n)
+                {
+                    BV buf[detail::block_size()];
+                    n = detail::read_block(it, end, buf, n);
+                    for(std::ptrdiff_t i = 0; i < n; ++i)
+                        out[i] = invoke(fun_, buf + i);
+                    return n;
+                }
             };
 
             adaptor<false> begin_adaptor()
@@ -124,6 +165,12 @@ namespace ranges
             {
                 return ranges::size(this->base());
             }
+            /// The bound on the size of the underlying range.
+            CONCEPT_REQUIRES(!SizedRange<Rng>() && detail::SizeHintedRange<Rng>())
+            range_size_t<Rng> size_hint()
+            {
+                return static_cast<range_size_t<Rng>>(ranges::size_hint(this->base()));
+            }
         };
 
         template<typename Rng, typename Fun>
@@ -14,6 +14,8 @@
 #ifndef RANGES_V3_VIEW_ZIP_WITH_HPP
 #define RANGES_V3_VIEW_ZIP_WITH_HPP
 
+#include <cstddef>
+#include <initializer_list>
 #include <tuple>
 #include <limits>
 #include <utility>
@@ -229,6 +231,44 @@ namespace ranges
                             (std::numeric_limits<difference_type>::min)(),
                             detail::max_);
                 }
+                // The elements of a block are read through the iterators in
+                // one loop when they are all random-access and know how far
+                // they are from their ends.
+                template<typename V, typename...Ends, std::size_t...Is>
+                std::ptrdiff_t read_block_(V *out, std::ptrdiff_t n,
+                    std::tuple<Ends...> const &ends, meta::index_sequence<Is...>)
+                {
+                    std::ptrdiff_t const lefts[] = {
+                        static_cast<std::ptrdiff_t>(std::get<Is>(ends) - std::get<Is>(its_))...};
+                    for(auto left : lefts)
+                        n = left < n ? left : n;
+                    for(std::ptrdiff_t i = 0; i < n; ++i)
+                        out[i] = invoke(fun_,
+                            (std::get<Is>(its_) + static_cast<range_difference_t<Rngs>>(i))...);
+                    (void)std::initializer_list<int>{
+                        (std::get<Is>(its_) += static_cast<range_difference_t<Rngs>>(n), 0)...};
+                    return n;
+                }
+                template<typename V, typename C = cursor,
+                    CONCEPT_REQUIRES_(meta::and_c<(bool)
+                        RandomAccessIterator<range_iterator_t<Rngs>>()...>::value &&
+                        meta::and_c<(bool)
+                        SizedSentinel<range_iterator_t<Rngs>, range_iterator_t<Rngs>>()...>::value)>
+                std::ptrdiff_t read_block(V *out, std::ptrdiff_t n, C const &end)
+                {
+                    return this->read_block_(out, n, end.its_,
+                        meta::make_index_sequence<sizeof...(Rngs)>{});
+                }
+                template<typename V,
+                    CONCEPT_REQUIRES_(meta::and_c<(bool)
+                        RandomAccessIterator<range_iterator_t<Rngs>>()...>::value &&
+                        meta::and_c<(bool)
+                        SizedSentinel<range_sentinel_t<Rngs>, range_iterator_t<Rngs>>()...>::value)>
+                std::ptrdiff_t read_block(V *out, std::ptrdiff_t n, sentinel const &end)
+                {
+                    return this->read_block_(out, n, end.ends_,
+                        meta::make_index_sequence<sizeof...(Rngs)>{});
+                }
                 template<std::size_t...Is>
                 auto move_(meta::index_sequence<Is...>) const
                 RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
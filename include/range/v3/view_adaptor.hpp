@@ -283,6 +283,22 @@ namespace ranges
             {
                 second().advance(first(), n);
             }
+            // If the adaptor can read a block of elements, pass it the
+            // underlying end.
+            template<typename V, typename A = Adapt, typename = decltype(
+                std::declval<A &>().read_block(std::declval<BaseIter &>(),
+                    std::declval<BaseIter const &>(), std::declval<V *>(), std::ptrdiff_t{}))>
+            std::ptrdiff_t read_block(V *out, std::ptrdiff_t n, adaptor_cursor const &end)
+            {
+                return second().read_block(first(), end.first(), out, n);
+            }
+            template<typename V, typename S, typename A, typename Ad = Adapt, typename = decltype(
+                std::declval<Ad &>().read_block(std::declval<BaseIter &>(),
+                    std::declval<S const &>(), std::declval<V *>(), std::ptrdiff_t{}))>
+            std::ptrdiff_t read_block(V *out, std::ptrdiff_t n, adaptor_sentinel<S, A> const &end)
+            {
+                return second().read_block(first(), end.first(), out, n);
+            }
             template<typename A = Adapt, typename R = decltype(
                 std::declval<A const &>().distance_to(
                     std::declval<BaseIter const &>(),
@@ -0,0 +1,89 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Cost of iterating an any_view compared with the concrete view it erases,
+// the baseline, and of copying its iterators.
+//
+// Usage: any_view [--n=<elements>] [--json] ...   (default 10M; see bench.hpp)
+
+#include <cstddef>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/any_view.hpp>
+#include <range/v3/view/transform.hpp>
+#include "./bench.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    template<typename Rng>
+    long long sum(Rng &&rng)
+    {
+        long long s = 0;
+        for(auto i = ranges::begin(rng), e = ranges::end(rng); i != e; ++i)
+            s += *i;
+        return s;
+    }
+
+    // Copy an iterator at every step, as algorithms that remember a position
+    // (max_element, adjacent_find, ...) do.
+    template<typename Rng>
+    long long sum_copying(Rng &&rng)
+    {
+        long long s = 0;
+        auto i = ranges::begin(rng);
+        auto const e = ranges::end(rng);
+        while(i != e)
+        {
+            auto j = i;
+            s += *j;
+            i = ++j;
+        }
+        return s;
+    }
+
+    struct twice
+    {
+        int operator()(int i) const { return 2 * i; }
+    };
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    bench::suite s("any_view", bench::parse_options(argc, argv, 10000000));
+    std::size_t const n = s.n();
+    std::size_t const bytes = n * sizeof(int);
+    std::vector<int> vec(n);
+    for(std::size_t i = 0; i < n; ++i)
+        vec[i] = static_cast<int>(i % 1000);
+
+    auto concrete = vec | view::transform(twice{});
+    any_view<int> input = concrete;
+    any_view<int, category::forward> forward = concrete;
+    any_random_access_view<int> random_access = concrete;
+
+    s.run("iterate", "concrete", bytes, [&] { return sum(concrete); });
+    s.run("iterate", "input", bytes, [&] { return sum(input); });
+    s.run("iterate", "forward", bytes, [&] { return sum(forward); });
+    s.run("iterate", "random", bytes, [&] { return sum(random_access); });
+
+    s.run("iterate copying iterators", "concrete", bytes, [&] {
+        return sum_copying(concrete);
+    });
+    s.run("iterate copying iterators", "forward", bytes, [&] {
+        return sum_copying(forward);
+    });
+
+    return s.finish();
+}
@@ -0,0 +1,257 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// A small harness for the programs in perf/. Each benchmark is run a few times
+// to warm up, and then timed over a number of runs; the median and the 95th
+// percentile of the runs are reported, with the bytes of input processed per
+// second at the median. Benchmarks come in variants, run one after the other:
+// first the baseline, "loop" for a hand-written loop, or "std" for the standard
+// library's algorithm where a loop would only reimplement it, and then "range"
+// for the same computation with range-v3. Programs that compare other things
+// name their variants after them; the first is still the baseline. The table
+// shows the ratio of each variant to the baseline.
+//
+// The programs take the options
+//
+//     --n=<elements>     the size of the inputs
+//     --reps=<runs>      the timed runs of each benchmark   (default 21)
+//     --warmup=<runs>    the untimed runs before them       (default 3)
+//     --filter=<text>    run only the benchmarks whose names contain it
+//     --json             print the results as JSON, for comparing releases
+//
+// and those that say so in their usage also take arguments that are not
+// options, such as a file to read.
+//
+// The JSON output is an object with the suite's name, its options and an array
+// of results, each with the benchmark's name, variant, median_ns, p95_ns and
+// bytes_per_sec.
+
+#ifndef RANGES_PERF_BENCH_HPP
+#define RANGES_PERF_BENCH_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench
+{
+    // Makes the compiler assume that the value is read, and that any memory
+    // may have changed, so that a benchmark's work is neither discarded nor
+    // hoisted out of the loop of runs.
+    template<typename T>
+    inline void keep(T const &value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __asm__ __volatile__("" : : "r"(&value) : "memory");
+#else
+        static void const *volatile sink;
+        sink = &value;
+#endif
+    }
+
+    struct options
+    {
+        std::size_t n;
+        int reps = 21;
+        int warmup = 3;
+        bool json = false;
+        std::string filter;
+        // The arguments that are not options, if the program takes any.
+        std::vector<std::string> args;
+    };
+
+    // Exits with the usage if an argument is not an option, unless args_usage
+    // describes the program's other arguments.
+    inline options parse_options(int argc, char *argv[], std::size_t default_n,
+        char const *args_usage = nullptr)
+    {
+        options opts;
+        opts.n = default_n;
+        for(int i = 1; i < argc; ++i)
+        {
+            std::string const arg = argv[i];
+            auto value = [&](char const *name) -> char const *
+            {
+                std::size_t const len = std::strlen(name);
+                return arg.compare(0, len, name) == 0 ? argv[i] + len : nullptr;
+            };
+            char const *v = nullptr;
+            if(arg == "--json")
+                opts.json = true;
+            else if((v = value("--n=")))
+                opts.n = std::strtoull(v, nullptr, 10);
+            else if((v = value("--reps=")))
+                opts.reps = std::max(1, std::atoi(v));
+            else if((v = value("--warmup=")))
+                opts.warmup = std::max(0, std::atoi(v));
+            else if((v = value("--filter=")))
+                opts.filter = v;
+            else if(args_usage && arg.compare(0, 2, "--") != 0)
+                opts.args.push_back(arg);
+            else
+            {
+                std::cerr << "usage: " << argv[0] << " [--n=<elements>] [--reps=<runs>]"
+                    " [--warmup=<runs>] [--filter=<text>] [--json]";
+                if(args_usage)
+                    std::cerr << ' ' << args_usage;
+                std::cerr << '\n';
+                std::exit(2);
+            }
+        }
+        return opts;
+    }
+
+    struct result
+    {
+        std::string name;
+        std::string variant;
+        double median_ns;
+        double p95_ns;
+        double bytes_per_sec;
+    };
+
+    class suite
+    {
+        std::string name_;
+        options opts_;
+        std::vector<result> results_;
+
+        using clock_t = std::chrono::steady_clock;
+
+        static std::string quoted(std::string const &s)
+        {
+            std::string q = "\"";
+            for(char c : s)
+            {
+                if(c == '"' || c == '\\')
+                    q += '\\';
+                q += c;
+            }
+            return q += '"';
+        }
+
+        void print(result const &r) const
+        {
+            std::cout << std::left << std::setw(32) << r.name << std::setw(8) << r.variant
+                      << std::right << std::fixed << std::setprecision(3)
+                      << std::setw(12) << r.median_ns * 1e-6
+                      << std::setw(12) << r.p95_ns * 1e-6
+                      << std::setw(12) << std::setprecision(1) << r.bytes_per_sec * 1e-6;
+            // The ratio to the baseline, the first variant of the benchmark.
+            result const *base = nullptr;
+            for(auto it = results_.rbegin(); it != results_.rend() && it->name == r.name; ++it)
+                base = &*it;
+            if(base && base->median_ns > 0)
+            {
+                double const ratio = r.median_ns / base->median_ns;
+                std::cout << std::setw(10) << std::setprecision(ratio < 0.1 ? 4 : 2)
+                          << ratio << 'x';
+            }
+            std::cout << '\n';
+        }
+
+    public:
+        suite(std::string name, options opts)
+          : name_(std::move(name)), opts_(std::move(opts))
+        {
+            if(!opts_.json)
+                std::cout << name_ << ": " << opts_.n << " elements, median and p95 of "
+                          << opts_.reps << " runs\n\n"
+                          << std::left << std::setw(40) << "benchmark" << std::right
+                          << std::setw(12) << "median ms" << std::setw(12) << "p95 ms"
+                          << std::setw(12) << "MB/s" << std::setw(11) << "vs base" << "\n";
+        }
+
+        std::size_t n() const
+        {
+            return opts_.n;
+        }
+
+        // Times f(), which processes `bytes` of input. Before each run,
+        // setup() is called untimed, to restore the input of benchmarks
+        // that modify it.
+        template<typename Setup, typename F>
+        void run(std::string const &name, std::string const &variant, std::size_t bytes,
+            Setup setup, F f)
+        {
+            if(!opts_.filter.empty() && name.find(opts_.filter) == std::string::npos)
+                return;
+            for(int i = 0; i < opts_.warmup; ++i)
+            {
+                setup();
+                keep(f());
+            }
+            std::vector<double> times;
+            times.reserve(static_cast<std::size_t>(opts_.reps));
+            for(int i = 0; i < opts_.reps; ++i)
+            {
+                setup();
+                keep(i);
+                auto const start = clock_t::now();
+                keep(f());
+                std::chrono::duration<double, std::nano> const t = clock_t::now() - start;
+                times.push_back(t.count());
+            }
+            std::sort(times.begin(), times.end());
+            std::size_t const last = times.size() - 1;
+            result r;
+            r.name = name;
+            r.variant = variant;
+            r.median_ns = times[last / 2];
+            r.p95_ns = times[(last * 95 + 99) / 100];
+            r.bytes_per_sec = r.median_ns > 0 ? double(bytes) / (r.median_ns * 1e-9) : 0;
+            if(!opts_.json)
+                print(r);
+            results_.push_back(r);
+        }
+
+        template<typename F>
+        void run(std::string const &name, std::string const &variant, std::size_t bytes, F f)
+        {
+            run(name, variant, bytes, []{}, f);
+        }
+
+        // Prints the JSON results, if they were asked for.
+        int finish() const
+        {
+            if(!opts_.json)
+                return 0;
+            std::cout << "{\n  \"suite\": " << quoted(name_)
+                      << ",\n  \"elements\": " << opts_.n
+                      << ",\n  \"reps\": " << opts_.reps
+                      << ",\n  \"warmup\": " << opts_.warmup
+                      << ",\n  \"results\": [";
+            std::cout << std::fixed << std::setprecision(1);
+            for(std::size_t i = 0; i < results_.size(); ++i)
+            {
+                result const &r = results_[i];
+                std::cout << (i == 0 ? "\n" : ",\n")
+                          << "    {\"name\": " << quoted(r.name)
+                          << ", \"variant\": " << quoted(r.variant)
+                          << ", \"median_ns\": " << r.median_ns
+                          << ", \"p95_ns\": " << r.p95_ns
+                          << ", \"bytes_per_sec\": " << r.bytes_per_sec << "}";
+            }
+            std::cout << "\n  ]\n}\n";
+            return 0;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,269 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// The actions over std::vector<std::uint32_t>s, compared with the same edits
+// written with the vector's members and the standard algorithms. Each run is
+// given a fresh copy of the input.
+//
+// Usage: bench_actions [--n=<elements>] [--json] ...   (default 4M; see bench.hpp)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+#include <range/v3/action.hpp>
+#include <range/v3/action/radix_sort.hpp>
+#include <range/v3/core.hpp>
+#include "./bench.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    using u32 = std::uint32_t;
+
+    struct scale
+    {
+        u32 operator()(u32 i) const
+        {
+            return i * 3u + 1u;
+        }
+    };
+
+    struct even
+    {
+        bool operator()(u32 i) const
+        {
+            return i % 2u == 0u;
+        }
+    };
+
+    struct below
+    {
+        u32 limit;
+        bool operator()(u32 i) const
+        {
+            return i < limit;
+        }
+    };
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    bench::suite s("bench_actions", bench::parse_options(argc, argv, std::size_t(1) << 22));
+    std::size_t const n = s.n();
+    std::size_t const bytes = n * sizeof(u32);
+    u32 const half = static_cast<u32>(n / 2);
+    using D = std::ptrdiff_t;
+
+    // Scrambled, so that which values are removed is hard to predict.
+    std::vector<u32> v(n), w(n), seq(n), runs(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        v[i] = static_cast<u32>(i) * 2654435761u >> 7;
+        w[i] = static_cast<u32>(i % 7);
+        seq[i] = static_cast<u32>(i);
+        runs[i] = static_cast<u32>(i / 4);
+    }
+    std::vector<u32> const small(w.begin(), w.begin() + std::min<std::size_t>(n, 1000));
+    std::vector<std::vector<u32>> rows(n / 1000 + 1);
+    for(std::size_t i = 0; i < n; ++i)
+        rows[i / 1000].push_back(v[i]);
+
+    std::vector<u32> work;
+    std::vector<std::vector<u32>> work_rows;
+    auto reset = [&] { work = v; };
+    auto reset_seq = [&] { work = seq; };
+    auto reset_runs = [&] { work = runs; };
+    auto reset_rows = [&] { work_rows = rows; };
+
+    // Sorting
+    s.run("sort", "std", bytes, reset, [&] {
+        std::sort(work.begin(), work.end());
+        return work.size();
+    });
+    s.run("sort", "range", bytes, reset, [&] {
+        work |= action::sort;
+        return work.size();
+    });
+
+    s.run("stable_sort", "std", bytes, reset, [&] {
+        std::stable_sort(work.begin(), work.end());
+        return work.size();
+    });
+    s.run("stable_sort", "range", bytes, reset, [&] {
+        work |= action::stable_sort;
+        return work.size();
+    });
+
+    s.run("radix_sort", "std", bytes, reset, [&] {
+        std::sort(work.begin(), work.end());
+        return work.size();
+    });
+    s.run("radix_sort", "range", bytes, reset, [&] {
+        work |= action::radix_sort;
+        return work.size();
+    });
+
+    s.run("shuffle", "std", bytes, reset, [&] {
+        std::mt19937 gen(5489u);
+        std::shuffle(work.begin(), work.end(), gen);
+        return work.size();
+    });
+    s.run("shuffle", "range", bytes, reset, [&] {
+        std::mt19937 gen(5489u);
+        work |= action::shuffle(gen);
+        return work.size();
+    });
+    s.run("shuffle", "par", bytes, reset, [&] {
+        std::mt19937 gen(5489u);
+        work |= action::shuffle(par, gen);
+        return work.size();
+    });
+
+    // Removing elements
+    s.run("unique", "std", bytes, reset_runs, [&] {
+        work.erase(std::unique(work.begin(), work.end()), work.end());
+        return work.size();
+    });
+    s.run("unique", "range", bytes, reset_runs, [&] {
+        work |= action::unique;
+        return work.size();
+    });
+
+    s.run("remove_if", "std", bytes, reset, [&] {
+        work.erase(std::remove_if(work.begin(), work.end(), even{}), work.end());
+        return work.size();
+    });
+    s.run("remove_if", "range", bytes, reset, [&] {
+        work |= action::remove_if(even{});
+        return work.size();
+    });
+
+    s.run("stride", "loop", bytes, reset, [&] {
+        std::size_t j = 0;
+        for(std::size_t i = 0; i < work.size(); i += 4)
+            work[j++] = work[i];
+        work.resize(j);
+        return work.size();
+    });
+    s.run("stride", "range", bytes, reset, [&] {
+        work |= action::stride(4);
+        return work.size();
+    });
+
+    s.run("take", "loop", bytes, reset, [&] {
+        work.resize(n / 2);
+        return work.size();
+    });
+    s.run("take", "range", bytes, reset, [&] {
+        work |= action::take(D(n / 2));
+        return work.size();
+    });
+
+    s.run("take_while", "loop", bytes, reset_seq, [&] {
+        work.erase(std::find_if_not(work.begin(), work.end(), below{half}), work.end());
+        return work.size();
+    });
+    s.run("take_while", "range", bytes, reset_seq, [&] {
+        work |= action::take_while(below{half});
+        return work.size();
+    });
+
+    s.run("drop", "loop", bytes, reset, [&] {
+        work.erase(work.begin(), work.begin() + D(n / 2));
+        return work.size();
+    });
+    s.run("drop", "range", bytes, reset, [&] {
+        work |= action::drop(D(n / 2));
+        return work.size();
+    });
+
+    s.run("drop_while", "loop", bytes, reset_seq, [&] {
+        work.erase(work.begin(), std::find_if_not(work.begin(), work.end(), below{half}));
+        return work.size();
+    });
+    s.run("drop_while", "range", bytes, reset_seq, [&] {
+        work |= action::drop_while(below{half});
+        return work.size();
+    });
+
+    s.run("slice", "loop", bytes, reset, [&] {
+        work.erase(work.begin() + D(3 * n / 4), work.end());
+        work.erase(work.begin(), work.begin() + D(n / 4));
+        return work.size();
+    });
+    s.run("slice", "range", bytes, reset, [&] {
+        work |= action::slice(D(n / 4), D(3 * n / 4));
+        return work.size();
+    });
+
+    // Changing and adding elements
+    s.run("transform", "loop", bytes, reset, [&] {
+        for(u32 &x : work)
+            x = x * 3u + 1u;
+        return work.size();
+    });
+    s.run("transform", "range", bytes, reset, [&] {
+        work |= action::transform(scale{});
+        return work.size();
+    });
+
+    s.run("push_back", "std", bytes, reset, [&] {
+        work.insert(work.end(), w.begin(), w.end());
+        return work.size();
+    });
+    s.run("push_back", "range", bytes, reset, [&] {
+        work |= action::push_back(w);
+        return work.size();
+    });
+
+    s.run("push_front", "std", bytes, reset, [&] {
+        work.insert(work.begin(), small.begin(), small.end());
+        return work.size();
+    });
+    s.run("push_front", "range", bytes, reset, [&] {
+        work |= action::push_front(small);
+        return work.size();
+    });
+
+    // Ranges of ranges
+    s.run("join", "loop", bytes, reset_rows, [&] {
+        std::vector<u32> flat;
+        for(auto const &row : work_rows)
+            flat.insert(flat.end(), row.begin(), row.end());
+        return flat.size();
+    });
+    s.run("join", "range", bytes, reset_rows, [&] {
+        std::vector<u32> const flat = std::move(work_rows) | action::join;
+        return flat.size();
+    });
+
+    s.run("split", "loop", bytes, [&] {
+        std::vector<std::vector<u32>> parts;
+        auto it = w.begin();
+        while(it != w.end())
+        {
+            auto const next = std::find(it, w.end(), 0u);
+            if(next != it)
+                parts.emplace_back(it, next);
+            it = next == w.end() ? next : next + 1;
+        }
+        return parts.size();
+    });
+    s.run("split", "range", bytes, [&] { return action::split(w, 0u).size(); });
+
+    return s.finish();
+}
@@ -0,0 +1,1041 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// The algorithms over std::vector<std::uint32_t>s, compared with hand-written
+// loops, or with the standard library's algorithm where a loop would only
+// reimplement it, and with ranges::par where the algorithm takes it. The random
+// algorithms also run with ranges::xoshiro256starstar in place of
+// std::mt19937. The algorithms that modify their input are given a fresh copy
+// before each run.
+//
+// Usage: bench_algorithms [--n=<elements>] [--json] ...   (default 4M; see bench.hpp)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+#include <range/v3/algorithm.hpp>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/utility/random.hpp>
+#include "./bench.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    using u32 = std::uint32_t;
+
+    // Not in any of the inputs.
+    constexpr u32 absent = 0xffffffffu;
+
+    struct scale
+    {
+        u32 operator()(u32 i) const
+        {
+            return i * 3u + 1u;
+        }
+    };
+
+    struct even
+    {
+        bool operator()(u32 i) const
+        {
+            return i % 2u == 0u;
+        }
+    };
+
+    struct below
+    {
+        u32 limit;
+        bool operator()(u32 i) const
+        {
+            return i < limit;
+        }
+    };
+
+    struct is_absent
+    {
+        bool operator()(u32 i) const
+        {
+            return i == absent;
+        }
+    };
+
+    struct counter
+    {
+        u32 i = 0;
+        u32 operator()()
+        {
+            return i++;
+        }
+    };
+
+    // The distinct values of n drawn from [0, range), sorted.
+    std::vector<u32> sorted_draws(std::size_t n, u32 range, std::mt19937 &gen)
+    {
+        std::uniform_int_distribution<u32> dist(0u, range - 1u);
+        std::vector<u32> v(n);
+        for(u32 &x : v)
+            x = dist(gen);
+        std::sort(v.begin(), v.end());
+        v.erase(std::unique(v.begin(), v.end()), v.end());
+        return v;
+    }
+
+    std::size_t merge_intersection(std::vector<u32> const &a, std::vector<u32> const &b,
+        std::vector<u32> &out)
+    {
+        std::size_t i = 0, j = 0, k = 0;
+        while(i < a.size() && j < b.size())
+        {
+            if(a[i] < b[j])
+                ++i;
+            else if(b[j] < a[i])
+                ++j;
+            else
+                out[k++] = a[i], ++i, ++j;
+        }
+        return k;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    bench::suite s("bench_algorithms",
+        bench::parse_options(argc, argv, std::size_t(1) << 22));
+    std::size_t const n = s.n();
+    std::size_t const bytes = n * sizeof(u32);
+    u32 const half = static_cast<u32>(n / 2);
+
+    // Scrambled, so that which values are selected is hard to predict.
+    std::vector<u32> v(n), w(n), seq(n), runs(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        v[i] = static_cast<u32>(i) * 2654435761u >> 7;
+        w[i] = static_cast<u32>(i % 7);
+        seq[i] = static_cast<u32>(i);
+        runs[i] = static_cast<u32>(i / 4);
+    }
+    std::vector<u32> const v2 = v;
+    std::vector<u32> work(n), out(n);
+    auto reset = [&] { std::copy(v.begin(), v.end(), work.begin()); };
+    auto reset_w = [&] { std::copy(w.begin(), w.end(), work.begin()); };
+    auto reset_runs = [&] { std::copy(runs.begin(), runs.end(), work.begin()); };
+    // Sorted, for the searches and the set algorithms: multiples of 2, 3 and 6.
+    std::vector<u32> twos(n / 2), threes(n / 3), sixes(n / 6);
+    for(std::size_t i = 0; i < twos.size(); ++i)
+        twos[i] = static_cast<u32>(2 * i);
+    for(std::size_t i = 0; i < threes.size(); ++i)
+        threes[i] = static_cast<u32>(3 * i);
+    for(std::size_t i = 0; i < sixes.size(); ++i)
+        sixes[i] = static_cast<u32>(6 * i);
+    std::size_t const set_bytes = (twos.size() + threes.size()) * sizeof(u32);
+    // Two sorted halves, for inplace_merge.
+    std::vector<u32> halves(n);
+    for(std::size_t i = 0; i < n / 2; ++i)
+        halves[i] = static_cast<u32>(2 * i);
+    for(std::size_t i = n / 2; i < n; ++i)
+        halves[i] = static_cast<u32>(2 * (i - n / 2) + 1);
+    auto reset_halves = [&] { std::copy(halves.begin(), halves.end(), work.begin()); };
+    std::vector<u32> queries(n / 16);
+    for(std::size_t i = 0; i < queries.size(); ++i)
+        queries[i] = v[i] % static_cast<u32>(n);
+    std::size_t const query_bytes = queries.size() * sizeof(u32);
+    std::vector<u32> const needles = {absent, absent - 1, absent - 2, absent - 3};
+    std::vector<u32> const pattern = {u32(n - 3), u32(n - 2), u32(n - 1)};
+
+    // Numeric
+    s.run("accumulate", "loop", bytes, [&] {
+        u32 t = 0;
+        for(u32 x : v)
+            t += x;
+        return t;
+    });
+    s.run("accumulate", "range", bytes, [&] { return ranges::accumulate(v, u32(0)); });
+    s.run("accumulate", "par", bytes, [&] {
+        return ranges::accumulate(ranges::par, v, u32(0));
+    });
+
+    // Non-modifying
+    s.run("for_each", "loop", bytes, [&] {
+        u32 t = 0;
+        for(u32 x : v)
+            t += x;
+        return t;
+    });
+    s.run("for_each", "range", bytes, [&] {
+        u32 t = 0;
+        ranges::for_each(v, [&t](u32 x) { t += x; });
+        return t;
+    });
+
+    s.run("count", "loop", bytes, [&] {
+        std::size_t c = 0;
+        for(u32 x : w)
+            c += x == 3u;
+        return c;
+    });
+    s.run("count", "range", bytes, [&] { return ranges::count(w, 3u); });
+
+    s.run("count_if", "loop", bytes, [&] {
+        std::size_t c = 0;
+        for(u32 x : v)
+            c += x % 2u == 0u;
+        return c;
+    });
+    s.run("count_if", "range", bytes, [&] { return ranges::count_if(v, even{}); });
+    s.run("count_if", "par", bytes, [&] { return ranges::count_if(ranges::par, v, even{}); });
+
+    s.run("find", "loop", bytes, [&] {
+        std::size_t i = 0;
+        while(i < n && v[i] != absent)
+            ++i;
+        return i;
+    });
+    s.run("find", "range", bytes, [&] { return ranges::find(v, absent) - v.begin(); });
+
+    s.run("find_if", "loop", bytes, [&] {
+        std::size_t i = 0;
+        while(i < n && v[i] != absent)
+            ++i;
+        return i;
+    });
+    s.run("find_if", "range", bytes, [&] {
+        return ranges::find_if(v, is_absent{}) - v.begin();
+    });
+    s.run("find_if", "par", bytes, [&] {
+        return ranges::find_if(ranges::par, v, is_absent{}) - v.begin();
+    });
+
+    s.run("find_if_not", "loop", bytes, [&] {
+        std::size_t i = 0;
+        while(i < n && seq[i] < u32(n))
+            ++i;
+        return i;
+    });
+    s.run("find_if_not", "range", bytes, [&] {
+        return ranges::find_if_not(seq, below{u32(n)}) - seq.begin();
+    });
+
+    s.run("find_first_of", "loop", bytes, [&] {
+        std::size_t i = 0;
+        for(; i < n; ++i)
+            if(v[i] == needles[0] || v[i] == needles[1] || v[i] == needles[2] ||
+               v[i] == needles[3])
+                break;
+        return i;
+    });
+    s.run("find_first_of", "range", bytes, [&] {
+        return ranges::find_first_of(v, needles) - v.begin();
+    });
+
+    s.run("adjacent_find", "loop", bytes, [&] {
+        std::size_t i = 1;
+        while(i < n && seq[i - 1] != seq[i])
+            ++i;
+        return i;
+    });
+    s.run("adjacent_find", "range", bytes, [&] {
+        return ranges::adjacent_find(seq) - seq.begin();
+    });
+
+    s.run("all_of", "loop", bytes, [&] {
+        bool b = true;
+        for(u32 x : seq)
+            if(!(x < u32(n)))
+            {
+                b = false;
+                break;
+            }
+        return b;
+    });
+    s.run("all_of", "range", bytes, [&] { return ranges::all_of(seq, below{u32(n)}); });
+
+    s.run("any_of", "loop", bytes, [&] {
+        bool b = false;
+        for(u32 x : v)
+            if(x == absent)
+            {
+                b = true;
+                break;
+            }
+        return b;
+    });
+    s.run("any_of", "range", bytes, [&] { return ranges::any_of(v, is_absent{}); });
+
+    s.run("none_of", "loop", bytes, [&] {
+        bool b = true;
+        for(u32 x : v)
+            if(x == absent)
+            {
+                b = false;
+                break;
+            }
+        return b;
+    });
+    s.run("none_of", "range", bytes, [&] { return ranges::none_of(v, is_absent{}); });
+
+    s.run("min_element", "loop", bytes, [&] {
+        std::size_t m = 0;
+        for(std::size_t i = 1; i < n; ++i)
+            if(v[i] < v[m])
+                m = i;
+        return m;
+    });
+    s.run("min_element", "range", bytes, [&] {
+        return ranges::min_element(v) - v.begin();
+    });
+
+    s.run("max_element", "loop", bytes, [&] {
+        std::size_t m = 0;
+        for(std::size_t i = 1; i < n; ++i)
+            if(v[m] < v[i])
+                m = i;
+        return m;
+    });
+    s.run("max_element", "range", bytes, [&] {
+        return ranges::max_element(v) - v.begin();
+    });
+
+    s.run("minmax_element", "loop", bytes, [&] {
+        std::size_t lo = 0, hi = 0;
+        for(std::size_t i = 1; i < n; ++i)
+        {
+            if(v[i] < v[lo])
+                lo = i;
+            if(!(v[i] < v[hi]))
+                hi = i;
+        }
+        return lo + hi;
+    });
+    s.run("minmax_element", "range", bytes, [&] {
+        auto const p = ranges::minmax_element(v);
+        return (p.first - v.begin()) + (p.second - v.begin());
+    });
+
+    s.run("equal", "loop", 2 * bytes, [&] {
+        std::size_t i = 0;
+        while(i < n && v[i] == v2[i])
+            ++i;
+        return i == n;
+    });
+    s.run("equal", "range", 2 * bytes, [&] { return ranges::equal(v, v2); });
+
+    s.run("mismatch", "loop", 2 * bytes, [&] {
+        std::size_t i = 0;
+        while(i < n && v[i] == v2[i])
+            ++i;
+        return i;
+    });
+    s.run("mismatch", "range", 2 * bytes, [&] {
+        return ranges::mismatch(v, v2).first - v.begin();
+    });
+
+    s.run("lexicographical_compare", "loop", 2 * bytes, [&] {
+        std::size_t i = 0;
+        while(i < n && v[i] == v2[i])
+            ++i;
+        return i < n && v[i] < v2[i];
+    });
+    s.run("lexicographical_compare", "range", 2 * bytes, [&] {
+        return ranges::lexicographical_compare(v, v2);
+    });
+
+    s.run("search", "std", bytes, [&] {
+        return std::search(seq.begin(), seq.end(), pattern.begin(), pattern.end()) -
+            seq.begin();
+    });
+    s.run("search", "range", bytes, [&] { return ranges::search(seq, pattern) - seq.begin(); });
+
+    s.run("find_end", "std", bytes, [&] {
+        return std::find_end(w.begin(), w.end(), pattern.begin(), pattern.end()) - w.begin();
+    });
+    s.run("find_end", "range", bytes, [&] { return ranges::find_end(w, pattern) - w.begin(); });
+
+    s.run("search_n", "std", bytes, [&] {
+        return std::search_n(runs.begin(), runs.end(), 5, runs.back()) - runs.begin();
+    });
+    s.run("search_n", "range", bytes, [&] {
+        return ranges::search_n(runs, 5, runs.back()) - runs.begin();
+    });
+
+    s.run("is_sorted", "loop", bytes, [&] {
+        std::size_t i = 1;
+        while(i < n && !(seq[i] < seq[i - 1]))
+            ++i;
+        return i == n;
+    });
+    s.run("is_sorted", "range", bytes, [&] { return ranges::is_sorted(seq); });
+
+    s.run("is_partitioned", "loop", bytes, [&] {
+        std::size_t i = 0;
+        while(i < n && seq[i] < half)
+            ++i;
+        while(i < n && !(seq[i] < half))
+            ++i;
+        return i == n;
+    });
+    s.run("is_partitioned", "range", bytes, [&] {
+        return ranges::is_partitioned(seq, below{half});
+    });
+
+    // Binary searches, of n / 16 values in a sorted range
+    s.run("partition_point", "std", query_bytes, [&] {
+        std::size_t t = 0;
+        for(u32 q : queries)
+            t += std::partition_point(seq.begin(), seq.end(), below{q}) - seq.begin();
+        return t;
+    });
+    s.run("partition_point", "range", query_bytes, [&] {
+        std::size_t t = 0;
+        for(u32 q : queries)
+            t += ranges::partition_point(seq, below{q}) - seq.begin();
+        return t;
+    });
+
+    s.run("lower_bound", "std", query_bytes, [&] {
+        std::size_t t = 0;
+        for(u32 q : queries)
+            t += std::lower_bound(seq.begin(), seq.end(), q) - seq.begin();
+        return t;
+    });
+    s.run("lower_bound", "range", query_bytes, [&] {
+        std::size_t t = 0;
+        for(u32 q : queries)
+            t += ranges::lower_bound(seq, q) - seq.begin();
+        return t;
+    });
+
+    s.run("upper_bound", "std", query_bytes, [&] {
+        std::size_t t = 0;
+        for(u32 q : queries)
+            t += std::upper_bound(seq.begin(), seq.end(), q) - seq.begin();
+        return t;
+    });
+    s.run("upper_bound", "range", query_bytes, [&] {
+        std::size_t t = 0;
+        for(u32 q : queries)
+            t += ranges::upper_bound(seq, q) - seq.begin();
+        return t;
+    });
+
+    s.run("equal_range", "std", query_bytes, [&] {
+        std::size_t t = 0;
+        for(u32 q : queries)
+            t += std::equal_range(seq.begin(), seq.end(), q).second - seq.begin();
+        return t;
+    });
+    s.run("equal_range", "range", query_bytes, [&] {
+        std::size_t t = 0;
+        for(u32 q : queries)
+            t += ranges::equal_range(seq, q).end() - seq.begin();
+        return t;
+    });
+
+    s.run("binary_search", "std", query_bytes, [&] {
+        std::size_t t = 0;
+        for(u32 q : queries)
+            t += std::binary_search(seq.begin(), seq.end(), q);
+        return t;
+    });
+    s.run("binary_search", "range", query_bytes, [&] {
+        std::size_t t = 0;
+        for(u32 q : queries)
+            t += ranges::binary_search(seq, q);
+        return t;
+    });
+
+    // Copying
+    s.run("copy", "loop", bytes, [&] {
+        for(std::size_t i = 0; i < n; ++i)
+            out[i] = v[i];
+        return out[0];
+    });
+    s.run("copy", "range", bytes, [&] {
+        ranges::copy(v, out.begin());
+        return out[0];
+    });
+
+    s.run("copy_n", "loop", bytes, [&] {
+        for(std::size_t i = 0; i < n; ++i)
+            out[i] = v[i];
+        return out[0];
+    });
+    s.run("copy_n", "range", bytes, [&] {
+        ranges::copy_n(v.begin(), static_cast<std::ptrdiff_t>(n), out.begin());
+        return out[0];
+    });
+
+    s.run("copy_backward", "loop", bytes, [&] {
+        for(std::size_t i = n; i-- > 0;)
+            out[i] = v[i];
+        return out[0];
+    });
+    s.run("copy_backward", "range", bytes, [&] {
+        ranges::copy_backward(v, out.end());
+        return out[0];
+    });
+
+    s.run("move", "loop", bytes, [&] {
+        for(std::size_t i = 0; i < n; ++i)
+            out[i] = std::move(v[i]);
+        return out[0];
+    });
+    s.run("move", "range", bytes, [&] {
+        ranges::move(v, out.begin());
+        return out[0];
+    });
+
+    s.run("copy_if", "loop", bytes, [&] {
+        std::size_t j = 0;
+        for(u32 x : v)
+            if(x % 2u == 0u)
+                out[j++] = x;
+        return j;
+    });
+    s.run("copy_if", "range", bytes, [&] {
+        return ranges::copy_if(v, out.begin(), even{}).second - out.begin();
+    });
+
+    s.run("remove_copy_if", "loop", bytes, [&] {
+        std::size_t j = 0;
+        for(u32 x : v)
+            if(x % 2u != 0u)
+                out[j++] = x;
+        return j;
+    });
+    s.run("remove_copy_if", "range", bytes, [&] {
+        return ranges::remove_copy_if(v, out.begin(), even{}).second - out.begin();
+    });
+
+    s.run("replace_copy", "loop", bytes, [&] {
+        for(std::size_t i = 0; i < n; ++i)
+            out[i] = w[i] == 3u ? 5u : w[i];
+        return out[0];
+    });
+    s.run("replace_copy", "range", bytes, [&] {
+        ranges::replace_copy(w, out.begin(), 3u, 5u);
+        return out[0];
+    });
+
+    s.run("reverse_copy", "loop", bytes, [&] {
+        for(std::size_t i = 0; i < n; ++i)
+            out[i] = v[n - 1 - i];
+        return out[0];
+    });
+    s.run("reverse_copy", "range", bytes, [&] {
+        ranges::reverse_copy(v, out.begin());
+        return out[0];
+    });
+
+    s.run("rotate_copy", "loop", bytes, [&] {
+        std::size_t j = 0;
+        for(std::size_t i = n / 3; i < n; ++i)
+            out[j++] = v[i];
+        for(std::size_t i = 0; i < n / 3; ++i)
+            out[j++] = v[i];
+        return out[0];
+    });
+    s.run("rotate_copy", "range", bytes, [&] {
+        ranges::rotate_copy(v, v.begin() + n / 3, out.begin());
+        return out[0];
+    });
+
+    s.run("unique_copy", "loop", bytes, [&] {
+        std::size_t j = 0;
+        for(std::size_t i = 0; i < n; ++i)
+            if(i == 0 || runs[i] != runs[i - 1])
+                out[j++] = runs[i];
+        return j;
+    });
+    s.run("unique_copy", "range", bytes, [&] {
+        return ranges::unique_copy(runs, out.begin()).second - out.begin();
+    });
+
+    s.run("transform", "loop", bytes, [&] {
+        for(std::size_t i = 0; i < n; ++i)
+            out[i] = v[i] * 3u + 1u;
+        return out[0];
+    });
+    s.run("transform", "range", bytes, [&] {
+        ranges::transform(v, out.begin(), scale{});
+        return out[0];
+    });
+    s.run("transform", "par", bytes, [&] {
+        ranges::transform(ranges::par, v, out.begin(), scale{});
+        return out[0];
+    });
+
+    s.run("merge", "loop", set_bytes, [&] {
+        std::size_t i = 0, j = 0, k = 0;
+        while(i < twos.size() && j < threes.size())
+            out[k++] = threes[j] < twos[i] ? threes[j++] : twos[i++];
+        while(i < twos.size())
+            out[k++] = twos[i++];
+        while(j < threes.size())
+            out[k++] = threes[j++];
+        return k;
+    });
+    s.run("merge", "range", set_bytes, [&] {
+        return ranges::merge(twos, threes, out.begin()).out() - out.begin();
+    });
+
+    // Generating
+    s.run("fill", "loop", bytes, [&] {
+        for(u32 &x : out)
+            x = 7u;
+        return out[0];
+    });
+    s.run("fill", "range", bytes, [&] {
+        ranges::fill(out, 7u);
+        return out[0];
+    });
+
+    s.run("fill_n", "loop", bytes, [&] {
+        for(std::size_t i = 0; i < n; ++i)
+            out[i] = 7u;
+        return out[0];
+    });
+    s.run("fill_n", "range", bytes, [&] {
+        ranges::fill_n(out.begin(), static_cast<std::ptrdiff_t>(n), 7u);
+        return out[0];
+    });
+
+    s.run("generate", "loop", bytes, [&] {
+        counter c;
+        for(u32 &x : out)
+            x = c();
+        return out[0];
+    });
+    s.run("generate", "range", bytes, [&] {
+        ranges::generate(out, counter{});
+        return out[0];
+    });
+
+    s.run("generate_n", "loop", bytes, [&] {
+        counter c;
+        for(std::size_t i = 0; i < n; ++i)
+            out[i] = c();
+        return out[0];
+    });
+    s.run("generate_n", "range", bytes, [&] {
+        ranges::generate_n(out.begin(), static_cast<std::ptrdiff_t>(n), counter{});
+        return out[0];
+    });
+
+    // Modifying in place
+    s.run("replace", "loop", bytes, reset_w, [&] {
+        for(u32 &x : work)
+            if(x == 3u)
+                x = 5u;
+        return work[0];
+    });
+    s.run("replace", "range", bytes, reset_w, [&] {
+        ranges::replace(work, 3u, 5u);
+        return work[0];
+    });
+
+    s.run("replace_if", "loop", bytes, reset, [&] {
+        for(u32 &x : work)
+            if(x % 2u == 0u)
+                x = 5u;
+        return work[0];
+    });
+    s.run("replace_if", "range", bytes, reset, [&] {
+        ranges::replace_if(work, even{}, 5u);
+        return work[0];
+    });
+
+    s.run("remove", "loop", bytes, reset_w, [&] {
+        std::size_t j = 0;
+        for(std::size_t i = 0; i < n; ++i)
+            if(work[i] != 3u)
+                work[j++] = work[i];
+        return j;
+    });
+    s.run("remove", "range", bytes, reset_w, [&] {
+        return ranges::remove(work, 3u) - work.begin();
+    });
+
+    s.run("remove_if", "loop", bytes, reset, [&] {
+        std::size_t j = 0;
+        for(std::size_t i = 0; i < n; ++i)
+            if(work[i] % 2u != 0u)
+                work[j++] = work[i];
+        return j;
+    });
+    s.run("remove_if", "range", bytes, reset, [&] {
+        return ranges::remove_if(work, even{}) - work.begin();
+    });
+
+    s.run("unique", "loop", bytes, reset_runs, [&] {
+        std::size_t j = 1;
+        for(std::size_t i = 1; i < n; ++i)
+            if(work[i] != work[j - 1])
+                work[j++] = work[i];
+        return j;
+    });
+    s.run("unique", "range", bytes, reset_runs, [&] {
+        return ranges::unique(work) - work.begin();
+    });
+
+    s.run("reverse", "loop", bytes, reset, [&] {
+        for(std::size_t i = 0, j = n - 1; i < j; ++i, --j)
+            std::swap(work[i], work[j]);
+        return work[0];
+    });
+    s.run("reverse", "range", bytes, reset, [&] {
+        ranges::reverse(work);
+        return work[0];
+    });
+
+    s.run("swap_ranges", "loop", 2 * bytes, reset, [&] {
+        for(std::size_t i = 0; i < n; ++i)
+            std::swap(work[i], out[i]);
+        return work[0];
+    });
+    s.run("swap_ranges", "range", 2 * bytes, reset, [&] {
+        ranges::swap_ranges(work, out);
+        return work[0];
+    });
+
+    s.run("rotate", "std", bytes, reset, [&] {
+        return std::rotate(work.begin(), work.begin() + n / 3, work.end()) - work.begin();
+    });
+    s.run("rotate", "range", bytes, reset, [&] {
+        return ranges::rotate(work, work.begin() + n / 3).begin() - work.begin();
+    });
+
+    s.run("partition", "std", bytes, reset, [&] {
+        return std::partition(work.begin(), work.end(), even{}) - work.begin();
+    });
+    s.run("partition", "range", bytes, reset, [&] {
+        return ranges::partition(work, even{}) - work.begin();
+    });
+
+    s.run("stable_partition", "std", bytes, reset, [&] {
+        return std::stable_partition(work.begin(), work.end(), even{}) - work.begin();
+    });
+    s.run("stable_partition", "range", bytes, reset, [&] {
+        return ranges::stable_partition(work, even{}) - work.begin();
+    });
+
+    s.run("shuffle", "std", bytes, reset, [&] {
+        std::mt19937 gen(5489u);
+        std::shuffle(work.begin(), work.end(), gen);
+        return work[0];
+    });
+    s.run("shuffle", "range", bytes, reset, [&] {
+        std::mt19937 gen(5489u);
+        ranges::shuffle(work, gen);
+        return work[0];
+    });
+    s.run("shuffle", "xoshiro", bytes, reset, [&] {
+        ranges::xoshiro256starstar gen(5489u);
+        ranges::shuffle(work, gen);
+        return work[0];
+    });
+    s.run("shuffle", "par", bytes, reset, [&] {
+        ranges::xoshiro256starstar gen(5489u);
+        ranges::shuffle(ranges::par, work, gen);
+        return work[0];
+    });
+
+    s.run("fill_random", "loop", bytes, [&] {
+        std::mt19937 gen(5489u);
+        std::uniform_int_distribution<u32> dist;
+        for(u32 &x : out)
+            x = dist(gen);
+        return out[0];
+    });
+    s.run("fill_random", "range", bytes, [&] {
+        std::mt19937 gen(5489u);
+        ranges::fill_random(out, gen);
+        return out[0];
+    });
+    s.run("fill_random", "xoshiro", bytes, [&] {
+        ranges::xoshiro256starstar gen(5489u);
+        ranges::fill_random(out, gen);
+        return out[0];
+    });
+
+    // Sampling one element in 16, against selection sampling (Knuth's
+    // Algorithm S).
+    std::size_t const k = n / 16;
+    s.run("sample", "loop", bytes, [&] {
+        std::mt19937 gen(5489u);
+        std::size_t j = 0;
+        for(std::size_t i = 0; i < n && j < k; ++i)
+        {
+            std::uniform_int_distribution<std::size_t> dist(0, n - i - 1);
+            if(dist(gen) < k - j)
+                out[j++] = v[i];
+        }
+        return j;
+    });
+    s.run("sample", "range", bytes, [&] {
+        std::mt19937 gen(5489u);
+        return ranges::sample(v, out.begin(), static_cast<std::ptrdiff_t>(k), gen).out() -
+            out.begin();
+    });
+    // A sparse sample, of 1000 elements, where skipping pays.
+    s.run("sample_sparse", "loop", bytes, [&] {
+        std::mt19937 gen(5489u);
+        std::size_t j = 0;
+        for(std::size_t i = 0; i < n && j < 1000; ++i)
+        {
+            std::uniform_int_distribution<std::size_t> dist(0, n - i - 1);
+            if(dist(gen) < 1000 - j)
+                out[j++] = v[i];
+        }
+        return j;
+    });
+    s.run("sample_sparse", "range", bytes, [&] {
+        std::mt19937 gen(5489u);
+        return ranges::sample(v, out.begin(), 1000, gen).out() - out.begin();
+    });
+
+    // Sorting
+    s.run("sort", "std", bytes, reset, [&] {
+        std::sort(work.begin(), work.end());
+        return work[0];
+    });
+    s.run("sort", "range", bytes, reset, [&] {
+        ranges::sort(work);
+        return work[0];
+    });
+    s.run("sort", "par", bytes, reset, [&] {
+        ranges::sort(ranges::par, work);
+        return work[0];
+    });
+
+    s.run("stable_sort", "std", bytes, reset, [&] {
+        std::stable_sort(work.begin(), work.end());
+        return work[0];
+    });
+    s.run("stable_sort", "range", bytes, reset, [&] {
+        ranges::stable_sort(work);
+        return work[0];
+    });
+    s.run("stable_sort", "par", bytes, reset, [&] {
+        ranges::stable_sort(ranges::par, work);
+        return work[0];
+    });
+
+    s.run("radix_sort", "std", bytes, reset, [&] {
+        std::sort(work.begin(), work.end());
+        return work[0];
+    });
+    s.run("radix_sort", "range", bytes, reset, [&] {
+        ranges::radix_sort(work);
+        return work[0];
+    });
+
+    s.run("partial_sort", "std", bytes, reset, [&] {
+        std::partial_sort(work.begin(), work.begin() + n / 16, work.end());
+        return work[0];
+    });
+    s.run("partial_sort", "range", bytes, reset, [&] {
+        ranges::partial_sort(work, work.begin() + n / 16);
+        return work[0];
+    });
+
+    s.run("nth_element", "std", bytes, reset, [&] {
+        std::nth_element(work.begin(), work.begin() + n / 2, work.end());
+        return work[n / 2];
+    });
+    s.run("nth_element", "range", bytes, reset, [&] {
+        ranges::nth_element(work, work.begin() + n / 2);
+        return work[n / 2];
+    });
+
+    s.run("make_heap", "std", bytes, reset, [&] {
+        std::make_heap(work.begin(), work.end());
+        return work[0];
+    });
+    s.run("make_heap", "range", bytes, reset, [&] {
+        ranges::make_heap(work);
+        return work[0];
+    });
+
+    s.run("sort_heap", "std", bytes, [&] {
+        reset();
+        std::make_heap(work.begin(), work.end());
+    }, [&] {
+        std::sort_heap(work.begin(), work.end());
+        return work[0];
+    });
+    s.run("sort_heap", "range", bytes, [&] {
+        reset();
+        std::make_heap(work.begin(), work.end());
+    }, [&] {
+        ranges::sort_heap(work);
+        return work[0];
+    });
+
+    s.run("is_heap", "loop", bytes, [&] {
+        std::size_t i = 1;
+        while(i < n && !(seq[i] < seq[(i - 1) / 2]))
+            ++i;
+        return i == n;
+    });
+    s.run("is_heap", "range", bytes, [&] {
+        return ranges::is_heap(seq, std::greater<u32>{});
+    });
+
+    s.run("inplace_merge", "std", bytes, reset_halves, [&] {
+        std::inplace_merge(work.begin(), work.begin() + n / 2, work.end());
+        return work[0];
+    });
+    s.run("inplace_merge", "range", bytes, reset_halves, [&] {
+        ranges::inplace_merge(work, work.begin() + n / 2);
+        return work[0];
+    });
+
+    // Sorted sets, against merge loops
+    s.run("includes", "loop", set_bytes, [&] {
+        std::size_t i = 0, j = 0;
+        while(i < twos.size() && j < sixes.size())
+        {
+            if(sixes[j] < twos[i])
+                break;
+            if(!(twos[i] < sixes[j]))
+                ++j;
+            ++i;
+        }
+        return j == sixes.size();
+    });
+    s.run("includes", "range", set_bytes, [&] { return ranges::includes(twos, sixes); });
+
+    s.run("set_intersection", "loop", set_bytes, [&] {
+        std::size_t i = 0, j = 0, k = 0;
+        while(i < twos.size() && j < threes.size())
+        {
+            if(twos[i] < threes[j])
+                ++i;
+            else if(threes[j] < twos[i])
+                ++j;
+            else
+                out[k++] = twos[i], ++i, ++j;
+        }
+        return k;
+    });
+    s.run("set_intersection", "range", set_bytes, [&] {
+        return ranges::set_intersection(twos, threes, out.begin()) - out.begin();
+    });
+
+    // Skewed sizes: a thousand values against the multiples of 2, which the
+    // range algorithms gallop through.
+    std::vector<u32> sparse;
+    for(std::size_t i = 0; i < 1024; ++i)
+        sparse.push_back(static_cast<u32>(i * (n / 1024) + i % 2));
+    std::size_t const skewed_bytes = (twos.size() + sparse.size()) * sizeof(u32);
+    s.run("set_intersection_skewed", "loop", skewed_bytes, [&] {
+        std::size_t i = 0, j = 0, k = 0;
+        while(i < twos.size() && j < sparse.size())
+        {
+            if(twos[i] < sparse[j])
+                ++i;
+            else if(sparse[j] < twos[i])
+                ++j;
+            else
+                out[k++] = twos[i], ++i, ++j;
+        }
+        return k;
+    });
+    s.run("set_intersection_skewed", "range", skewed_bytes, [&] {
+        return ranges::set_intersection(twos, sparse, out.begin()) - out.begin();
+    });
+
+    // Random sets of up to n/4 values each, where about 1 in 2, 8 and 64
+    // values match. The range algorithm intersects these a block at a time.
+    for(u32 sparsity : {2u, 8u, 64u})
+    {
+        std::mt19937 gen(5489u);
+        std::vector<u32> const a = sorted_draws(n / 4, static_cast<u32>(n / 4) * sparsity, gen);
+        std::vector<u32> const b = sorted_draws(n / 4, static_cast<u32>(n / 4) * sparsity, gen);
+        std::string const name = "set_intersection_1/" + std::to_string(sparsity);
+        std::size_t const random_bytes = (a.size() + b.size()) * sizeof(u32);
+        s.run(name, "loop", random_bytes, [&] { return merge_intersection(a, b, out); });
+        s.run(name, "range", random_bytes, [&] {
+            return ranges::set_intersection(a, b, out.begin()) - out.begin();
+        });
+    }
+
+    s.run("set_union", "loop", set_bytes, [&] {
+        std::size_t i = 0, j = 0, k = 0;
+        while(i < twos.size() && j < threes.size())
+        {
+            if(twos[i] < threes[j])
+                out[k++] = twos[i++];
+            else if(threes[j] < twos[i])
+                out[k++] = threes[j++];
+            else
+                out[k++] = twos[i], ++i, ++j;
+        }
+        while(i < twos.size())
+            out[k++] = twos[i++];
+        while(j < threes.size())
+            out[k++] = threes[j++];
+        return k;
+    });
+    s.run("set_union", "range", set_bytes, [&] {
+        return ranges::set_union(twos, threes, out.begin()).out() - out.begin();
+    });
+
+    s.run("set_difference", "loop", set_bytes, [&] {
+        std::size_t i = 0, j = 0, k = 0;
+        while(i < twos.size() && j < threes.size())
+        {
+            if(twos[i] < threes[j])
+                out[k++] = twos[i++];
+            else if(threes[j] < twos[i])
+                ++j;
+            else
+                ++i, ++j;
+        }
+        while(i < twos.size())
+            out[k++] = twos[i++];
+        return k;
+    });
+    s.run("set_difference", "range", set_bytes, [&] {
+        return ranges::set_difference(twos, threes, out.begin()).out() - out.begin();
+    });
+
+    s.run("set_symmetric_difference", "loop", set_bytes, [&] {
+        std::size_t i = 0, j = 0, k = 0;
+        while(i < twos.size() && j < threes.size())
+        {
+            if(twos[i] < threes[j])
+                out[k++] = twos[i++];
+            else if(threes[j] < twos[i])
+                out[k++] = threes[j++];
+            else
+                ++i, ++j;
+        }
+        while(i < twos.size())
+            out[k++] = twos[i++];
+        while(j < threes.size())
+            out[k++] = threes[j++];
+        return k;
+    });
+    s.run("set_symmetric_difference", "range", set_bytes, [&] {
+        return ranges::set_symmetric_difference(twos, threes, out.begin()).out() -
+            out.begin();
+    });
+
+    return s.finish();
+}
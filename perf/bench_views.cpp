@@ -0,0 +1,705 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// The overhead of the views: each view is summed with a range-based for loop,
+// and compared with a hand-written loop that computes the same sum. The
+// views over strings, lines and CSV fields have their own programs, tokenize,
+// split and mmap_lines, as does any_view.
+//
+// Usage: bench_views [--n=<elements>] [--json] ...   (default 4M; see bench.hpp)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/adjacent_filter.hpp>
+#include <range/v3/view/adjacent_remove_if.hpp>
+#include <range/v3/view/bounded.hpp>
+#include <range/v3/view/c_str.hpp>
+#include <range/v3/view/chunk.hpp>
+#include <range/v3/view/concat.hpp>
+#include <range/v3/view/const.hpp>
+#include <range/v3/view/counted.hpp>
+#include <range/v3/view/delimit.hpp>
+#include <range/v3/view/drop.hpp>
+#include <range/v3/view/drop_exactly.hpp>
+#include <range/v3/view/drop_while.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/for_each.hpp>
+#include <range/v3/view/generate_n.hpp>
+#include <range/v3/view/group_by.hpp>
+#include <range/v3/view/indirect.hpp>
+#include <range/v3/view/intersperse.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/map.hpp>
+#include <range/v3/view/move.hpp>
+#include <range/v3/view/partial_sum.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/repeat_n.hpp>
+#include <range/v3/view/replace.hpp>
+#include <range/v3/view/replace_if.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/sample.hpp>
+#include <range/v3/view/set_algorithm.hpp>
+#include <range/v3/view/slice.hpp>
+#include <range/v3/view/sliding.hpp>
+#include <range/v3/view/split.hpp>
+#include <range/v3/view/stride.hpp>
+#include <range/v3/view/tail.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/take_exactly.hpp>
+#include <range/v3/view/take_while.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/unique.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/view/zip_with.hpp>
+#include "./bench.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    using u32 = std::uint32_t;
+
+    // Sums the range through its iterators, as a range-based for loop would
+    // if its begin and end could have different types.
+    template<typename Rng>
+    u32 sum(Rng &&rng)
+    {
+        u32 s = 0;
+        auto it = ranges::begin(rng);
+        auto const last = ranges::end(rng);
+        for(; it != last; ++it)
+            s += static_cast<u32>(*it);
+        return s;
+    }
+
+    // Sums a range of ranges.
+    template<typename Rng>
+    u32 sum2(Rng &&rng)
+    {
+        u32 s = 0;
+        auto it = ranges::begin(rng);
+        auto const last = ranges::end(rng);
+        for(; it != last; ++it)
+            s += sum(*it);
+        return s;
+    }
+
+    struct scale
+    {
+        u32 operator()(u32 i) const
+        {
+            return i * 3u + 1u;
+        }
+    };
+
+    struct even
+    {
+        bool operator()(u32 i) const
+        {
+            return i % 2u == 0u;
+        }
+    };
+
+    struct below
+    {
+        u32 limit;
+        bool operator()(u32 i) const
+        {
+            return i < limit;
+        }
+    };
+
+    struct counter
+    {
+        u32 i = 0;
+        u32 operator()()
+        {
+            return i++;
+        }
+    };
+
+    struct multiply
+    {
+        template<typename P>
+        u32 operator()(P const &p) const
+        {
+            return std::get<0>(p) * std::get<1>(p);
+        }
+    };
+
+    // The distinct values of n drawn from [0, range), sorted.
+    std::vector<u32> sorted_draws(std::size_t n, u32 range, std::mt19937 &gen)
+    {
+        std::uniform_int_distribution<u32> dist(0u, range - 1u);
+        std::vector<u32> v(n);
+        for(u32 &x : v)
+            x = dist(gen);
+        std::sort(v.begin(), v.end());
+        v.erase(std::unique(v.begin(), v.end()), v.end());
+        return v;
+    }
+
+    u32 merge_intersection(std::vector<u32> const &a, std::vector<u32> const &b)
+    {
+        u32 t = 0;
+        std::size_t i = 0, j = 0;
+        while(i < a.size() && j < b.size())
+        {
+            if(a[i] < b[j])
+                ++i;
+            else if(b[j] < a[i])
+                ++j;
+            else
+                t += a[i], ++i, ++j;
+        }
+        return t;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    bench::suite s("bench_views", bench::parse_options(argc, argv, std::size_t(1) << 22));
+    std::size_t const n = s.n();
+    std::size_t const bytes = n * sizeof(u32);
+    u32 const half = static_cast<u32>(n / 2);
+
+    // Scrambled, so that which values are filtered out is hard to predict.
+    std::vector<u32> v(n), w(n), seq(n), runs(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        v[i] = static_cast<u32>(i) * 2654435761u >> 7;
+        w[i] = static_cast<u32>(i % 7);
+        seq[i] = static_cast<u32>(i);
+        runs[i] = static_cast<u32>(i / 4);
+    }
+    std::vector<u32 *> ptrs(n);
+    for(std::size_t i = 0; i < n; ++i)
+        ptrs[i] = &v[i];
+    std::vector<std::pair<u32, u32>> pairs(n);
+    for(std::size_t i = 0; i < n; ++i)
+        pairs[i] = {seq[i], v[i]};
+    std::vector<std::vector<u32>> rows(n / 1000 + 1);
+    for(std::size_t i = 0; i < n; ++i)
+        rows[i / 1000].push_back(v[i]);
+    std::string const text(n, 'x');
+    char const *const ctext = text.c_str();
+    // Sorted, for the set algorithms: multiples of 2 and of 3.
+    std::vector<u32> twos(n / 2), threes(n / 3);
+    for(std::size_t i = 0; i < twos.size(); ++i)
+        twos[i] = static_cast<u32>(2 * i);
+    for(std::size_t i = 0; i < threes.size(); ++i)
+        threes[i] = static_cast<u32>(3 * i);
+    std::size_t const set_bytes = (twos.size() + threes.size()) * sizeof(u32);
+
+    // Sources
+    s.run("all", "loop", bytes, [&] {
+        u32 t = 0;
+        for(std::size_t i = 0; i < n; ++i)
+            t += v[i];
+        return t;
+    });
+    s.run("all", "range", bytes, [&] { return sum(view::all(v)); });
+
+    s.run("counted", "loop", bytes, [&] {
+        u32 t = 0;
+        for(u32 const *p = v.data(), *e = p + n; p != e; ++p)
+            t += *p;
+        return t;
+    });
+    s.run("counted", "range", bytes, [&] { return sum(view::counted(v.data(), n)); });
+
+    s.run("iota", "loop", bytes, [&] {
+        u32 t = 0;
+        for(u32 i = 0; i < u32(n); ++i)
+            t += i;
+        return t;
+    });
+    s.run("iota", "range", bytes, [&] { return sum(view::iota(u32(0), u32(n))); });
+
+    s.run("generate_n", "loop", bytes, [&] {
+        u32 t = 0;
+        counter c;
+        for(std::size_t i = 0; i < n; ++i)
+            t += c();
+        return t;
+    });
+    s.run("generate_n", "range", bytes, [&] { return sum(view::generate_n(counter{}, n)); });
+
+    s.run("repeat_n", "loop", bytes, [&] {
+        u32 t = 0;
+        for(std::size_t i = 0; i < n; ++i)
+            t += w[0];
+        return t;
+    });
+    s.run("repeat_n", "range", bytes, [&] { return sum(view::repeat_n(w[0], n)); });
+
+    s.run("c_str", "loop", n, [&] {
+        u32 t = 0;
+        for(char const *p = ctext; *p; ++p)
+            t += u32(*p);
+        return t;
+    });
+    s.run("c_str", "range", n, [&] { return sum(view::c_str(ctext)); });
+
+    // Element-wise adaptors
+    s.run("transform", "loop", bytes, [&] {
+        u32 t = 0;
+        for(u32 x : v)
+            t += x * 3u + 1u;
+        return t;
+    });
+    s.run("transform", "range", bytes, [&] { return sum(v | view::transform(scale{})); });
+
+    s.run("filter", "loop", bytes, [&] {
+        u32 t = 0;
+        for(u32 x : v)
+            if(x % 2u == 0u)
+                t += x;
+        return t;
+    });
+    s.run("filter", "range", bytes, [&] { return sum(v | view::filter(even{})); });
+
+    s.run("remove_if", "loop", bytes, [&] {
+        u32 t = 0;
+        for(u32 x : v)
+            if(x % 2u != 0u)
+                t += x;
+        return t;
+    });
+    s.run("remove_if", "range", bytes, [&] { return sum(v | view::remove_if(even{})); });
+
+    s.run("replace", "loop", bytes, [&] {
+        u32 t = 0;
+        for(u32 x : w)
+            t += x == 3u ? 5u : x;
+        return t;
+    });
+    s.run("replace", "range", bytes, [&] { return sum(w | view::replace(3u, 5u)); });
+
+    s.run("replace_if", "loop", bytes, [&] {
+        u32 t = 0;
+        for(u32 x : v)
+            t += x % 2u == 0u ? 5u : x;
+        return t;
+    });
+    s.run("replace_if", "range", bytes, [&] { return sum(v | view::replace_if(even{}, 5u)); });
+
+    s.run("const", "loop", bytes, [&] {
+        u32 t = 0;
+        for(u32 const &x : v)
+            t += x;
+        return t;
+    });
+    s.run("const", "range", bytes, [&] { return sum(v | view::const_); });
+
+    s.run("move", "loop", bytes, [&] {
+        u32 t = 0;
+        for(u32 &x : v)
+            t += std::move(x);
+        return t;
+    });
+    s.run("move", "range", bytes, [&] { return sum(v | view::move); });
+
+    s.run("indirect", "loop", bytes, [&] {
+        u32 t = 0;
+        for(u32 *p : ptrs)
+            t += *p;
+        return t;
+    });
+    s.run("indirect", "range", bytes, [&] { return sum(ptrs | view::indirect); });
+
+    s.run("values", "loop", 2 * bytes, [&] {
+        u32 t = 0;
+        for(auto const &p : pairs)
+            t += p.second;
+        return t;
+    });
+    s.run("values", "range", 2 * bytes, [&] { return sum(pairs | view::values); });
+
+    s.run("partial_sum", "loop", bytes, [&] {
+        u32 t = 0, run = 0;
+        for(u32 x : v)
+            t += run += x;
+        return t;
+    });
+    s.run("partial_sum", "range", bytes, [&] { return sum(v | view::partial_sum()); });
+
+    s.run("for_each", "loop", bytes, [&] {
+        u32 t = 0;
+        for(u32 x : v)
+            if(x % 2u == 0u)
+                t += x;
+        return t;
+    });
+    s.run("for_each", "range", bytes, [&] {
+        return sum(v | view::for_each([](u32 x) { return yield_if(x % 2u == 0u, x); }));
+    });
+
+    // Taking and dropping
+    s.run("take", "loop", bytes / 2, [&] {
+        u32 t = 0;
+        for(std::size_t i = 0; i < n / 2; ++i)
+            t += v[i];
+        return t;
+    });
+    s.run("take", "range", bytes / 2, [&] { return sum(v | view::take(n / 2)); });
+
+    s.run("take_exactly", "loop", bytes / 2, [&] {
+        u32 t = 0;
+        for(std::size_t i = 0; i < n / 2; ++i)
+            t += v[i];
+        return t;
+    });
+    s.run("take_exactly", "range", bytes / 2, [&] {
+        return sum(v | view::take_exactly(n / 2));
+    });
+
+    s.run("take_while", "loop", bytes / 2, [&] {
+        u32 t = 0;
+        for(u32 x : seq)
+        {
+            if(x >= half)
+                break;
+            t += x;
+        }
+        return t;
+    });
+    s.run("take_while", "range", bytes / 2, [&] {
+        return sum(seq | view::take_while(below{half}));
+    });
+
+    s.run("delimit", "loop", bytes / 2, [&] {
+        u32 t = 0;
+        for(u32 const *p = seq.data(); *p != half; ++p)
+            t += *p;
+        return t;
+    });
+    s.run("delimit", "range", bytes / 2, [&] {
+        return sum(view::delimit(seq.data(), half));
+    });
+
+    s.run("bounded", "loop", bytes / 2, [&] {
+        u32 t = 0;
+        for(u32 const *p = seq.data(); *p != half; ++p)
+            t += *p;
+        return t;
+    });
+    s.run("bounded", "range", bytes / 2, [&] {
+        return sum(view::delimit(seq.data(), half) | view::bounded);
+    });
+
+    s.run("drop", "loop", bytes / 2, [&] {
+        u32 t = 0;
+        for(std::size_t i = n / 2; i < n; ++i)
+            t += v[i];
+        return t;
+    });
+    s.run("drop", "range", bytes / 2, [&] { return sum(v | view::drop(n / 2)); });
+
+    s.run("drop_exactly", "loop", bytes / 2, [&] {
+        u32 t = 0;
+        for(std::size_t i = n / 2; i < n; ++i)
+            t += v[i];
+        return t;
+    });
+    s.run("drop_exactly", "range", bytes / 2, [&] {
+        return sum(v | view::drop_exactly(n / 2));
+    });
+
+    s.run("drop_while", "loop", bytes, [&] {
+        u32 t = 0;
+        std::size_t i = 0;
+        while(i < n && seq[i] < half)
+            ++i;
+        for(; i < n; ++i)
+            t += seq[i];
+        return t;
+    });
+    s.run("drop_while", "range", bytes, [&] {
+        return sum(seq | view::drop_while(below{half}));
+    });
+
+    s.run("slice", "loop", bytes / 2, [&] {
+        u32 t = 0;
+        for(std::size_t i = n / 4; i < 3 * n / 4; ++i)
+            t += v[i];
+        return t;
+    });
+    s.run("slice", "range", bytes / 2, [&] { return sum(v | view::slice(n / 4, 3 * n / 4)); });
+
+    s.run("tail", "loop", bytes, [&] {
+        u32 t = 0;
+        for(std::size_t i = 1; i < n; ++i)
+            t += v[i];
+        return t;
+    });
+    s.run("tail", "range", bytes, [&] { return sum(v | view::tail); });
+
+    s.run("stride", "loop", bytes / 4, [&] {
+        u32 t = 0;
+        for(std::size_t i = 0; i < n; i += 4)
+            t += v[i];
+        return t;
+    });
+    s.run("stride", "range", bytes / 4, [&] { return sum(v | view::stride(4)); });
+
+    s.run("reverse", "loop", bytes, [&] {
+        u32 t = 0;
+        for(std::size_t i = n; i-- > 0;)
+            t += v[i];
+        return t;
+    });
+    s.run("reverse", "range", bytes, [&] { return sum(v | view::reverse); });
+
+    // A sparse sample, of 1000 elements, against selection sampling.
+    s.run("sample", "loop", bytes, [&] {
+        std::mt19937 gen(5489u);
+        u32 t = 0;
+        std::size_t j = 0;
+        for(std::size_t i = 0; i < n && j < 1000; ++i)
+        {
+            std::uniform_int_distribution<std::size_t> dist(0, n - i - 1);
+            if(dist(gen) < 1000 - j)
+                t += v[i], ++j;
+        }
+        return t;
+    });
+    s.run("sample", "range", bytes, [&] {
+        std::mt19937 gen(5489u);
+        return sum(v | view::sample(1000, gen));
+    });
+
+    // Adjacent elements
+    s.run("unique", "loop", bytes, [&] {
+        u32 t = 0;
+        for(std::size_t i = 0; i < n; ++i)
+            if(i == 0 || runs[i] != runs[i - 1])
+                t += runs[i];
+        return t;
+    });
+    s.run("unique", "range", bytes, [&] { return sum(runs | view::unique); });
+
+    s.run("adjacent_filter", "loop", bytes, [&] {
+        u32 t = 0;
+        for(std::size_t i = 0; i < n; ++i)
+            if(i == 0 || runs[i] != runs[i - 1])
+                t += runs[i];
+        return t;
+    });
+    s.run("adjacent_filter", "range", bytes, [&] {
+        return sum(runs | view::adjacent_filter(std::not_equal_to<u32>{}));
+    });
+
+    s.run("adjacent_remove_if", "loop", bytes, [&] {
+        u32 t = 0;
+        for(std::size_t i = 0; i < n; ++i)
+            if(i + 1 == n || runs[i] != runs[i + 1])
+                t += runs[i];
+        return t;
+    });
+    s.run("adjacent_remove_if", "range", bytes, [&] {
+        return sum(runs | view::adjacent_remove_if(std::equal_to<u32>{}));
+    });
+
+    // Ranges of ranges
+    s.run("group_by", "loop", bytes, [&] {
+        u32 t = 0;
+        for(std::size_t i = 0; i < n; ++i)
+            t += runs[i];
+        return t;
+    });
+    s.run("group_by", "range", bytes, [&] {
+        return sum2(runs | view::group_by(std::equal_to<u32>{}));
+    });
+
+    s.run("chunk", "loop", bytes, [&] {
+        u32 t = 0;
+        for(std::size_t i = 0; i < n; i += 64)
+            for(std::size_t j = i; j < i + 64 && j < n; ++j)
+                t += v[j];
+        return t;
+    });
+    s.run("chunk", "range", bytes, [&] { return sum2(v | view::chunk(64)); });
+
+    s.run("sliding", "loop", bytes, [&] {
+        u32 t = 0;
+        for(std::size_t i = 0; i + 4 <= n; ++i)
+            for(std::size_t j = i; j < i + 4; ++j)
+                t += v[j];
+        return t;
+    });
+    s.run("sliding", "range", bytes, [&] { return sum2(v | view::sliding(4)); });
+
+    s.run("split", "loop", bytes, [&] {
+        u32 t = 0;
+        for(u32 x : w)
+            if(x != 0u)
+                t += x;
+        return t;
+    });
+    s.run("split", "range", bytes, [&] { return sum2(w | view::split(0u)); });
+
+    s.run("join", "loop", bytes, [&] {
+        u32 t = 0;
+        for(auto const &row : rows)
+            for(u32 x : row)
+                t += x;
+        return t;
+    });
+    s.run("join", "range", bytes, [&] { return sum(rows | view::join); });
+
+    s.run("intersperse", "loop", bytes, [&] {
+        u32 t = 0;
+        for(std::size_t i = 0; i < n; ++i)
+            t += (i == 0 ? 0u : 1u) + v[i];
+        return t;
+    });
+    s.run("intersperse", "range", bytes, [&] { return sum(v | view::intersperse(1u)); });
+
+    // Several ranges
+    s.run("concat", "loop", 2 * bytes, [&] {
+        u32 t = 0;
+        for(u32 x : v)
+            t += x;
+        for(u32 x : w)
+            t += x;
+        return t;
+    });
+    s.run("concat", "range", 2 * bytes, [&] { return sum(view::concat(v, w)); });
+
+    s.run("zip_with", "loop", 2 * bytes, [&] {
+        u32 t = 0;
+        for(std::size_t i = 0; i < n; ++i)
+            t += v[i] + w[i];
+        return t;
+    });
+    s.run("zip_with", "range", 2 * bytes, [&] {
+        return sum(view::zip_with(std::plus<u32>{}, v, w));
+    });
+
+    s.run("zip", "loop", 2 * bytes, [&] {
+        u32 t = 0;
+        for(std::size_t i = 0; i < n; ++i)
+            t += v[i] * w[i];
+        return t;
+    });
+    s.run("zip", "range", 2 * bytes, [&] {
+        return sum(view::zip(v, w) | view::transform(multiply{}));
+    });
+
+    // The sorted-set views, against a merge loop.
+    auto intersection = [&] {
+        u32 t = 0;
+        std::size_t i = 0, j = 0;
+        while(i < twos.size() && j < threes.size())
+        {
+            if(twos[i] < threes[j])
+                ++i;
+            else if(threes[j] < twos[i])
+                ++j;
+            else
+                t += twos[i], ++i, ++j;
+        }
+        return t;
+    };
+    s.run("set_intersection", "loop", set_bytes, intersection);
+    s.run("set_intersection", "range", set_bytes, [&] {
+        return sum(view::set_intersection(twos, threes));
+    });
+
+    // Random sets of up to n/4 values each, where about 1 in 2, 8 and 64
+    // values match. The view skips a block at a time to where they may.
+    for(u32 sparsity : {2u, 8u, 64u})
+    {
+        std::mt19937 gen(5489u);
+        std::vector<u32> const a = sorted_draws(n / 4, static_cast<u32>(n / 4) * sparsity, gen);
+        std::vector<u32> const b = sorted_draws(n / 4, static_cast<u32>(n / 4) * sparsity, gen);
+        std::string const name = "set_intersection_1/" + std::to_string(sparsity);
+        std::size_t const random_bytes = (a.size() + b.size()) * sizeof(u32);
+        s.run(name, "loop", random_bytes, [&] { return merge_intersection(a, b); });
+        s.run(name, "range", random_bytes, [&] { return sum(view::set_intersection(a, b)); });
+    }
+
+    s.run("set_union", "loop", set_bytes, [&] {
+        u32 t = 0;
+        std::size_t i = 0, j = 0;
+        while(i < twos.size() && j < threes.size())
+        {
+            if(twos[i] < threes[j])
+                t += twos[i++];
+            else if(threes[j] < twos[i])
+                t += threes[j++];
+            else
+                t += twos[i], ++i, ++j;
+        }
+        for(; i < twos.size(); ++i)
+            t += twos[i];
+        for(; j < threes.size(); ++j)
+            t += threes[j];
+        return t;
+    });
+    s.run("set_union", "range", set_bytes, [&] { return sum(view::set_union(twos, threes)); });
+
+    s.run("set_difference", "loop", set_bytes, [&] {
+        u32 t = 0;
+        std::size_t i = 0, j = 0;
+        while(i < twos.size() && j < threes.size())
+        {
+            if(twos[i] < threes[j])
+                t += twos[i++];
+            else if(threes[j] < twos[i])
+                ++j;
+            else
+                ++i, ++j;
+        }
+        for(; i < twos.size(); ++i)
+            t += twos[i];
+        return t;
+    });
+    s.run("set_difference", "range", set_bytes, [&] {
+        return sum(view::set_difference(twos, threes));
+    });
+
+    s.run("set_symmetric_difference", "loop", set_bytes, [&] {
+        u32 t = 0;
+        std::size_t i = 0, j = 0;
+        while(i < twos.size() && j < threes.size())
+        {
+            if(twos[i] < threes[j])
+                t += twos[i++];
+            else if(threes[j] < twos[i])
+                t += threes[j++];
+            else
+                ++i, ++j;
+        }
+        for(; i < twos.size(); ++i)
+            t += twos[i];
+        for(; j < threes.size(); ++j)
+            t += threes[j];
+        return t;
+    });
+    s.run("set_symmetric_difference", "range", set_bytes, [&] {
+        return sum(view::set_symmetric_difference(twos, threes));
+    });
+
+    return s.finish();
+}
@@ -0,0 +1,124 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Sum and collect pipelines of view::transform, view::filter and
+// view::zip_with over std::vectors, with a hand-written loop, an element at a
+// time through their iterators ("iter"), and a block at a time through
+// accumulate and to_vector.
+//
+// Usage: blocks [--n=<elements>] [--json] ...   (default 16M; see bench.hpp)
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/zip_with.hpp>
+#include "./bench.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    using u32 = std::uint32_t;
+
+    struct scale
+    {
+        u32 operator()(u32 i) const
+        {
+            return i * 3u + 1u;
+        }
+    };
+
+    struct even
+    {
+        bool operator()(u32 i) const
+        {
+            return i % 2u == 0u;
+        }
+    };
+
+    // Sums the range through its iterators, one element at a time.
+    template<typename Rng>
+    u32 one_at_a_time(Rng &&rng)
+    {
+        u32 sum = 0;
+        for(auto it = ranges::begin(rng), last = ranges::end(rng); it != last; ++it)
+            sum += *it;
+        return sum;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    bench::suite s("blocks", bench::parse_options(argc, argv, std::size_t(1) << 24));
+    std::size_t const n = s.n();
+    std::size_t const bytes = n * sizeof(u32);
+    // Scrambled, so that which values are filtered out is hard to predict.
+    std::vector<u32> v(n);
+    for(std::size_t i = 0; i < n; ++i)
+        v[i] = static_cast<u32>(i) * 2654435761u >> 7;
+    std::vector<u32> const w(n, 7u);
+
+    auto tf = v | ranges::view::transform(scale{}) | ranges::view::filter(even{});
+    auto loop = [&] {
+        u32 sum = 0;
+        for(u32 x : v)
+        {
+            u32 const y = x * 3u + 1u;
+            if(y % 2u == 0u)
+                sum += y;
+        }
+        return sum;
+    };
+    auto zw = ranges::view::zip_with(std::plus<u32>{}, v, w);
+    auto zip_loop = [&] {
+        u32 sum = 0;
+        for(std::size_t i = 0; i < n; ++i)
+            sum += v[i] + w[i];
+        return sum;
+    };
+    if(one_at_a_time(tf) != loop() || ranges::accumulate(tf, u32(0)) != loop() ||
+       one_at_a_time(zw) != zip_loop() || ranges::accumulate(zw, u32(0)) != zip_loop())
+    {
+        std::cerr << "the sums differ\n";
+        return 1;
+    }
+
+    s.run("transform|filter", "loop", bytes, loop);
+    s.run("transform|filter", "iter", bytes, [&] { return one_at_a_time(tf); });
+    s.run("transform|filter", "range", bytes, [&] { return ranges::accumulate(tf, u32(0)); });
+
+    s.run("transform|filter to_vector", "loop", bytes, [&] {
+        std::vector<u32> out;
+        for(u32 x : v)
+        {
+            u32 const y = x * 3u + 1u;
+            if(y % 2u == 0u)
+                out.push_back(y);
+        }
+        return out.size();
+    });
+    s.run("transform|filter to_vector", "range", bytes, [&] {
+        return ranges::to_vector(tf).size();
+    });
+
+    s.run("zip_with", "loop", 2 * bytes, zip_loop);
+    s.run("zip_with", "iter", 2 * bytes, [&] { return one_at_a_time(zw); });
+    s.run("zip_with", "range", 2 * bytes, [&] { return ranges::accumulate(zw, u32(0)); });
+
+    return s.finish();
+}
@@ -0,0 +1,126 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Read the lines of a log file with getlines over an ifstream, the baseline,
+// with buffered_getlines over an ifstream, and with view::lines over an
+// mmap_file. Given no file, it writes one of --n bytes, and removes it after.
+//
+// Usage: mmap_lines [--n=<bytes>] [--json] ... [file]   (default 256M; see bench.hpp)
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/getlines.hpp>
+#include <range/v3/mmap_file.hpp>
+#include <range/v3/span.hpp>
+#include <range/v3/view/lines.hpp>
+#include "./bench.hpp"
+
+namespace
+{
+    void write_log(std::string const &path, std::size_t bytes)
+    {
+        std::ofstream out(path, std::ios::binary);
+        std::mt19937 gen;
+        std::uniform_int_distribution<int> len(20, 200), letter('a', 'z');
+        std::string line;
+        for(std::size_t written = 0; written < bytes; written += line.size())
+        {
+            line.assign(static_cast<std::size_t>(len(gen)), ' ');
+            for(char &c : line)
+                c = static_cast<char>(letter(gen));
+            line.back() = '\n';
+            out << line;
+        }
+    }
+
+    // The number of lines of the file, and the bytes read, with getlines.
+    std::pair<std::size_t, std::size_t> stream_lines(std::string const &path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::size_t lines = 0, bytes = 0;
+        auto rng = ranges::getlines(in);
+        for(auto it = ranges::begin(rng); it != ranges::end(rng); ++it)
+        {
+            bytes += (*it).size() + 1;
+            ++lines;
+        }
+        return {lines, bytes};
+    }
+
+    // ... with buffered_getlines.
+    std::pair<std::size_t, std::size_t> buffered_lines(std::string const &path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::size_t lines = 0, bytes = 0;
+        auto rng = ranges::buffered_getlines(in);
+        for(auto it = ranges::begin(rng); it != ranges::end(rng); ++it)
+        {
+            bytes += static_cast<std::size_t>((*it).size()) + 1;
+            ++lines;
+        }
+        return {lines, bytes};
+    }
+
+    // ... with view::lines over an mmap_file.
+    std::pair<std::size_t, std::size_t> mmap_lines(std::string const &path)
+    {
+        ranges::mmap_file<char> file{path};
+        std::size_t lines = 0, bytes = 0;
+        for(ranges::span<char const> line : file | ranges::view::lines)
+        {
+            bytes += static_cast<std::size_t>(line.size()) + 1;
+            ++lines;
+        }
+        return {lines, bytes};
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    bench::options opts =
+        bench::parse_options(argc, argv, std::size_t(256) << 20, "[file]");
+    bool const own_file = opts.args.empty();
+    std::string const path = own_file ? "mmap_lines.log" : opts.args[0];
+    if(own_file)
+        write_log(path, opts.n);
+    {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if(!in)
+        {
+            std::cerr << "cannot read " << path << "\n";
+            return 1;
+        }
+        opts.n = static_cast<std::size_t>(in.tellg());
+    }
+    bench::suite s("mmap_lines", opts);
+
+    bool const same = stream_lines(path) == buffered_lines(path) &&
+        stream_lines(path) == mmap_lines(path);
+    if(same)
+    {
+        s.run("lines", "stream", s.n(), [&] { return stream_lines(path); });
+        s.run("lines", "buffered", s.n(), [&] { return buffered_lines(path); });
+        s.run("lines", "mmap", s.n(), [&] { return mmap_lines(path); });
+    }
+    else
+        std::cerr << "the lines differ\n";
+
+    if(own_file)
+        std::remove(path.c_str());
+    return same ? s.finish() : 1;
+}
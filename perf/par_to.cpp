@@ -0,0 +1,97 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Collect a view::transform | view::filter | view::take_while pipeline over a
+// std::vector into a std::vector, with a hand-written loop, on the calling
+// thread with to_vector, and on the thread pool with par_to_vector.
+//
+// Usage: par_to [--n=<elements>] [--json] ...   (default 4M; see bench.hpp)
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/par_to_container.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/take_while.hpp>
+#include <range/v3/view/transform.hpp>
+#include "./bench.hpp"
+
+namespace
+{
+    // Enough work per element that the pipeline, not memory, is the bottleneck.
+    struct work
+    {
+        double operator()(std::uint32_t i) const
+        {
+            return std::sqrt(double(i)) * std::log(double(i) + 1.0);
+        }
+    };
+
+    struct keep
+    {
+        bool operator()(double d) const
+        {
+            return std::fmod(d, 3.0) < 2.0;
+        }
+    };
+
+    struct below
+    {
+        double limit;
+        bool operator()(double d) const
+        {
+            return d < limit;
+        }
+    };
+}
+
+int main(int argc, char *argv[])
+{
+    bench::suite s("par_to", bench::parse_options(argc, argv, std::size_t(1) << 22));
+    std::size_t const n = s.n();
+    std::size_t const bytes = n * sizeof(std::uint32_t);
+    std::vector<std::uint32_t> v(n);
+    for(std::size_t i = 0; i < n; ++i)
+        v[i] = static_cast<std::uint32_t>(i);
+
+    // Stops about nine tenths of the way through.
+    double const limit = work{}(static_cast<std::uint32_t>(n / 10 * 9));
+    auto rng = v | ranges::view::transform(work{}) | ranges::view::filter(keep{})
+                 | ranges::view::take_while(below{limit});
+    auto loop = [&] {
+        std::vector<double> out;
+        for(std::uint32_t i : v)
+        {
+            double const d = work{}(i);
+            if(!keep{}(d))
+                continue;
+            if(!(d < limit))
+                break;
+            out.push_back(d);
+        }
+        return out;
+    };
+    if(ranges::to_vector(rng) != loop() || (rng | ranges::par_to_vector) != loop())
+    {
+        std::cerr << "the results differ\n";
+        return 1;
+    }
+
+    s.run("to_vector", "loop", bytes, [&] { return loop().size(); });
+    s.run("to_vector", "range", bytes, [&] { return ranges::to_vector(rng).size(); });
+    s.run("to_vector", "par", bytes, [&] { return (rng | ranges::par_to_vector).size(); });
+
+    return s.finish();
+}
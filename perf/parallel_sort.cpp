@@ -0,0 +1,99 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Time sort and stable_sort of a vector of records, with the standard library,
+// sequentially and with the parallel policy, for random keys and for keys with
+// few distinct values.
+//
+// Usage: parallel_sort [--n=<elements>] [--json] ...   (default 10M; see bench.hpp)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include "./bench.hpp"
+
+namespace
+{
+    struct record
+    {
+        std::uint64_t key;
+        std::uint64_t payload[3];
+    };
+
+    struct key_less
+    {
+        bool operator()(record const &a, record const &b) const
+        {
+            return a.key < b.key;
+        }
+    };
+
+    std::vector<record> make_records(std::size_t n, std::uint64_t distinct)
+    {
+        std::mt19937_64 gen;
+        std::uniform_int_distribution<std::uint64_t> dist(0, distinct - 1);
+        std::vector<record> v(n);
+        for(std::size_t i = 0; i < n; ++i)
+            v[i] = record{dist(gen), {i, i, i}};
+        return v;
+    }
+
+    // Times sort on a fresh copy of v, and checks that it sorted it.
+    template<typename F>
+    bool run_sort(bench::suite &s, std::string const &name, char const *variant,
+        std::vector<record> const &v, std::vector<record> &w, F sort)
+    {
+        w.clear();
+        s.run(name, variant, v.size() * sizeof(record), [&] { w = v; }, [&] {
+            sort(w);
+            return w.data();
+        });
+        return ranges::is_sorted(w, ranges::ordered_less{}, &record::key);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    bench::suite s("parallel_sort", bench::parse_options(argc, argv, 10000000));
+    std::vector<record> w;
+    bool sorted = true;
+    for(std::uint64_t distinct : {std::uint64_t(1) << 62, std::uint64_t(16)})
+    {
+        std::string const keys = distinct == 16 ? " (16 keys)" : " (random)";
+        auto const v = make_records(s.n(), distinct);
+        sorted &= run_sort(s, "sort" + keys, "std", v, w, [](std::vector<record> &x) {
+            std::sort(x.begin(), x.end(), key_less{}); });
+        sorted &= run_sort(s, "sort" + keys, "range", v, w, [](std::vector<record> &x) {
+            ranges::sort(x, ranges::ordered_less{}, &record::key); });
+        sorted &= run_sort(s, "sort" + keys, "par", v, w, [](std::vector<record> &x) {
+            ranges::sort(ranges::par, x, ranges::ordered_less{}, &record::key); });
+        sorted &= run_sort(s, "stable_sort" + keys, "std", v, w, [](std::vector<record> &x) {
+            std::stable_sort(x.begin(), x.end(), key_less{}); });
+        sorted &= run_sort(s, "stable_sort" + keys, "range", v, w, [](std::vector<record> &x) {
+            ranges::stable_sort(x, ranges::ordered_less{}, &record::key); });
+        sorted &= run_sort(s, "stable_sort" + keys, "par", v, w, [](std::vector<record> &x) {
+            ranges::stable_sort(ranges::par, x, ranges::ordered_less{}, &record::key); });
+    }
+    if(!sorted)
+    {
+        std::cerr << "not sorted!\n";
+        return 1;
+    }
+    return s.finish();
+}
@@ -0,0 +1,98 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Time radix_sort, sequentially and with the parallel policy, against sort and
+// stable_sort on records with a 64-bit key, with 32-bit keys, and on short
+// strings.
+//
+// Usage: radix_sort [--n=<elements>] [--json] ...   (default 10M; see bench.hpp)
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/radix_sort.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include "./bench.hpp"
+
+namespace
+{
+    struct record
+    {
+        std::uint64_t key;
+        std::uint64_t payload;
+    };
+
+    // Times sort on a fresh copy of v, and checks that it sorted it.
+    template<typename T, typename P, typename F>
+    bool run_sort(bench::suite &s, std::string const &name, char const *variant,
+        std::vector<T> const &v, P proj, F sort)
+    {
+        std::vector<T> w;
+        s.run(name, variant, v.size() * sizeof(T), [&] { w = v; }, [&] {
+            sort(w);
+            return w.data();
+        });
+        return ranges::is_sorted(w, ranges::ordered_less{}, proj);
+    }
+
+    template<typename T, typename P>
+    bool run(bench::suite &s, std::string const &name, std::vector<T> const &v, P proj)
+    {
+        bool sorted = run_sort(s, name, "sort", v, proj, [&](std::vector<T> &w) {
+            ranges::sort(w, ranges::ordered_less{}, proj); });
+        sorted &= run_sort(s, name, "stable", v, proj, [&](std::vector<T> &w) {
+            ranges::stable_sort(w, ranges::ordered_less{}, proj); });
+        sorted &= run_sort(s, name, "radix", v, proj, [&](std::vector<T> &w) {
+            ranges::radix_sort(w, proj); });
+        sorted &= run_sort(s, name, "par", v, proj, [&](std::vector<T> &w) {
+            ranges::radix_sort(ranges::par, w, proj); });
+        return sorted;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    bench::suite s("radix_sort", bench::parse_options(argc, argv, 10000000));
+    std::size_t const n = s.n();
+
+    std::mt19937_64 gen;
+    std::vector<record> records(n);
+    for(std::size_t i = 0; i < n; ++i)
+        records[i] = record{gen(), i};
+    bool sorted = run(s, "uint64 key", records, &record::key);
+
+    std::vector<std::int32_t> ints(n);
+    for(auto &i : ints)
+        i = static_cast<std::int32_t>(gen());
+    sorted &= run(s, "int32", ints, ranges::ident{});
+
+    std::vector<std::string> strings(n / 4);
+    for(auto &str : strings)
+    {
+        str.resize(8 + gen() % 16);
+        for(char &c : str)
+            c = static_cast<char>('a' + gen() % 26);
+    }
+    sorted &= run(s, "strings", strings, ranges::ident{});
+
+    if(!sorted)
+    {
+        std::cerr << "not sorted!\n";
+        return 1;
+    }
+    return s.finish();
+}
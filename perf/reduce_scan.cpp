@@ -0,0 +1,91 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Sums, dot products and prefix sums of std::vector<double>s, folded in order
+// by accumulate, inner_product and partial_sum, and in any order by reduce,
+// transform_reduce and inclusive_scan, sequentially and with ranges::par. The
+// in-order fold is the baseline.
+//
+// Usage: reduce_scan [--n=<elements>] [--json] ...   (default 16M; see bench.hpp)
+
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/numeric/inclusive_scan.hpp>
+#include <range/v3/numeric/inner_product.hpp>
+#include <range/v3/numeric/partial_sum.hpp>
+#include <range/v3/numeric/reduce.hpp>
+#include <range/v3/numeric/transform_reduce.hpp>
+#include "./bench.hpp"
+
+namespace
+{
+    // Sums agree up to their rounding.
+    bool close(double a, double b)
+    {
+        double const d = a < b ? b - a : a - b;
+        return d <= 1e-9 * (a < 0 ? -a : a) + 1e-9;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    bench::suite s("reduce_scan", bench::parse_options(argc, argv, std::size_t(1) << 24));
+    std::size_t const n = s.n();
+    std::size_t const bytes = n * sizeof(double);
+    std::vector<double> v(n), w(n), out(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        v[i] = 1.0 / double(i % 1000 + 1);
+        w[i] = double(i % 7);
+    }
+
+    auto accumulate = [&] { return ranges::accumulate(v, 0.0); };
+    auto reduce = [&] { return ranges::reduce(v, 0.0); };
+    auto reduce_par = [&] { return ranges::reduce(ranges::par, v, 0.0); };
+    auto inner_product = [&] { return ranges::inner_product(v, w, 0.0); };
+    auto transform_reduce = [&] { return ranges::transform_reduce(v, w, 0.0); };
+    auto transform_reduce_par = [&] {
+        return ranges::transform_reduce(ranges::par, v, w, 0.0);
+    };
+    auto partial_sum = [&] {
+        ranges::partial_sum(v, out.begin());
+        return n == 0 ? 0.0 : out.back();
+    };
+    auto inclusive_scan_par = [&] {
+        ranges::inclusive_scan(ranges::par, v, out.begin());
+        return n == 0 ? 0.0 : out.back();
+    };
+    if(!close(accumulate(), reduce()) || !close(accumulate(), reduce_par()) ||
+       !close(inner_product(), transform_reduce()) ||
+       !close(inner_product(), transform_reduce_par()) ||
+       !close(partial_sum(), inclusive_scan_par()))
+    {
+        std::cerr << "the results differ by more than their rounding\n";
+        return 1;
+    }
+
+    s.run("sum", "accum", bytes, accumulate);
+    s.run("sum", "reduce", bytes, reduce);
+    s.run("sum", "par", bytes, reduce_par);
+
+    s.run("dot product", "inner", 2 * bytes, inner_product);
+    s.run("dot product", "reduce", 2 * bytes, transform_reduce);
+    s.run("dot product", "par", 2 * bytes, transform_reduce_par);
+
+    s.run("prefix sum", "partial", bytes, partial_sum);
+    s.run("prefix sum", "par", bytes, inclusive_scan_par);
+
+    return s.finish();
+}
@@ -0,0 +1,123 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Throughput of find, count, equal, mismatch and lexicographical_compare over
+// contiguous arrays of scalars, from 1KiB to --n bytes in steps of 32 times.
+// Each algorithm is timed on the element-wise loop, which an identity
+// projection other than ranges::ident selects, and on its block-at-a-time fast
+// path. Each run scans at least 1MiB, repeating the algorithm over the smaller
+// arrays.
+//
+// Usage: scalar_search [--n=<max-bytes>] [--json] ...   (default 64MiB; see bench.hpp)
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/find.hpp>
+#include <range/v3/algorithm/lexicographical_compare.hpp>
+#include <range/v3/algorithm/mismatch.hpp>
+#include "./bench.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    template<typename T>
+    struct identity
+    {
+        T operator()(T t) const { return t; }
+    };
+
+    // 1024 as "1K", 1048576 as "1M".
+    std::string size_name(std::size_t bytes)
+    {
+        return bytes % (1u << 20) == 0 ? std::to_string(bytes >> 20) + "M"
+                                       : std::to_string(bytes >> 10) + "K";
+    }
+
+    // Times fun, repeated `times` times, as a benchmark that processes
+    // `bytes` bytes.
+    template<typename F>
+    void run_repeated(bench::suite &s, std::string const &name, char const *variant,
+        std::size_t bytes, std::size_t times, F fun)
+    {
+        s.run(name, variant, bytes * times, [&] {
+            std::size_t sum = 0;
+            for(std::size_t i = 0; i < times; ++i)
+            {
+                bench::keep(i);
+                sum += fun();
+            }
+            return sum;
+        });
+    }
+
+    template<typename T>
+    void run(bench::suite &s, std::string const &type, std::size_t bytes)
+    {
+        std::size_t const n = bytes / sizeof(T);
+        std::size_t const times = bytes < (1u << 20) ? (1u << 20) / bytes : 1;
+        std::string const suffix = "<" + type + ">/" + size_name(bytes);
+        // Values never equal to the needle, so every algorithm scans it all.
+        std::vector<T> a(n), b(n);
+        for(std::size_t i = 0; i < n; ++i)
+            a[i] = b[i] = static_cast<T>(i % 61 + 1);
+        T const needle = 0;
+        identity<T> id;
+
+        run_repeated(s, "find" + suffix, "loop", bytes, times, [&] {
+            return std::size_t(ranges::find(a, needle, id) - a.begin()); });
+        run_repeated(s, "find" + suffix, "range", bytes, times, [&] {
+            return std::size_t(ranges::find(a, needle) - a.begin()); });
+        run_repeated(s, "count" + suffix, "loop", bytes, times, [&] {
+            return std::size_t(ranges::count(a, T(1), id)); });
+        run_repeated(s, "count" + suffix, "range", bytes, times, [&] {
+            return std::size_t(ranges::count(a, T(1))); });
+        run_repeated(s, "equal" + suffix, "loop", bytes, times, [&] {
+            return std::size_t(ranges::equal(a, b, ranges::equal_to{}, id, id)); });
+        run_repeated(s, "equal" + suffix, "range", bytes, times, [&] {
+            return std::size_t(ranges::equal(a, b)); });
+        run_repeated(s, "mismatch" + suffix, "loop", bytes, times, [&] {
+            return std::size_t(ranges::mismatch(a, b, ranges::equal_to{}, id, id).first -
+                a.begin()); });
+        run_repeated(s, "mismatch" + suffix, "range", bytes, times, [&] {
+            return std::size_t(ranges::mismatch(a, b).first - a.begin()); });
+        // Only integers have a fast lexicographical_compare, which is "lex_compare"
+        // here to fit the table.
+        if(!std::is_integral<T>::value)
+            return;
+        run_repeated(s, "lex_compare" + suffix, "loop", bytes, times, [&] {
+            return std::size_t(
+                ranges::lexicographical_compare(a, b, ranges::ordered_less{}, id, id)); });
+        run_repeated(s, "lex_compare" + suffix, "range", bytes, times, [&] {
+            return std::size_t(ranges::lexicographical_compare(a, b)); });
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    bench::suite s("scalar_search", bench::parse_options(argc, argv, std::size_t(1) << 26));
+    for(std::size_t bytes = 1024; bytes <= s.n(); bytes *= 32)
+    {
+        run<char>(s, "char", bytes);
+        run<std::int16_t>(s, "int16", bytes);
+        run<std::int32_t>(s, "int32", bytes);
+        run<std::int64_t>(s, "int64", bytes);
+        run<float>(s, "float", bytes);
+        run<double>(s, "double", bytes);
+    }
+    return s.finish();
+}
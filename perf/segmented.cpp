@@ -0,0 +1,164 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Throughput of for_each, copy, accumulate, find_if and count_if over a joined
+// vector of vectors, with inner ranges of 16 to 4096 elements, and over a
+// concatenation of four vectors. Each algorithm is timed against a hand-written
+// nested loop, then with a loop that steps the view's iterator one element at a
+// time ("iter"), and then as called, which visits one inner range at a time.
+//
+// Usage: segmented [--n=<elements>] [--json] ...   (default 16M; see bench.hpp)
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <vector>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/find_if.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/concat.hpp>
+#include <range/v3/view/join.hpp>
+#include "./bench.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    // Elements are below limit.
+    constexpr int limit = 1000;
+
+    template<typename Rng>
+    void run(bench::suite &s, std::string const &what, std::size_t n, Rng &rng,
+        std::vector<std::vector<int>> const &vv)
+    {
+        std::size_t const bytes = n * sizeof(int);
+        auto const last = ranges::end(rng);
+        auto const half = [](int i) { return i < limit / 2; };
+        auto const never = [](int i) { return i >= limit; };
+        std::vector<int> out(n);
+
+        s.run("for_each " + what, "loop", bytes, [&] {
+            long long sum = 0;
+            for(auto const &v : vv)
+                for(int i : v)
+                    sum += i;
+            return sum;
+        });
+        s.run("for_each " + what, "iter", bytes, [&] {
+            long long sum = 0;
+            for(auto it = ranges::begin(rng); it != last; ++it)
+                sum += *it;
+            return sum;
+        });
+        s.run("for_each " + what, "range", bytes, [&] {
+            long long sum = 0;
+            ranges::for_each(rng, [&](int i) { sum += i; });
+            return sum;
+        });
+
+        s.run("copy " + what, "loop", bytes, [&] {
+            auto o = out.begin();
+            for(auto const &v : vv)
+                o = std::copy(v.begin(), v.end(), o);
+            return o - out.begin();
+        });
+        s.run("copy " + what, "iter", bytes, [&] {
+            auto o = out.begin();
+            for(auto it = ranges::begin(rng); it != last; ++it, ++o)
+                *o = *it;
+            return o - out.begin();
+        });
+        s.run("copy " + what, "range", bytes, [&] {
+            return ranges::copy(rng, out.begin()).out() - out.begin();
+        });
+
+        s.run("accumulate " + what, "loop", bytes, [&] {
+            long long sum = 0;
+            for(auto const &v : vv)
+                sum = std::accumulate(v.begin(), v.end(), sum);
+            return sum;
+        });
+        s.run("accumulate " + what, "iter", bytes, [&] {
+            long long sum = 0;
+            for(auto it = ranges::begin(rng); it != last; ++it)
+                sum = sum + *it;
+            return sum;
+        });
+        s.run("accumulate " + what, "range", bytes, [&] {
+            return ranges::accumulate(rng, 0LL);
+        });
+
+        s.run("find_if " + what, "loop", bytes, [&] {
+            for(auto const &v : vv)
+                if(std::find_if(v.begin(), v.end(), never) != v.end())
+                    return false;
+            return true;
+        });
+        s.run("find_if " + what, "iter", bytes, [&] {
+            auto it = ranges::begin(rng);
+            for(; it != last; ++it)
+                if(never(*it))
+                    break;
+            return it == last;
+        });
+        s.run("find_if " + what, "range", bytes, [&] {
+            return ranges::find_if(rng, never) == last;
+        });
+
+        s.run("count_if " + what, "loop", bytes, [&] {
+            std::ptrdiff_t c = 0;
+            for(auto const &v : vv)
+                c += std::count_if(v.begin(), v.end(), half);
+            return c;
+        });
+        s.run("count_if " + what, "iter", bytes, [&] {
+            std::ptrdiff_t c = 0;
+            for(auto it = ranges::begin(rng); it != last; ++it)
+                if(half(*it))
+                    ++c;
+            return c;
+        });
+        s.run("count_if " + what, "range", bytes, [&] {
+            return ranges::count_if(rng, half);
+        });
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    bench::suite s("segmented", bench::parse_options(argc, argv, std::size_t(1) << 24));
+    std::size_t const n = s.n();
+    int k = 0;
+    for(std::size_t inner = 16; inner <= 4096; inner *= 16)
+    {
+        std::size_t const outer = n / inner;
+        std::vector<std::vector<int>> vv(outer, std::vector<int>(inner));
+        for(auto &v : vv)
+            for(int &i : v)
+                i = k++ % limit;
+        auto joined = vv | ranges::view::join;
+        run(s, "join/" + std::to_string(inner), outer * inner, joined, vv);
+    }
+
+    // Four ranges of a quarter of the elements each.
+    std::vector<std::vector<int>> quarters(4, std::vector<int>(n / 4));
+    for(auto &v : quarters)
+        for(int &i : v)
+            i = k++ % limit;
+    auto cat = ranges::view::concat(quarters[0], quarters[1], quarters[2], quarters[3]);
+    run(s, "concat", n / 4 * 4, cat, quarters);
+
+    return s.finish();
+}
@@ -0,0 +1,141 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Sort, stable_sort and partition a table of five columns by its first, as a
+// view::zip of std::vectors, which moves whole rows through iter_swap, and as
+// a soa_vector, which orders the keys and then moves each column into place.
+// The zip is the baseline.
+//
+// Usage: soa_sort [--n=<rows>] [--json] ...   (default 4M; see bench.hpp)
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+#include <range/v3/soa_vector.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/partition.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/view/zip.hpp>
+#include "./bench.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    using table_t = ranges::soa_vector<std::uint32_t, double, double, std::int64_t, float>;
+
+    struct key
+    {
+        template<typename T>
+        std::uint32_t operator()(T const &t) const
+        {
+            return std::get<0>(t);
+        }
+    };
+
+    struct even
+    {
+        bool operator()(std::uint32_t i) const
+        {
+            return i % 2 == 0;
+        }
+    };
+
+    table_t make_table(std::size_t rows)
+    {
+        std::mt19937 gen;
+        table_t t;
+        t.reserve(rows);
+        for(std::size_t i = 0; i < rows; ++i)
+            t.emplace_back(static_cast<std::uint32_t>(gen()), 0.5 * i, 0.25 * i,
+                static_cast<std::int64_t>(i), 1.f);
+        return t;
+    }
+
+    // Copy the table into one std::vector per column.
+    struct columns
+    {
+        std::vector<std::uint32_t> a;
+        std::vector<double> b, c;
+        std::vector<std::int64_t> d;
+        std::vector<float> e;
+
+        explicit columns(table_t const &t)
+          : a(t.column<0>().begin(), t.column<0>().end())
+          , b(t.column<1>().begin(), t.column<1>().end())
+          , c(t.column<2>().begin(), t.column<2>().end())
+          , d(t.column<3>().begin(), t.column<3>().end())
+          , e(t.column<4>().begin(), t.column<4>().end())
+        {}
+        // Copy the table back in, into the same buffers.
+        void assign(table_t const &t)
+        {
+            a.assign(t.column<0>().begin(), t.column<0>().end());
+            b.assign(t.column<1>().begin(), t.column<1>().end());
+            c.assign(t.column<2>().begin(), t.column<2>().end());
+            d.assign(t.column<3>().begin(), t.column<3>().end());
+            e.assign(t.column<4>().begin(), t.column<4>().end());
+        }
+        decltype(ranges::view::zip(a, b, c, d, e)) zip()
+        {
+            return ranges::view::zip(a, b, c, d, e);
+        }
+    };
+}
+
+int main(int argc, char *argv[])
+{
+    bench::suite s("soa_sort", bench::parse_options(argc, argv, std::size_t(1) << 22));
+    std::size_t const rows = s.n();
+    std::size_t const bytes =
+        rows * (sizeof(std::uint32_t) + 2 * sizeof(double) + sizeof(std::int64_t) + sizeof(float));
+    table_t const table = make_table(rows);
+    columns cols{table};
+    auto z = cols.zip();
+    table_t t = table;
+    auto reset_zip = [&] { cols.assign(table); };
+    auto reset_soa = [&] { t = table; };
+
+    s.run("sort", "zip", bytes, reset_zip, [&] {
+        ranges::sort(z, ranges::less{}, key{});
+        return cols.a.data();
+    });
+    s.run("sort", "soa", bytes, reset_soa, [&] {
+        ranges::sort(t, ranges::less{}, key{});
+        return t.column<0>().data();
+    });
+    if(!ranges::equal(t.column<0>(), cols.a))
+        return 1;
+
+    s.run("stable_sort", "zip", bytes, reset_zip, [&] {
+        ranges::stable_sort(z, ranges::less{}, key{});
+        return cols.a.data();
+    });
+    s.run("stable_sort", "soa", bytes, reset_soa, [&] {
+        ranges::stable_sort(t, ranges::less{}, key{});
+        return t.column<0>().data();
+    });
+    if(!ranges::equal(t.column<3>(), cols.d))
+        return 1;
+
+    s.run("partition", "zip", bytes, reset_zip, [&] {
+        return ranges::partition(z, even{}, key{}) - ranges::begin(z);
+    });
+    s.run("partition", "soa", bytes, reset_soa, [&] {
+        return ranges::partition(t, even{}, key{}) - ranges::begin(t);
+    });
+
+    return s.finish();
+}
@@ -25,6 +25,8 @@
 #include <climits>
 #include <chrono>
 #include <algorithm>
+#include <string>
+#include <utility>
 #include <range/v3/all.hpp>
 
 RANGES_DIAGNOSTIC_IGNORE_GLOBAL_CONSTRUCTORS
@@ -93,6 +95,28 @@ namespace
     }
   };
 
+  /// Ascending, with one element in a hundred replaced by a random value
+  struct nearly_sorted_integer_sequence {
+    std::default_random_engine gen;
+    std::uniform_int_distribution<> dist;
+    static std::string name() { return "nearly_sorted_integer_sequence"; }
+    auto operator()(std::size_t) {
+      return ranges::view::ints(0) | ranges::view::transform([&](int i) {
+        return dist(gen) % 100 == 0 ? dist(gen) : i;
+      });
+    }
+  };
+
+  /// Random values from a set of 16
+  struct few_unique_integer_sequence {
+    std::default_random_engine gen;
+    std::uniform_int_distribution<> dist{0, 15};
+    static std::string name() { return "few_unique_integer_sequence"; }
+    auto operator()(std::size_t) {
+      return ranges::view::generate([&]{ return dist(gen); });
+    }
+  };
+
   template<typename Seq>
   void print(Seq seq, std::size_t n) {
     std::cout << "sequence: " << seq.name() << '\n';
@@ -203,6 +227,17 @@ namespace
                                               max_size);
   }
 
+  /// The speedup of ranges::sort over std::sort at the largest size, per
+  /// pattern
+  std::vector<std::pair<std::string, double>> summary;
+
+  /// How many times faster ranges::sort is than std::sort
+  template <typename Result>
+  double speedup(Result const &rs, Result const &ss) {
+    return std::chrono::duration<double>(ss.mean_t).count() /
+           std::chrono::duration<double>(rs.mean_t).count();
+  }
+
   template <typename Seq> void benchmark_sort(Seq &&seq, std::size_t max_size) {
     auto ranges_sort_comp =
         make_computation_on_sequence(seq, ranges::sort, max_size);
@@ -219,7 +254,7 @@ namespace
     std::cout << '#'
               << "pattern: " << seq.name() << '\n';
     std::cout << '#' << setw(19) << 'N' << setw(20) << "ranges::sort" << setw(20)
-              << "std::sort"
+              << "std::sort" << setw(20) << "speedup"
               << '\n';
     RANGES_FOR(auto p, ranges::view::zip(ranges_sort_benchmark.results,
                                          std_sort_benchmark.results)) {
@@ -227,8 +262,12 @@ namespace
       auto ss = p.second;
 
       std::cout << setw(20) << rs.size << setw(20) << to_millis(rs.mean_t)
-                << setw(20) << to_millis(ss.mean_t) << '\n';
+                << setw(20) << to_millis(ss.mean_t) << setw(19) << std::fixed
+                << std::setprecision(2) << speedup(rs, ss) << "x\n";
     }
+    auto const &rs = ranges_sort_benchmark.results.back();
+    auto const &ss = std_sort_benchmark.results.back();
+    summary.push_back({seq.name(), speedup(rs, ss)});
   }
 } // unnamed namespace
 
@@ -240,11 +279,20 @@ int main() {
   print(descending_integer_sequence(), 20);
   print(even_odd_integer_sequence(), 20);
   print(organ_pipe_integer_sequence(), 20);
+  print(nearly_sorted_integer_sequence(), 20);
+  print(few_unique_integer_sequence(), 20);
 
   benchmark_sort(random_uniform_integer_sequence(), max_size);
   benchmark_sort(ascending_integer_sequence(), max_size);
   benchmark_sort(descending_integer_sequence(), max_size);
   benchmark_sort(organ_pipe_integer_sequence(), max_size);
+  benchmark_sort(nearly_sorted_integer_sequence(), max_size);
+  benchmark_sort(few_unique_integer_sequence(), max_size);
+
+  std::cout << "#speedup of ranges::sort over std::sort at N = " << max_size << '\n';
+  for (auto const &p : summary)
+    std::cout << std::setw(40) << p.first << std::setw(10) << std::fixed
+              << std::setprecision(2) << p.second << "x\n";
 }
 
 #else
@@ -0,0 +1,97 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Split comma-separated text into fields and add up their lengths, with a
+// hand-written loop, with view::split by a predicate, which takes the generic
+// path that tests every element of a field as it is iterated, and with
+// view::split by a character and by a pattern, which find each delimiter once
+// and yield sized fields.
+//
+// Usage: split [--n=<bytes>] [--json] ...   (default 64M; see bench.hpp)
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/distance.hpp>
+#include <range/v3/iterator_range.hpp>
+#include <range/v3/view/split.hpp>
+#include "./bench.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    std::string make_csv(std::size_t bytes)
+    {
+        std::mt19937 gen;
+        std::uniform_int_distribution<int> len(1, 16), letter('a', 'z');
+        std::string str;
+        str.reserve(bytes + 16);
+        while(str.size() < bytes)
+        {
+            for(int i = len(gen); i > 0; --i)
+                str += static_cast<char>(letter(gen));
+            str += ',';
+        }
+        return str;
+    }
+
+    // The number of fields of rng, and their total length.
+    template<typename Rng>
+    std::pair<std::size_t, std::size_t> fields(Rng const &rng)
+    {
+        std::size_t count = 0, chars = 0;
+        for(auto it = ranges::begin(rng); it != ranges::end(rng); ++it)
+        {
+            chars += static_cast<std::size_t>(ranges::distance(*it));
+            ++count;
+        }
+        return {count, chars};
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    bench::suite s("split", bench::parse_options(argc, argv, std::size_t(1) << 26));
+    std::string const csv = make_csv(s.n());
+    char const comma[] = ",";
+
+    auto loop = [&] {
+        std::size_t count = 0, chars = 0;
+        for(auto it = csv.begin(); it != csv.end(); ++count)
+        {
+            auto const end = std::find(it, csv.end(), ',');
+            chars += static_cast<std::size_t>(end - it);
+            it = end == csv.end() ? end : end + 1;
+        }
+        return std::make_pair(count, chars);
+    };
+    auto by_pred = ranges::view::split(csv, [](char c) { return c == ','; });
+    auto by_char = ranges::view::split(csv, ',');
+    auto by_pattern = ranges::view::split(csv, ranges::make_iterator_range(comma, comma + 1));
+    if(fields(by_pred) != loop() || fields(by_char) != loop() || fields(by_pattern) != loop())
+    {
+        std::cerr << "the fields differ\n";
+        return 1;
+    }
+
+    s.run("split", "loop", csv.size(), loop);
+    s.run("split", "pred", csv.size(), [&] { return fields(by_pred); });
+    s.run("split", "char", csv.size(), [&] { return fields(by_char); });
+    s.run("split", "pattern", csv.size(), [&] { return fields(by_pattern); });
+
+    return s.finish();
+}
@@ -0,0 +1,125 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Tokenize text into words and comma-separated values into fields with
+// view::tokenize and a regular expression, the baseline, and with
+// view::tokenize_chars and view::csv_fields for the same tokens.
+//
+// Usage: tokenize [--n=<bytes>] [--json] ...   (default 16M; see bench.hpp)
+
+#include <cstddef>
+#include <random>
+#include <regex>
+#include <string>
+#include <utility>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/distance.hpp>
+#include <range/v3/view/csv_fields.hpp>
+#include <range/v3/view/tokenize.hpp>
+#include <range/v3/view/tokenize_chars.hpp>
+#include "./bench.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    // Words of 1 to 12 letters, separated by spaces, punctuation and line
+    // breaks.
+    std::string make_text(std::size_t bytes)
+    {
+        std::mt19937 gen;
+        std::uniform_int_distribution<int> len(1, 12), letter('a', 'z'), sep(0, 15);
+        std::string str;
+        while(str.size() < bytes)
+        {
+            for(int i = len(gen); i > 0; --i)
+                str += static_cast<char>(letter(gen));
+            int const s = sep(gen);
+            str += s == 0 ? ", " : s == 1 ? ".\n" : " ";
+        }
+        return str;
+    }
+
+    // Records of 8 fields, every fourth of them quoted with a comma inside.
+    std::string make_csv(std::size_t bytes)
+    {
+        std::mt19937 gen;
+        std::uniform_int_distribution<int> len(1, 12), letter('a', 'z');
+        std::string str;
+        for(int k = 0; str.size() < bytes; ++k)
+        {
+            bool const quoted = k % 4 == 3;
+            if(quoted)
+                str += "\"x, ";
+            for(int i = len(gen); i > 0; --i)
+                str += static_cast<char>(letter(gen));
+            if(quoted)
+                str += '"';
+            str += k % 8 == 7 ? '\n' : ',';
+        }
+        return str;
+    }
+
+    template<typename I>
+    std::size_t length(std::sub_match<I> const &m)
+    {
+        return static_cast<std::size_t>(m.length());
+    }
+    template<typename Rng>
+    std::size_t length(Rng const &rng)
+    {
+        return static_cast<std::size_t>(ranges::distance(rng));
+    }
+
+    // The number of tokens of rng, and their total length.
+    template<typename Rng>
+    std::pair<std::size_t, std::size_t> tokens(Rng const &rng)
+    {
+        std::size_t count = 0, chars = 0;
+        for(auto it = ranges::begin(rng); it != ranges::end(rng); ++it)
+        {
+            chars += length(*it);
+            ++count;
+        }
+        return {count, chars};
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    bench::suite s("tokenize", bench::parse_options(argc, argv, std::size_t(1) << 24));
+
+    std::string const text = make_text(s.n());
+    std::regex const word{R"(\w+)"};
+    auto words = text | view::tokenize(word);
+    auto word_chars = text | view::tokenize_chars(char_class::word{});
+    s.run("words", "regex", text.size(), [&] { return tokens(words); });
+    s.run("words", "range", text.size(), [&] { return tokens(word_chars); });
+    std::regex const nonspace{R"(\S+)"};
+    auto nonspaces = text | view::tokenize(nonspace);
+    auto nonspace_chars = text | view::tokenize_chars(char_class::not_<char_class::space>{});
+    s.run("non-spaces", "regex", text.size(), [&] { return tokens(nonspaces); });
+    s.run("non-spaces", "range", text.size(), [&] { return tokens(nonspace_chars); });
+
+    std::string const csv = make_csv(s.n());
+    // A quoted field, or a run of anything but delimiters. The field's text is
+    // the first or second submatch; tokenize yields both for each match, one
+    // of them empty.
+    std::regex const field{R"#("([^"]*)"|([^,\n]+))#"};
+    auto regex_fields = csv | view::tokenize(field, {1, 2});
+    auto fields = csv | view::csv_fields;
+    s.run("csv fields", "regex", csv.size(), [&] { return tokens(regex_fields); });
+    s.run("csv fields", "range", csv.size(), [&] { return tokens(fields); });
+
+    return s.finish();
+}
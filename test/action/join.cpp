@@ -0,0 +1,50 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/action/join.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<std::vector<int>> vv{{1, 2}, {}, {3, 4, 5}};
+    std::vector<int> v = action::join(vv);
+    ::check_equal(v, {1, 2, 3, 4, 5});
+    std::vector<std::string> vs{"this", "is", "his"};
+    std::string s = action::join(vs);
+    CHECK(s == "thisishis");
+
+    // With an allocator
+    {
+        arena a;
+        auto va = action::join(vv, arena_allocator<int>{a});
+        static_assert(std::is_same<decltype(va), std::vector<int, arena_allocator<int>>>::value, "");
+        CHECK(va.get_allocator().arena_ == &a);
+        ::check_equal(va, {1, 2, 3, 4, 5});
+        CHECK(a.allocations_ > 0u);
+
+        auto vb = std::move(vv) | action::join(arena_allocator<char>{a});
+        static_assert(std::is_same<decltype(vb), std::vector<int, arena_allocator<int>>>::value, "");
+        ::check_equal(vb, {1, 2, 3, 4, 5});
+
+        using arena_string = std::basic_string<char, std::char_traits<char>, arena_allocator<char>>;
+        std::vector<arena_string> vas{arena_string("this"), arena_string("is")};
+        auto sa = action::join(vas, arena_allocator<char>{a});
+        static_assert(std::is_same<decltype(sa), arena_string>::value, "");
+        CHECK(sa.get_allocator().arena_ == &a);
+        CHECK(sa == "thisis");
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,73 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/stride.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/move.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/action/shuffle.hpp>
+#include <range/v3/action/radix_sort.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+    std::mt19937 gen;
+
+    std::vector<int> v = view::ints(-50,50);
+    v |= action::shuffle(gen);
+    CHECK(!is_sorted(v));
+
+    auto v2 = v | copy | action::radix_sort;
+    CHECK(size(v2) == size(v));
+    CHECK(is_sorted(v2));
+    CHECK(!is_sorted(v));
+    ::models<concepts::Same>(v, v2);
+
+    v |= action::radix_sort;
+    CHECK(is_sorted(v));
+
+    v |= action::shuffle(gen);
+    CHECK(!is_sorted(v));
+
+    v = v | move | action::radix_sort([](int i) { return -i; });
+    CHECK(is_sorted(v, std::greater<int>()));
+
+    // Container algorithms can also be called directly
+    // in which case they take and return by reference
+    v |= action::shuffle(gen);
+    auto & v3 = action::radix_sort(v);
+    CHECK(is_sorted(v));
+    CHECK(&v3 == &v);
+    CHECK(equal(v, v2));
+
+    // Can pipe a view to a "container" algorithm.
+    action::radix_sort(v, [](int i) { return -i; });
+    v | view::stride(2) | action::radix_sort;
+    check_equal(view::take(v, 10), {-49,48,-47,46,-45,44,-43,42,-41,40});
+
+    // Sort by a member, stably.
+    std::vector<std::pair<std::string, int>> p = {{"b", 0}, {"ab", 1}, {"b", 2}, {"", 3}, {"ab", 4}};
+    p |= action::radix_sort(&std::pair<std::string, int>::first);
+    check_equal(p | view::transform(&std::pair<std::string, int>::second), {3, 1, 4, 0, 2});
+
+    return ::test_result();
+}
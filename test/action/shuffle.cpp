@@ -66,5 +66,17 @@ int main()
     v | view::stride(2) | action::shuffle(gen);
     CHECK(!is_sorted(v));
 
+    // With a parallel policy
+    v = view::ints(0, 1 << 18);
+    v2 = v;
+    std::mt19937 gen1, gen2;
+    v |= action::shuffle(par, gen1);
+    auto & v4 = action::shuffle(v2, par, gen2);
+    CHECK(&v4 == &v2);
+    CHECK(!is_sorted(v));
+    CHECK(equal(v, v2));
+    sort(v);
+    CHECK(equal(v, view::ints(0, 1 << 18)));
+
     return ::test_result();
 }
@@ -69,5 +69,38 @@ int main()
         }
     }
 
+    // With an allocator
+    {
+        arena a;
+        using arena_vector = std::vector<int, arena_allocator<int>>;
+        auto rga = action::split(v, 10, arena_allocator<int>{a});
+        static_assert(std::is_same<decltype(rga),
+            std::vector<arena_vector, arena_allocator<arena_vector>>>::value, "");
+        CHECK(rga.size() == 2u);
+        CHECK(rga.get_allocator().arena_ == &a);
+        CHECK(rga[0].get_allocator().arena_ == &a);
+        ::check_equal(rga[0], {1,2,3,4,5,6,7,8,9});
+        ::check_equal(rga[1], {11,12,13,14,15,16,17,18,19,20});
+        CHECK(a.allocations_ >= 3u);
+
+        using arena_string = std::basic_string<char, std::char_traits<char>, arena_allocator<char>>;
+        arena_string str("now  is \t the\ttime", arena_allocator<char>{a});
+        auto toks = action::split(str, (int(*)(int))&std::isspace, arena_allocator<char>{a});
+        static_assert(std::is_same<decltype(toks),
+            std::vector<arena_string, arena_allocator<arena_string>>>::value, "");
+        CHECK(toks.size() == 4u);
+        if(toks.size() == 4u)
+        {
+            CHECK(toks[0] == "now");
+            CHECK(toks[3] == "time");
+        }
+
+        auto rgs2 = action::split(s, view::c_str(" "), arena_allocator<char>{a});
+        static_assert(std::is_same<decltype(rgs2), std::vector<std::vector<char,
+            arena_allocator<char>>, arena_allocator<std::vector<char,
+            arena_allocator<char>>>>>::value, "");
+        CHECK(rgs2.size() == 4u);
+    }
+
     return ::test_result();
 }
@@ -12,7 +12,10 @@
 #include <cstring>
 #include <utility>
 #include <algorithm>
+#include <array>
+#include <vector>
 #include <range/v3/core.hpp>
+#include <range/v3/span.hpp>
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/view/delimit.hpp>
 #include "../simple_test.hpp"
@@ -67,5 +70,32 @@ int main()
         CHECK(std::strcmp(sz, buf) == 0);
     }
 
+    // Contiguous ranges of trivially copyable elements take the memmove path.
+    static_assert(ranges::is_contiguous_iterator<int const *>(), "");
+    static_assert(ranges::is_contiguous_iterator<std::vector<int>::iterator>(), "");
+    static_assert(ranges::is_contiguous_iterator<std::array<int, 4>::const_iterator>(), "");
+    static_assert(ranges::is_contiguous_iterator<ranges::span<int>::iterator>(), "");
+    static_assert(!ranges::is_contiguous_iterator<int>(), "");
+    {
+        std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7};
+        std::array<int, 8> w{};
+        auto res4 = ranges::copy(v, w.begin());
+        CHECK(res4.first == v.end());
+        CHECK(res4.second == w.end());
+        CHECK(std::equal(v.begin(), v.end(), w.begin()));
+
+        // Overlapping, to the left
+        auto res5 = ranges::copy(ranges::span<int>(v.data() + 2, 6), v.begin());
+        CHECK(res5.first.get_unsafe() == v.data() + 8);
+        CHECK(res5.second == v.begin() + 6);
+        int const expected[] = {2, 3, 4, 5, 6, 7, 6, 7};
+        CHECK(std::equal(v.begin(), v.end(), expected));
+
+        // Empty
+        auto res6 = ranges::copy(v.begin(), v.begin(), w.begin());
+        CHECK(res6.first == v.begin());
+        CHECK(res6.second == w.begin());
+    }
+
     return test_result();
 }
@@ -12,6 +12,7 @@
 #include <cstring>
 #include <utility>
 #include <algorithm>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/copy_backward.hpp>
 #include "../simple_test.hpp"
@@ -45,5 +46,15 @@ int main()
     CHECK(res2.second == begin(out));
     CHECK(std::equal(a, a + size(a), out));
 
+    // Overlapping contiguous ranges of trivially copyable elements, to the right
+    {
+        std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7};
+        auto res3 = ranges::copy_backward(v.begin(), v.begin() + 6, v.end());
+        CHECK(res3.first == v.begin() + 6);
+        CHECK(res3.second == v.begin() + 2);
+        int const expected[] = {0, 1, 0, 1, 2, 3, 4, 5};
+        CHECK(std::equal(v.begin(), v.end(), expected));
+    }
+
     return test_result();
 }
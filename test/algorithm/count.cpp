@@ -9,6 +9,8 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <limits>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/count.hpp>
 #include "../simple_test.hpp"
@@ -19,6 +21,21 @@ struct S
     int i;
 };
 
+template<typename T>
+void test_contiguous_scalar()
+{
+    using namespace ranges;
+    auto id = [](T t) { return t; };
+    for(int n : {0, 1, 15, 16, 17, 32, 33, 100, 1000})
+    {
+        std::vector<T> v(static_cast<std::size_t>(n));
+        for(int i = 0; i < n; ++i)
+            v[static_cast<std::size_t>(i)] = static_cast<T>(i % 7);
+        for(int x : {0, 3, 6, 7})
+            CHECK(count(v, static_cast<T>(x)) == count(v, static_cast<T>(x), id));
+    }
+}
+
 int main()
 {
     using namespace ranges;
@@ -57,5 +74,21 @@ int main()
     CHECK(count(make_iterator_range(input_iterator<const S*>(sa),
                       sentinel<const S*>(sa)), 2, &S::i) == 0);
 
+    test_contiguous_scalar<char>();
+    test_contiguous_scalar<short>();
+    test_contiguous_scalar<int>();
+    test_contiguous_scalar<unsigned long long>();
+    test_contiguous_scalar<float>();
+    test_contiguous_scalar<double>();
+
+    {
+        unsigned char uc[] = {255, 1, 255};
+        CHECK(count(uc, 255) == 2);
+        CHECK(count(uc, -1) == 0);
+        float f[] = {0.f, -0.f, std::numeric_limits<float>::quiet_NaN()};
+        CHECK(count(f, 0.f) == 2);
+        CHECK(count(f, std::numeric_limits<float>::quiet_NaN()) == 0);
+    }
+
     return ::test_result();
 }
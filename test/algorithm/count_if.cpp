@@ -9,6 +9,7 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/count_if.hpp>
 #include "../simple_test.hpp"
@@ -74,5 +75,15 @@ int main()
     CHECK(count_if(make_iterator_range(input_iterator<T*>(ta),
                          sentinel<T*>(ta + size(ta))), &T::b) == 4);
 
+    // Check the parallel overloads
+    {
+        std::vector<S> v(100000);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            v[i].i = i % 7;
+        CHECK(count_if(par, v, equals(2), &S::i) == count_if(v, equals(2), &S::i));
+        CHECK(count_if(par_unseq, v.begin(), v.end(), equals(7), &S::i) == 0);
+        CHECK(count_if(seq, v, equals(0), &S::i) == 14286);
+    }
+
     return ::test_result();
 }
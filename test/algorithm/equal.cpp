@@ -18,6 +18,8 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <limits>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/view/unbounded.hpp>
@@ -269,6 +271,31 @@ void test_rng_pred()
                   std::equal_to<int>()));
 }
 
+template<typename T>
+void test_contiguous_scalar()
+{
+    using namespace ranges;
+    auto id = [](T t) { return t; };
+    for(int n : {0, 1, 15, 16, 17, 32, 33, 100})
+    {
+        std::vector<T> a(static_cast<std::size_t>(n));
+        for(int i = 0; i < n; ++i)
+            a[static_cast<std::size_t>(i)] = static_cast<T>(i);
+        for(int k = 0; k <= n; ++k)
+        {
+            std::vector<T> b = a;
+            if(k < n)
+                b[static_cast<std::size_t>(k)] = static_cast<T>(n + 1);
+            CHECK(equal(a, b) == (k == n));
+            CHECK(equal(a, b) == equal(a, b, equal_to{}, id, id));
+            CHECK(equal(a.begin(), a.end(), b.begin()) == (k == n));
+            CHECK(equal(a.data(), a.data() + n, b.data(), b.data() + n) == (k == n));
+        }
+        if(n)
+            CHECK(!equal(a.begin(), a.end(), a.begin(), a.end() - 1));
+    }
+}
+
 int main()
 {
     ::test();
@@ -276,6 +303,21 @@ int main()
     ::test_pred();
     ::test_rng_pred();
 
+    test_contiguous_scalar<char>();
+    test_contiguous_scalar<short>();
+    test_contiguous_scalar<int>();
+    test_contiguous_scalar<long long>();
+    test_contiguous_scalar<float>();
+    test_contiguous_scalar<double>();
+
+    {
+        // Floating-point equality is not bytewise.
+        double const nan = std::numeric_limits<double>::quiet_NaN();
+        double d0[] = {1.0, 0.0, nan}, d1[] = {1.0, -0.0, nan};
+        CHECK(ranges::equal(d0, d0 + 2, d1, d1 + 2));
+        CHECK(!ranges::equal(d0, d1));
+    }
+
     int *p = nullptr;
     static_assert(std::is_same<bool, decltype(ranges::equal({1, 2, 3, 4}, p))>::value, "");
     static_assert(std::is_same<bool, decltype(ranges::equal({1, 2, 3, 4}, {1, 2, 3, 4}))>::value, "");
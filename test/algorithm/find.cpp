@@ -18,6 +18,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <limits>
 #include <utility>
 #include <vector>
 #include <range/v3/core.hpp>
@@ -30,6 +31,27 @@ struct S
     int i_;
 };
 
+// The contiguous arithmetic fast path must agree with the element-wise loop,
+// which is selected by any projection other than ident.
+template<typename T>
+void test_contiguous_scalar()
+{
+    using namespace ranges;
+    auto id = [](T t) { return t; };
+    for(int n : {0, 1, 7, 15, 16, 17, 31, 32, 33, 64, 100, 257})
+    {
+        std::vector<T> v(static_cast<std::size_t>(n));
+        for(int i = 0; i < n; ++i)
+            v[static_cast<std::size_t>(i)] = static_cast<T>(i % 100);
+        for(int x : {0, 5, 42, 99, 100})
+        {
+            CHECK(find(v, static_cast<T>(x)) == find(v, static_cast<T>(x), id));
+            auto const i = find(v.data(), v.data() + n, static_cast<T>(x)) - v.data();
+            CHECK(i == find(v, static_cast<T>(x), id) - v.begin());
+        }
+    }
+}
+
 int main()
 {
     using namespace ranges;
@@ -71,5 +93,33 @@ int main()
     auto it = ranges::find(vec, "b");
     CHECK(it == vec.begin() + 1);
 
+    test_contiguous_scalar<char>();
+    test_contiguous_scalar<unsigned char>();
+    test_contiguous_scalar<short>();
+    test_contiguous_scalar<int>();
+    test_contiguous_scalar<long long>();
+    test_contiguous_scalar<float>();
+    test_contiguous_scalar<double>();
+
+    {
+        // The value is converted as == would convert it.
+        signed char sc[] = {1, -1, 2, 127};
+        CHECK(find(sc, -1) == sc + 1);
+        CHECK(find(sc, 255) == end(sc));
+        CHECK(find(sc, 127L) == sc + 3);
+        unsigned char uc[] = {1, 255, 2};
+        CHECK(find(uc, -1) == end(uc));
+        CHECK(find(uc, 255) == uc + 1);
+        unsigned int ui[] = {1, 0xFFFFFFFFu, 2};
+        CHECK(find(ui, -1) == ui + 1);
+        long long ll[] = {1, 0x100000001LL, 1LL << 32, 2};
+        CHECK(find(ll, 1LL << 32) == ll + 2);
+
+        // NaN compares unequal to everything; -0.0 == 0.0.
+        double d[] = {1.0, std::numeric_limits<double>::quiet_NaN(), -0.0, 2.0};
+        CHECK(find(d, std::numeric_limits<double>::quiet_NaN()) == end(d));
+        CHECK(find(d, 0.0) == d + 2);
+    }
+
     return ::test_result();
 }
@@ -19,6 +19,7 @@
 //===----------------------------------------------------------------------===//
 
 #include <utility>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/find_if.hpp>
 #include "../simple_test.hpp"
@@ -69,5 +70,19 @@ int main()
     ps = find_if(sa, [](int i){return i == 10;}, &S::i_);
     CHECK(ps == end(sa));
 
+    // Check the parallel overloads
+    {
+        std::vector<int> v(100000);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            v[i] = i % 5000;
+        // The first of several matches must be found.
+        CHECK(find_if(par, v, [](int i){return i == 4321;}) == v.begin() + 4321);
+        CHECK(find_if(par, v.begin(), v.end(), [](int i){return i < 0;}) == v.end());
+        std::vector<S> w(100000, S{0});
+        w[99999].i_ = 1;
+        CHECK(find_if(par_unseq, w, [](int i){return i == 1;}, &S::i_) == w.end() - 1);
+        CHECK(find_if(seq, w, [](int i){return i == 1;}, &S::i_) == w.end() - 1);
+    }
+
     return ::test_result();
 }
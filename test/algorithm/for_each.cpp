@@ -9,8 +9,10 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <atomic>
 #include <vector>
 #include <range/v3/core.hpp>
+#include <range/v3/algorithm/count.hpp>
 #include <range/v3/algorithm/for_each.hpp>
 #include "../simple_test.hpp"
 
@@ -46,5 +48,19 @@ int main()
     CHECK(ranges::for_each(ranges::make_iterator_range(v1.begin(), v1.end()), fun).in().get_unsafe() == v1.end());
     CHECK(sum == 12);
 
+    // Check the parallel overloads
+    {
+        std::vector<int> v(100000);
+        CHECK(ranges::for_each(ranges::par, v, [](int &i){ i = 1; }).in() == v.end());
+        CHECK(ranges::count(v, 1) == 100000);
+        std::atomic<int> asum{0};
+        CHECK(ranges::for_each(ranges::par, v.begin(), v.end(), [&](int i){ asum += i; }).in() == v.end());
+        CHECK(asum == 100000);
+        std::vector<S> v3(10000, S{&sum, 1});
+        sum = 0;
+        CHECK(ranges::for_each(ranges::seq, v3, &S::p).in() == v3.end());
+        CHECK(sum == 10000);
+    }
+
     return ::test_result();
 }
@@ -19,6 +19,7 @@
 //===----------------------------------------------------------------------===//
 
 #include <functional>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/set_algorithm.hpp>
 #include "../simple_test.hpp"
@@ -159,5 +160,18 @@ int main()
         ));
     }
 
+    // Inputs of very different sizes, where the larger is skipped through by
+    // galloping
+    {
+        std::vector<int> big(10000);
+        for(int i = 0; i < 10000; ++i)
+            big[i] = 3 * i;
+        CHECK(ranges::includes(big, std::vector<int>{0, 9, 3000, 3003, 29997}));
+        CHECK(!ranges::includes(big, std::vector<int>{0, 9, 3001, 29997}));
+        CHECK(!ranges::includes(big, std::vector<int>{0, 9, 29997, 30000}));
+        CHECK(!ranges::includes(big, std::vector<int>{-3, 9}));
+        CHECK(ranges::includes(big, std::vector<int>{}));
+    }
+
     return ::test_result();
 }
@@ -18,6 +18,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/lexicographical_compare.hpp>
 #include "../simple_test.hpp"
@@ -167,10 +168,46 @@ void test_iter_comp()
 }
 
 
+template<typename T>
+void test_contiguous_scalar()
+{
+    using namespace ranges;
+    auto id = [](T t) { return t; };
+    for(int n : {0, 1, 16, 17, 33, 100})
+    {
+        std::vector<T> a(static_cast<std::size_t>(n));
+        for(int i = 0; i < n; ++i)
+            a[static_cast<std::size_t>(i)] = static_cast<T>(i - 50);
+        for(int k = 0; k <= n; ++k)
+        {
+            for(int d : {-1, 1})
+            {
+                std::vector<T> b = a;
+                if(k < n)
+                    b[static_cast<std::size_t>(k)] = static_cast<T>(b[static_cast<std::size_t>(k)] + d);
+                else
+                    b.push_back(T{});
+                CHECK(lexicographical_compare(a, b) == lexicographical_compare(a, b, ordered_less{}, id, id));
+                CHECK(lexicographical_compare(b, a) == lexicographical_compare(b, a, ordered_less{}, id, id));
+                CHECK(lexicographical_compare(a, b) != lexicographical_compare(b, a));
+            }
+        }
+        CHECK(!lexicographical_compare(a, a));
+    }
+}
+
 int main()
 {
     test_iter();
     test_iter_comp();
 
+    test_contiguous_scalar<char>();
+    test_contiguous_scalar<signed char>();
+    test_contiguous_scalar<unsigned char>();
+    test_contiguous_scalar<short>();
+    test_contiguous_scalar<unsigned short>();
+    test_contiguous_scalar<int>();
+    test_contiguous_scalar<unsigned long long>();
+
     return test_result();
 }
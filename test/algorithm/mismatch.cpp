@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <algorithm>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/mismatch.hpp>
 #include "../simple_test.hpp"
@@ -97,6 +98,32 @@ struct S
     int i;
 };
 
+template<typename T>
+void test_contiguous_scalar()
+{
+    auto id = [](T t) { return t; };
+    for(int n : {0, 1, 15, 16, 17, 32, 33, 100})
+    {
+        std::vector<T> a(static_cast<std::size_t>(n));
+        for(int i = 0; i < n; ++i)
+            a[static_cast<std::size_t>(i)] = static_cast<T>(i);
+        for(int k = 0; k <= n; ++k)
+        {
+            std::vector<T> b = a;
+            if(k < n)
+                b[static_cast<std::size_t>(k)] = static_cast<T>(n + 1);
+            auto r = ranges::mismatch(a, b);
+            CHECK((r.first - a.begin()) == k);
+            CHECK((r.second - b.begin()) == k);
+            CHECK(r.first == ranges::mismatch(a, b, ranges::equal_to{}, id, id).first);
+            CHECK(ranges::mismatch(a.begin(), a.end(), b.begin()).first == r.first);
+            // The shorter range bounds the search.
+            auto r2 = ranges::mismatch(a.begin(), a.begin() + k / 2, b.begin(), b.end());
+            CHECK((r2.first - a.begin()) == k / 2);
+        }
+    }
+}
+
 int main()
 {
     test_iter<input_iterator<const int*>>();
@@ -133,5 +160,12 @@ int main()
     CHECK(ps2.first->i == -4);
     CHECK(ps2.second->i == 5);
 
+    test_contiguous_scalar<unsigned char>();
+    test_contiguous_scalar<short>();
+    test_contiguous_scalar<int>();
+    test_contiguous_scalar<long long>();
+    test_contiguous_scalar<float>();
+    test_contiguous_scalar<double>();
+
     return test_result();
 }
@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <algorithm>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/move.hpp>
 #include "../simple_test.hpp"
@@ -237,5 +238,20 @@ int main()
     test1<random_access_iterator<std::unique_ptr<int>*>, bidirectional_iterator<std::unique_ptr<int>*>, sentinel<std::unique_ptr<int>*> >();
     test1<random_access_iterator<std::unique_ptr<int>*>, random_access_iterator<std::unique_ptr<int>*>, sentinel<std::unique_ptr<int>*> >();
 
+    // Contiguous ranges of trivially movable elements
+    {
+        std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7};
+        int out[8] = {};
+        auto res = ranges::move(v, out);
+        CHECK(res.in() == v.end());
+        CHECK(res.out() == out + 8);
+        CHECK(std::equal(v.begin(), v.end(), out));
+        auto res2 = ranges::move(out + 1, out + 8, out);
+        CHECK(res2.in() == out + 8);
+        CHECK(res2.out() == out + 7);
+        int const expected[] = {1, 2, 3, 4, 5, 6, 7, 7};
+        CHECK(std::equal(out, out + 8, expected));
+    }
+
     return test_result();
 }
@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <algorithm>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/move_backward.hpp>
 #include "../simple_test.hpp"
@@ -140,5 +141,15 @@ int main()
     test1<std::unique_ptr<int>*, random_access_iterator<std::unique_ptr<int>*> >();
     test1<std::unique_ptr<int>*, std::unique_ptr<int>*>();
 
+    // Contiguous ranges of trivially movable elements
+    {
+        std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7};
+        auto res = ranges::move_backward(v.begin(), v.begin() + 7, v.end());
+        CHECK(res.in() == v.begin() + 7);
+        CHECK(res.out() == v.begin() + 1);
+        int const expected[] = {0, 0, 1, 2, 3, 4, 5, 6};
+        CHECK(std::equal(v.begin(), v.end(), expected));
+    }
+
     return test_result();
 }
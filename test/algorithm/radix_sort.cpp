@@ -0,0 +1,219 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <algorithm>
+#include <cmath>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/radix_sort.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+RANGES_DIAGNOSTIC_IGNORE_GLOBAL_CONSTRUCTORS
+RANGES_DIAGNOSTIC_IGNORE_SIGN_CONVERSION
+
+namespace
+{
+    std::mt19937_64 gen;
+
+    struct record
+    {
+        std::uint64_t key;
+        int order;
+    };
+
+    bool operator==(record const &a, record const &b)
+    {
+        return a.key == b.key && a.order == b.order;
+    }
+    bool operator!=(record const &a, record const &b)
+    {
+        return !(a == b);
+    }
+
+    // Sort a copy of v with radix_sort, sequentially and in parallel, and
+    // check both against std::stable_sort.
+    template<typename T, typename Less, typename P = ranges::ident>
+    void check_sort(std::vector<T> const &v, Less less, P proj = P{})
+    {
+        std::vector<T> expected = v;
+        std::stable_sort(expected.begin(), expected.end(), less);
+
+        std::vector<T> w = v;
+        CHECK(ranges::radix_sort(w, proj) == w.end());
+        CHECK(ranges::equal(w, expected));
+
+        w = v;
+        CHECK(ranges::radix_sort(ranges::par, w.begin(), w.end(), proj) == w.end());
+        CHECK(ranges::equal(w, expected));
+    }
+
+    template<typename T>
+    void test_integers()
+    {
+        std::uniform_int_distribution<T> dist(std::numeric_limits<T>::min(),
+            std::numeric_limits<T>::max());
+        for(std::size_t n : {0, 1, 2, 100, 200000})
+        {
+            std::vector<T> v(n);
+            for(T &t : v)
+                t = dist(gen);
+            check_sort(v, std::less<T>{});
+        }
+    }
+
+    template<typename T>
+    void test_floating_point()
+    {
+        std::uniform_real_distribution<T> dist(-1e6, 1e6);
+        std::vector<T> v(100000);
+        for(T &t : v)
+            t = dist(gen);
+        v[0] = std::numeric_limits<T>::infinity();
+        v[1] = -std::numeric_limits<T>::infinity();
+        v[2] = T(0);
+        v[3] = std::numeric_limits<T>::denorm_min();
+        v[4] = -std::numeric_limits<T>::denorm_min();
+        check_sort(v, std::less<T>{});
+
+        // -0.0 sorts before 0.0.
+        std::vector<T> z = {T(0), -T(0), T(0), -T(0)};
+        ranges::radix_sort(z);
+        CHECK(std::signbit(z[0]));
+        CHECK(std::signbit(z[1]));
+        CHECK(!std::signbit(z[2]));
+        CHECK(!std::signbit(z[3]));
+    }
+
+    // Few distinct keys in a projection, so that stability shows.
+    void test_stable()
+    {
+        for(std::uint64_t distinct : {std::uint64_t(1), std::uint64_t(16),
+                std::uint64_t(1) << 40})
+        {
+            std::uniform_int_distribution<std::uint64_t> dist(0, distinct - 1);
+            std::vector<record> v(200000);
+            int i = 0;
+            for(record &r : v)
+                r = record{dist(gen) << 8, i++};
+            check_sort(v, [](record const &a, record const &b) { return a.key < b.key; },
+                &record::key);
+        }
+    }
+
+    void test_byte_arrays()
+    {
+        using key = std::array<unsigned char, 5>;
+        std::uniform_int_distribution<int> dist(0, 255);
+        std::vector<key> v(20000);
+        for(key &k : v)
+            for(unsigned char &c : k)
+                c = static_cast<unsigned char>(dist(gen) & 0x83);
+        check_sort(v, std::less<key>{});
+    }
+
+    std::string random_string(std::size_t max_length, int letters)
+    {
+        std::uniform_int_distribution<std::size_t> length(0, max_length);
+        std::uniform_int_distribution<int> letter(0, letters - 1);
+        std::string s(length(gen), 'a');
+        for(char &c : s)
+            c = static_cast<char>(letter(gen) == 0 ? '\xe9' : 'a' + letter(gen));
+        return s;
+    }
+
+    void test_strings()
+    {
+        for(std::size_t n : {0, 1, 30, 1000, 100000})
+        {
+            std::vector<std::string> v(n);
+            for(std::string &s : v)
+                s = random_string(12, 4);
+            check_sort(v, std::less<std::string>{});
+        }
+
+        // Long common prefixes, many duplicates, and strings that are prefixes
+        // of one another.
+        std::vector<std::string> v;
+        std::string const prefix(300, 'x');
+        for(int i = 0; i < 5000; ++i)
+        {
+            v.push_back(prefix + random_string(3, 3));
+            v.push_back(prefix.substr(0, static_cast<std::size_t>(i % 300)));
+        }
+        check_sort(v, std::less<std::string>{});
+
+        // By a projection, stably.
+        std::vector<std::pair<std::string, int>> p;
+        for(int i = 0; i < 50000; ++i)
+            p.emplace_back(random_string(3, 3), i);
+        check_sort(p, [](std::pair<std::string, int> const &a,
+                std::pair<std::string, int> const &b) { return a.first < b.first; },
+            &std::pair<std::string, int>::first);
+    }
+}
+
+int main()
+{
+    using namespace ranges;
+
+    test_integers<std::uint8_t>();
+    test_integers<std::int8_t>();
+    test_integers<std::uint16_t>();
+    test_integers<std::int32_t>();
+    test_integers<std::uint64_t>();
+    test_integers<std::int64_t>();
+    test_floating_point<float>();
+    test_floating_point<double>();
+    test_stable();
+    test_byte_arrays();
+    test_strings();
+
+    // Move-only elements, projected to a key.
+    {
+        std::vector<std::unique_ptr<int>> v;
+        for(int i = 0; i < 1000; ++i)
+            v.emplace_back(new int((i * 7919) % 1000 - 500));
+        auto const deref = [](std::unique_ptr<int> const &p) { return *p; };
+        CHECK(radix_sort(v, deref) == v.end());
+        for(int i = 0; i < 1000; ++i)
+            CHECK(*v[static_cast<std::size_t>(i)] == i - 500);
+    }
+
+    // Iterator and sentinel.
+    {
+        int a[] = {5, -3, 9, 0, -3, 7};
+        int const sorted[] = {-3, -3, 0, 5, 7, 9};
+        auto const r = radix_sort(random_access_iterator<int *>(a),
+            sentinel<int *>(a + 6));
+        CHECK(base(r) == a + 6);
+        CHECK(equal(a, sorted));
+    }
+
+    // Types without a radix key are rejected.
+    static_assert(RadixSortable<int *>(), "");
+    static_assert(RadixSortable<std::string *>(), "");
+    static_assert(!RadixSortable<long double *>(), "");
+    static_assert(!RadixSortable<bool *>(), "");
+    static_assert(!RadixSortable<std::wstring *>(), "");
+    static_assert(!RadixSortable<bidirectional_iterator<int *>>(), "");
+    static_assert(RadixSortable<record *, std::uint64_t record::*>(), "");
+
+    return ::test_result();
+}
@@ -24,8 +24,11 @@
 //===----------------------------------------------------------------------===//
 
 #include <array>
+#include <vector>
 #include <range/v3/core.hpp>
+#include <range/v3/algorithm/adjacent_find.hpp>
 #include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
 #include <range/v3/algorithm/sample.hpp>
 #include <range/v3/numeric/iota.hpp>
 #include "../simple_test.hpp"
@@ -275,5 +278,56 @@ int main()
         }
     }
 
+    // Random numbers are drawn per element of the sample, not of the population.
+    {
+        std::vector<int> pop(1000000);
+        ranges::iota(pop, 0);
+        std::array<int, K> a{};
+        counting_engine<std::minstd_rand> g;
+        auto result = ranges::sample(pop, a.begin(), K, g);
+        CHECK(result.out() == a.end());
+        CHECK(ranges::is_sorted(a));
+        CHECK(ranges::adjacent_find(a) == a.end());
+        CHECK(g.draws_ < 20 * K);
+    }
+
+    // Each element is equally likely to be in the sample, whether the sample
+    // is sparse (Algorithm D), dense (Algorithm A) or the size of the input is
+    // unknown (Algorithm L).
+    {
+        std::minstd_rand g;
+        std::array<int, N> i;
+        ranges::iota(i, 0);
+        auto check_uniform = [&](std::array<int, N> const &counts, int n, int trials) {
+            int const expected = trials * n / int(N);
+            for(int c : counts)
+            {
+                CHECK(c > expected - expected / 4);
+                CHECK(c < expected + expected / 4);
+            }
+        };
+        std::array<int, N> sparse{}, dense{}, unsized{};
+        std::array<int, 40> out;
+        constexpr int trials = 20000;
+        for(int t = 0; t < trials; ++t)
+        {
+            auto r = ranges::sample(i, out.begin(), 2, g);
+            CHECK(out[0] < out[1]);
+            for(auto o = out.begin(); o != r.out(); ++o)
+                ++sparse[*o];
+            r = ranges::sample(i, out.begin(), 40, g);
+            for(auto o = out.begin(); o != r.out(); ++o)
+                ++dense[*o];
+            auto r2 = ranges::sample(input_iterator<int*>(i.data()),
+                sentinel<int*>(i.data() + N), out.begin(), 5, g);
+            CHECK(r2.out() == out.begin() + 5);
+            for(auto o = out.begin(); o != r2.out(); ++o)
+                ++unsized[*o];
+        }
+        check_uniform(sparse, 2, trials);
+        check_uniform(dense, 40, trials);
+        check_uniform(unsized, 5, trials);
+    }
+
     return ::test_result();
 }
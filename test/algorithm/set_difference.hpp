@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/fill.hpp>
 #include <range/v3/algorithm/set_algorithm.hpp>
@@ -360,6 +361,37 @@ int main()
         CHECK((res2.second - ic) == srr);
         CHECK(ranges::lexicographical_compare(ic, res2.second, ir, irr+srr, std::less<int>(), &U::k) == false);
     }
+
+    // Inputs of very different sizes, where one is skipped through by galloping
+    {
+        std::vector<int> big(10000), small = {-1, 5, 9, 3000, 3001, 3003, 29997, 40000};
+        for(int i = 0; i < 10000; ++i)
+            big[i] = 3 * i;
+        std::vector<int> out(big.size());
+        {
+            std::vector<int> expected;
+            std::set_difference(small.begin(), small.end(), big.begin(), big.end(),
+                std::back_inserter(expected));
+            CHECK(expected == (std::vector<int>{-1, 5, 3001, 40000}));
+            auto res = ranges::set_difference(small, big, out.data());
+            CHECK(std::vector<int>(out.data(), res.second) == expected);
+
+            // Inputs that cannot be searched are merged.
+            using In = input_iterator<const int*>;
+            auto res2 = ranges::set_difference(In(small.data()),
+                In(small.data() + small.size()), big.begin(), big.end(), out.data());
+            CHECK(std::vector<int>(out.data(), res2.second) == expected);
+        }
+        {
+            std::vector<int> expected;
+            std::set_difference(big.begin(), big.end(), small.begin(), small.end(),
+                std::back_inserter(expected));
+            CHECK(expected.size() == 9996u);
+            auto res = ranges::set_difference(big, small, out.data());
+            CHECK(res.first == big.end());
+            CHECK(std::vector<int>(out.data(), res.second) == expected);
+        }
+    }
 #endif
 
     return ::test_result();
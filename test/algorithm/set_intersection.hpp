@@ -19,7 +19,10 @@
 //===----------------------------------------------------------------------===//
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
+#include <random>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/fill.hpp>
 #include <range/v3/algorithm/set_algorithm.hpp>
@@ -91,6 +94,30 @@ struct U
     U& operator=(T t) { k = t.j; return *this;}
 };
 
+// Sorted runs of n and m integers drawn from [lo, lo + range), with
+// duplicates, intersected as std::set_intersection would.
+template <class Int>
+void
+test_integers(std::mt19937 &gen, int n, int m, int lo, int range)
+{
+    std::uniform_int_distribution<int> dist(lo, lo + range - 1);
+    std::vector<Int> a(n), b(m);
+    for(Int &x : a)
+        x = static_cast<Int>(dist(gen));
+    for(Int &x : b)
+        x = static_cast<Int>(dist(gen));
+    std::sort(a.begin(), a.end());
+    std::sort(b.begin(), b.end());
+    std::vector<Int> expected, out(a.size() + b.size());
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+        std::back_inserter(expected));
+
+    Int *res = ranges::set_intersection(a, b, out.data());
+    CHECK(std::vector<Int>(out.data(), res) == expected);
+    res = ranges::set_intersection(b, a, out.data());
+    CHECK(std::vector<Int>(out.data(), res) == expected);
+}
+
 int main()
 {
 #ifdef SET_INTERSECTION_1
@@ -275,6 +302,43 @@ int main()
         CHECK((res - ic) == sr);
         CHECK(ranges::lexicographical_compare(ic, res, ir, ir+sr, std::less<int>(), &U::k) == false);
     }
+
+    // Inputs of very different sizes, where one is skipped through by galloping
+    {
+        std::vector<int> big(10000), small = {-1, 5, 9, 3000, 3001, 3003, 29997, 40000};
+        for(int i = 0; i < 10000; ++i)
+            big[i] = 3 * i;
+        std::vector<int> expected, out(small.size());
+        std::set_intersection(small.begin(), small.end(), big.begin(), big.end(),
+            std::back_inserter(expected));
+        CHECK(expected == (std::vector<int>{9, 3000, 3003, 29997}));
+
+        int *res = ranges::set_intersection(big, small, out.data());
+        CHECK(std::vector<int>(out.data(), res) == expected);
+        res = ranges::set_intersection(small, big, out.data());
+        CHECK(std::vector<int>(out.data(), res) == expected);
+
+        // Inputs that cannot be searched are merged.
+        using In = input_iterator<const int*>;
+        res = ranges::set_intersection(In(small.data()), In(small.data() + small.size()),
+            big.begin(), big.end(), out.data());
+        CHECK(std::vector<int>(out.data(), res) == expected);
+    }
+
+    // Contiguous integers, intersected a block at a time, at several densities
+    // and with runs of duplicates
+    {
+        std::mt19937 gen;
+        for(int range : {20, 1000, 4000, 64000})
+        {
+            test_integers<int>(gen, 1000, 1000, -range / 2, range);
+            test_integers<std::uint32_t>(gen, 1000, 700, 0, range);
+            test_integers<std::int64_t>(gen, 1000, 1000, -range / 2, range);
+            test_integers<std::uint64_t>(gen, 700, 1000, 0, range);
+        }
+        for(int n = 0; n < 40; ++n)
+            test_integers<int>(gen, n, 40 - n, 0, 50);
+    }
 #endif
 
     return ::test_result();
@@ -23,14 +23,60 @@
 //===----------------------------------------------------------------------===//
 
 #include <array>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
 #include <range/v3/core.hpp>
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/algorithm/count_if.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/algorithm/shuffle.hpp>
+#include <range/v3/algorithm/sort.hpp>
 #include <range/v3/numeric/iota.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
 
+// Counts its live objects, and throws from the move that the countdown
+// reaches.
+struct tracked
+{
+    static std::atomic<long> live, moves_left;
+    int i = 0;
+    tracked()
+    {
+        ++live;
+    }
+    tracked(tracked const &that)
+      : i(that.i)
+    {
+        ++live;
+    }
+    tracked(tracked &&that)
+      : i(that.i)
+    {
+        count_down();
+        ++live;
+    }
+    tracked &operator=(tracked const &) = default;
+    tracked &operator=(tracked &&that)
+    {
+        count_down();
+        i = that.i;
+        return *this;
+    }
+    ~tracked()
+    {
+        --live;
+    }
+    static void count_down()
+    {
+        if(--moves_left == 0)
+            throw std::runtime_error("move");
+    }
+};
+std::atomic<long> tracked::live{0}, tracked::moves_left{0};
+
 int main()
 {
     constexpr unsigned N = 100;
@@ -91,5 +137,110 @@ int main()
         CHECK(!ranges::equal(a, b));
     }
 
+    {
+        // Every permutation is equally likely, for odd and even sizes.
+        ranges::xoshiro256starstar g{1u};
+        std::array<long, 6> counts3{};
+        for(long i = 0; i < 60000; ++i)
+        {
+            std::array<int, 3> a = {{0, 1, 2}};
+            ranges::shuffle(a, g);
+            ++counts3[a[0] * 2 + (a[1] > a[2])];
+        }
+        std::array<long, 24> counts4{};
+        for(long i = 0; i < 240000; ++i)
+        {
+            std::array<int, 4> a = {{0, 1, 2, 3}};
+            ranges::shuffle(a, g);
+            int code = 0;
+            for(int j = 0; j < 3; ++j)
+                code = code * (4 - j) + static_cast<int>(ranges::count_if(
+                    a.begin() + j + 1, a.end(), [&](int x) { return x < a[j]; }));
+            ++counts4[code];
+        }
+        for(long c : counts3)
+        {
+            CHECK(c > 7500);
+            CHECK(c < 12500);
+        }
+        for(long c : counts4)
+        {
+            CHECK(c > 7500);
+            CHECK(c < 12500);
+        }
+
+        // Short ranges
+        std::array<int, 1> one = {{4}};
+        CHECK(ranges::shuffle(one, g) == one.end());
+        CHECK(one[0] == 4);
+        std::array<int, 2> two = {{4, 5}};
+        CHECK(ranges::shuffle(two, g) == two.end());
+        CHECK(ranges::count(two, 4) == 1);
+        CHECK(ranges::count(two, 5) == 1);
+    }
+
+    {
+        // In parallel, large enough to scatter to buckets
+        std::vector<int> a(1 << 20), b(a.size()), c(a.size());
+        for (auto p : {&a, &b, &c})
+            ranges::iota(*p, 0);
+        ranges::xoshiro256starstar g1{5u}, g2 = g1;
+        CHECK(ranges::shuffle(ranges::par, a, g1) == a.end());
+        CHECK(ranges::shuffle(ranges::par, b.begin(), b.end(), g2) == b.end());
+        CHECK(ranges::equal(a, b));
+        CHECK(g1 == g2);
+        CHECK(!ranges::equal(a, c));
+
+        // Each sixteenth of the range is spread evenly over the sixteenths.
+        std::array<long, 256> counts{};
+        auto const part = static_cast<int>(a.size() / 16);
+        for (int i = 0; i < static_cast<int>(a.size()); ++i)
+            ++counts[static_cast<std::size_t>(a[static_cast<std::size_t>(i)] / part * 16 + i / part)];
+        for (long k : counts)
+        {
+            CHECK(k > 4096 * 3 / 4);
+            CHECK(k < 4096 * 5 / 4);
+        }
+
+        ranges::sort(a);
+        CHECK(ranges::equal(a, c));
+
+        // Sequenced, or too small to scatter, it is the sequential shuffle.
+        ranges::xoshiro256starstar g3{5u}, g4 = g3;
+        b = c;
+        ranges::shuffle(ranges::seq, a, g3);
+        ranges::shuffle(b, g4);
+        CHECK(ranges::equal(a, b));
+        std::array<int, N> d, e;
+        ranges::iota(d, 0);
+        ranges::iota(e, 0);
+        ranges::shuffle(ranges::par, d, g3);
+        ranges::shuffle(e, g4);
+        CHECK(ranges::equal(d, e));
+    }
+
+    {
+        // A move that throws, while the elements are moved into the buffer
+        // or scattered out of it, leaves no element of the buffer behind.
+        std::vector<tracked> a(1 << 20);
+        for(long at : {700000L, 1500000L})
+        {
+            tracked::moves_left = at;
+            ranges::xoshiro256starstar g{5u};
+            bool thrown = false;
+            try
+            {
+                ranges::shuffle(ranges::par, a, g);
+            }
+            catch(std::runtime_error const &)
+            {
+                thrown = true;
+            }
+            CHECK(thrown);
+            CHECK(tracked::live == static_cast<long>(a.size()));
+        }
+        tracked::moves_left = 0;
+    }
+
     return ::test_result();
 }
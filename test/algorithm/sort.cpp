@@ -20,11 +20,13 @@
 
 #include <memory>
 #include <random>
+#include <string>
 #include <vector>
 #include <algorithm>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/sort.hpp>
 #include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
 #include <range/v3/view/for_each.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/repeat_n.hpp>
@@ -235,6 +237,50 @@ namespace
     CONCEPT_ASSERT(ranges::DefaultConstructible<Int>());
     CONCEPT_ASSERT(ranges::Movable<Int>());
     CONCEPT_ASSERT(ranges::TotallyOrdered<Int>());
+
+    // Inputs with the patterns that pattern-defeating quicksort looks for,
+    // sorted as ints (partitioned a block at a time) and as strings.
+    void test_patterns()
+    {
+        std::mt19937 g;
+        for(int n : {0, 1, 2, 23, 24, 25, 128, 129, 1000, 100000})
+        {
+            for(int pattern = 0; pattern < 8; ++pattern)
+            {
+                std::vector<int> v(static_cast<std::size_t>(n));
+                for(int i = 0; i < n; ++i)
+                {
+                    int &x = v[static_cast<std::size_t>(i)];
+                    switch(pattern)
+                    {
+                    case 0: x = static_cast<int>(g()); break;              // random
+                    case 1: x = i; break;                                  // ascending
+                    case 2: x = n - i; break;                              // descending
+                    case 3: x = i < n / 2 ? i : n - i; break;              // organ pipe
+                    case 4: x = g() % 100 ? i : static_cast<int>(g()); break; // nearly sorted
+                    case 5: x = static_cast<int>(g() % 4); break;          // few distinct
+                    case 6: x = i % 2 ? i : n + i; break;                  // interleaved runs
+                    default: x = 7; break;                                 // all equal
+                    }
+                }
+                std::vector<int> w = v;
+                std::sort(w.begin(), w.end());
+                std::vector<int> a = v;
+                CHECK(ranges::sort(a) == a.end());
+                CHECK(a == w);
+                a = v;
+                ranges::sort(a, std::greater<int>());
+                CHECK(std::equal(a.begin(), a.end(), w.rbegin()));
+                std::vector<std::string> s, t;
+                for(int x : v)
+                    s.push_back(std::to_string(x));
+                t = s;
+                std::sort(t.begin(), t.end());
+                ranges::sort(s);
+                CHECK(s == t);
+            }
+        }
+    }
 }
 
 int main()
@@ -329,5 +375,52 @@ int main()
         sort(rng);
     }
 
+    // Check parallel sort against the sequential one
+    {
+        std::mt19937 gen;
+        std::uniform_int_distribution<int> dist(0, 999);
+        std::vector<S> v(100000, S{});
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            v[i].i = dist(gen);
+            v[i].j = i;
+        }
+        std::vector<S> w = v;
+        CHECK(ranges::sort(ranges::par, v, std::less<int>{}, &S::i) == v.end());
+        ranges::sort(w, std::less<int>{}, &S::i);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            CHECK(v[i].i == w[i].i);
+
+        std::vector<int> u(100000);
+        for(int i = 0; (std::size_t)i < u.size(); ++i)
+            u[i] = (int)u.size() - i;
+        CHECK(ranges::sort(ranges::par_unseq, u.begin(), u.end()) == u.end());
+        CHECK(ranges::is_sorted(u));
+        ranges::sort(ranges::seq, u, std::greater<int>{});
+        CHECK(ranges::is_sorted(u, std::greater<int>{}));
+    }
+
+    // Parallel sort with many duplicates, all duplicates, and non-trivial
+    // elements, at sizes around the threshold
+    {
+        std::mt19937 gen;
+        for(int distinct : {1, 3, 1000000})
+        {
+            std::uniform_int_distribution<int> dist(0, distinct - 1);
+            for(std::size_t n : {0u, 1u, 2047u, 2048u, 4097u, 60001u})
+            {
+                std::vector<std::string> v;
+                for(std::size_t i = 0; i < n; ++i)
+                    v.push_back(std::to_string(dist(gen)));
+                std::vector<std::string> w = v;
+                CHECK(ranges::sort(ranges::par, v) == v.end());
+                std::sort(w.begin(), w.end());
+                CHECK(v == w);
+            }
+        }
+    }
+
+    test_patterns();
+
     return ::test_result();
 }
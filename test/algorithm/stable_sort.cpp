@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <random>
+#include <string>
 #include <vector>
 #include <algorithm>
 #include <range/v3/core.hpp>
@@ -236,5 +237,60 @@ int main()
         }
     }
 
+    // Check parallel stable_sort against the sequential one
+    {
+        std::mt19937 gen;
+        std::uniform_int_distribution<int> dist(0, 99);
+        std::vector<S> v(100000, S{});
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            v[i].i = dist(gen);
+            v[i].j = i;
+        }
+        std::vector<S> w = v;
+        CHECK(ranges::stable_sort(ranges::par, v, std::less<int>{}, &S::i) == v.end());
+        ranges::stable_sort(w, std::less<int>{}, &S::i);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+        {
+            CHECK(v[i].i == w[i].i);
+            CHECK(v[i].j == w[i].j);
+        }
+    }
+
+    // Parallel stable_sort of move-only elements, at sizes around the grain
+    {
+        std::mt19937 gen;
+        std::uniform_int_distribution<int> dist(0, 9);
+        for(std::size_t n : {0u, 1u, 4095u, 4096u, 8193u, 50001u})
+        {
+            std::vector<std::unique_ptr<int>> v;
+            for(std::size_t i = 0; i < n; ++i)
+                v.emplace_back(new int(dist(gen)));
+            std::vector<int*> w;
+            for(auto &p : v)
+                w.push_back(p.get());
+            auto deref = [](std::unique_ptr<int> const &p) { return *p; };
+            CHECK(ranges::stable_sort(ranges::par, v, std::less<int>{}, deref) == v.end());
+            std::stable_sort(w.begin(), w.end(), [](int *a, int *b) { return *a < *b; });
+            CHECK(v.size() == n);
+            for(std::size_t i = 0; i < n; ++i)
+                CHECK(v[i].get() == w[i]);
+        }
+    }
+
+    // Elements that a self-move empties, such as std::string, survive the
+    // merges that use the temporary buffer.
+    {
+        std::mt19937 gen;
+        std::uniform_int_distribution<int> dist(0, 25);
+        std::vector<std::string> v(1000);
+        for(std::string &s : v)
+            s = std::string(1, static_cast<char>('a' + dist(gen)));
+        std::vector<std::string> w = v;
+        CHECK(ranges::stable_sort(v) == v.end());
+        std::stable_sort(w.begin(), w.end());
+        CHECK(v == w);
+    }
+
     return ::test_result();
 }
@@ -19,6 +19,7 @@
 //===----------------------------------------------------------------------===//
 
 #include <functional>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/transform.hpp>
 #include <range/v3/view/unbounded.hpp>
@@ -424,5 +425,28 @@ int main()
     static_assert(std::is_same<ranges::tagged_tuple<ranges::tag::in1(S const*), ranges::tag::in2(S const *), ranges::tag::out(int*)>,
         decltype(ranges::transform(s, s, p, binary, &S::i, &S::i))>::value, "");
 
+    static_assert(std::is_same<ranges::tagged_pair<ranges::tag::in(S const*), ranges::tag::out(int*)>,
+        decltype(ranges::transform(ranges::par, s, p, unary, &S::i))>::value, "");
+
+    // Check the parallel overloads
+    {
+        std::vector<S> in(100000);
+        for(int k = 0; (std::size_t)k < in.size(); ++k)
+            in[k].i = k;
+        std::vector<int> out(in.size()), seq_out(in.size());
+        auto r = ranges::transform(ranges::par, in, out.begin(), unary, &S::i);
+        CHECK(r.in() == in.end());
+        CHECK(r.out() == out.end());
+        ranges::transform(in, seq_out.begin(), unary, &S::i);
+        CHECK(out == seq_out);
+
+        // Non-random-access output falls back to the sequential loop.
+        std::vector<int> out2(in.size());
+        auto r2 = ranges::transform(ranges::par, in.begin(), in.end(),
+            forward_iterator<int*>(out2.data()), unary, &S::i);
+        CHECK(base(r2.out()) == out2.data() + out2.size());
+        CHECK(out2 == seq_out);
+    }
+
     return ::test_result();
 }
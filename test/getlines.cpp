@@ -10,6 +10,8 @@
 // Project home: https://github.com/ericniebler/range-v3
 
 #include <sstream>
+#include <string>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/range_traits.hpp>
 #include "./simple_test.hpp"
@@ -34,5 +36,34 @@ good men
     CONCEPT_ASSERT(!ForwardView<Rng>());
     CONCEPT_ASSERT(Same<range_rvalue_reference_t<Rng>, std::string &&>());
 
+    // buffered_getlines yields the same lines as getlines, including lines
+    // that cross a block and a last line with no delimiter.
+    for(std::string const &str : {std::string{text}, std::string{}, std::string{"\n"},
+        std::string{"no newline"}, std::string{"\n\nlong line here\nx\n\ny"}})
+    {
+        for(std::size_t block : {1u, 2u, 3u, 7u, 64u, 1u << 16})
+        {
+            std::stringstream sin1{str}, sin2{str};
+            std::vector<std::string> lines;
+            auto rng = buffered_getlines(sin2, '\n', block);
+            for(auto it = ranges::begin(rng); it != ranges::end(rng); ++it)
+                lines.emplace_back((*it).data(), static_cast<std::size_t>((*it).size()));
+            ::check_equal(lines, getlines(sin1));
+        }
+    }
+    {
+        std::stringstream sin{"a,b,,c"};
+        std::vector<std::string> fields;
+        auto rng = buffered_getlines(sin, ',', 2);
+        for(auto it = ranges::begin(rng); it != ranges::end(rng); ++it)
+            fields.emplace_back((*it).data(), static_cast<std::size_t>((*it).size()));
+        ::check_equal(fields, {"a", "b", "", "c"});
+    }
+
+    using BRng = decltype(buffered_getlines(sin));
+    CONCEPT_ASSERT(InputView<BRng>());
+    CONCEPT_ASSERT(!ForwardView<BRng>());
+    CONCEPT_ASSERT(Same<range_reference_t<BRng>, span<char const>>());
+
     return ::test_result();
 }
@@ -0,0 +1,98 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/mmap_file.hpp>
+#include <range/v3/span.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/view/lines.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+using namespace ranges;
+
+namespace
+{
+    void write_file(std::string const &path, std::string const &contents)
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << contents;
+    }
+}
+
+int main()
+{
+    std::string const path = "mmap_file_test.txt";
+    std::string const text = "Now is\nthe time\nfor all\ngood men";
+    write_file(path, text);
+
+    {
+        mmap_file<char> file{path};
+        CONCEPT_ASSERT(View<mmap_file<char>>());
+        CONCEPT_ASSERT(ContiguousRange<mmap_file<char>>());
+        CONCEPT_ASSERT(SizedRange<mmap_file<char>>());
+        CHECK(file.size() == text.size());
+        CHECK(equal(file, text));
+
+        // Copies share the mapping, which outlives the original.
+        mmap_file<char> copy;
+        CHECK(copy.empty());
+        {
+            mmap_file<char> other{path, mmap_hint::willneed};
+            copy = other;
+        }
+        CHECK(equal(copy, text));
+        copy.advise(mmap_hint::random, 4, 100);
+
+        std::vector<std::string> lines;
+        for(span<char const> line : file | view::lines)
+            lines.emplace_back(line.begin(), line.end());
+        ::check_equal(lines, {"Now is", "the time", "for all", "good men"});
+    }
+
+    // Trailing bytes that do not make up a whole element are left out.
+    write_file(path, std::string("\x01\x00\x00\x00\x02\x00\x00\x00\x03", 9));
+    {
+        mmap_file<std::uint32_t> file{path, mmap_hint::normal};
+        CHECK(file.size() == 2u);
+        CHECK((file[0] == 1u || file[0] == 0x01000000u));
+    }
+
+    // An empty file is an empty range.
+    write_file(path, "");
+    {
+        mmap_file<char> file{path};
+        CHECK(file.empty());
+        CHECK(file.begin() == file.end());
+        CHECK(distance(file | view::lines) == 0);
+    }
+
+    std::remove(path.c_str());
+
+    bool thrown = false;
+    try
+    {
+        mmap_file<char> file{path};
+    }
+    catch(std::system_error const &)
+    {
+        thrown = true;
+    }
+    CHECK(thrown);
+
+    return ::test_result();
+}
@@ -19,6 +19,8 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <string>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/numeric/accumulate.hpp>
 #include "../simple_test.hpp"
@@ -75,5 +77,18 @@ int main()
     CHECK(ranges::accumulate({1, 2, 3, 4, 5, 6}, S{10}, &S::add).i == 31);
     CHECK(ranges::accumulate({S{1}, S{2}, S{3}, S{4}, S{5}, S{6}}, 10, ranges::plus{}, &S::i) == 31);
 
+    // Check the parallel overloads
+    {
+        std::vector<S> v(100000, S{1});
+        CHECK(ranges::accumulate(ranges::par, v, 10, ranges::plus{}, &S::i) == 100010);
+        std::vector<std::string> w(10000);
+        for(int i = 0; (std::size_t)i < w.size(); ++i)
+            w[i] = std::to_string(i % 10);
+        // Not commutative: partial results must be combined in order.
+        CHECK(ranges::accumulate(ranges::par, w, std::string{}) ==
+            ranges::accumulate(w, std::string{}));
+        CHECK(ranges::accumulate(ranges::seq, w.begin(), w.end(), std::string{"x"}).size() == 10001u);
+    }
+
     return ::test_result();
 }
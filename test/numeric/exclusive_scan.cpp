@@ -0,0 +1,99 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/exclusive_scan.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+#include "../test_utils.hpp"
+
+struct S
+{
+    int i;
+};
+
+template <class InIter, class OutIter, class InSent = InIter>
+void test()
+{
+    int ia[] = {1, 2, 3, 4, 5};
+    int ir[] = {10, 11, 13, 16, 20};
+    const unsigned s = sizeof(ia) / sizeof(ia[0]);
+    int ib[s] = {0};
+    auto r = ranges::exclusive_scan(InIter(ia), InSent(ia + s), OutIter(ib), 10);
+    CHECK(base(r.in()) == ia + s);
+    CHECK(base(r.out()) == ib + s);
+    ::check_equal(ib, ir);
+
+    int ic[s] = {0};
+    auto rng = ranges::make_iterator_range(InIter(ia), InSent(ia + s));
+    auto r2 = ranges::exclusive_scan(rng, OutIter(ic), 10);
+    CHECK(base(r2.in()) == ia + s);
+    CHECK(base(r2.out()) == ic + s);
+    ::check_equal(ic, ir);
+
+    auto r3 = ranges::exclusive_scan(InIter(ia), InSent(ia), OutIter(ic), 10);
+    CHECK(base(r3.out()) == ic);
+}
+
+int main()
+{
+    test<input_iterator<const int*>, output_iterator<int*> >();
+    test<forward_iterator<const int*>, forward_iterator<int*> >();
+    test<bidirectional_iterator<const int*>, random_access_iterator<int*> >();
+    test<random_access_iterator<const int*>, int*>();
+    test<const int*, int*>();
+
+    test<input_iterator<const int*>, output_iterator<int*>, sentinel<const int*> >();
+    test<random_access_iterator<const int*>, int*, sentinel<const int*> >();
+
+    {
+        S s[] = {{1}, {2}, {3}};
+        int out[3];
+        ranges::exclusive_scan(s, ranges::begin(out), 1, ranges::multiplies{}, &S::i);
+        ::check_equal(out, {1, 1, 2});
+    }
+
+    // Check the parallel overloads
+    {
+        std::vector<S> v(100003, S{1});
+        std::vector<int> out(v.size());
+        auto r = ranges::exclusive_scan(ranges::par, v, out.begin(), 5, ranges::plus{}, &S::i);
+        CHECK(r.in() == v.end());
+        CHECK(r.out() == out.end());
+        bool ok = true;
+        for(std::size_t i = 0; i < out.size(); ++i)
+            ok = ok && out[i] == (int)(i + 5);
+        CHECK(ok);
+
+        // Not commutative: the pieces must be scanned in order.
+        std::vector<std::string> w(10000);
+        for(std::size_t i = 0; i < w.size(); ++i)
+            w[i] = std::to_string(i % 10);
+        std::vector<std::string> expected(w.size()), actual(w.size());
+        ranges::exclusive_scan(w, expected.begin(), std::string{"x"});
+        ranges::exclusive_scan(ranges::par, w.begin(), w.end(), actual.begin(),
+            std::string{"x"});
+        CHECK(actual == expected);
+        CHECK(expected.front() == "x");
+        CHECK(expected.back().size() == 10000u);
+
+        // In place
+        std::vector<int> x(20000, 1);
+        ranges::exclusive_scan(ranges::par, x, x.begin(), 0);
+        CHECK(x.back() == 19999);
+        CHECK(x[4096] == 4096);
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,98 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/inclusive_scan.hpp>
+#include <range/v3/numeric/partial_sum.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+#include "../test_utils.hpp"
+
+struct S
+{
+    int i;
+};
+
+template <class InIter, class OutIter, class InSent = InIter>
+void test()
+{
+    int ia[] = {1, 2, 3, 4, 5};
+    int ir[] = {1, 3, 6, 10, 15};
+    const unsigned s = sizeof(ia) / sizeof(ia[0]);
+    int ib[s] = {0};
+    auto r = ranges::inclusive_scan(InIter(ia), InSent(ia + s), OutIter(ib));
+    CHECK(base(r.in()) == ia + s);
+    CHECK(base(r.out()) == ib + s);
+    for(unsigned i = 0; i < s; ++i)
+        CHECK(ib[i] == ir[i]);
+
+    int ic[s] = {0};
+    auto rng = ranges::make_iterator_range(InIter(ia), InSent(ia + s));
+    auto r2 = ranges::inclusive_scan(rng, OutIter(ic));
+    CHECK(base(r2.in()) == ia + s);
+    CHECK(base(r2.out()) == ic + s);
+    ::check_equal(ic, ir);
+}
+
+int main()
+{
+    test<input_iterator<const int*>, output_iterator<int*> >();
+    test<forward_iterator<const int*>, forward_iterator<int*> >();
+    test<bidirectional_iterator<const int*>, random_access_iterator<int*> >();
+    test<random_access_iterator<const int*>, int*>();
+    test<const int*, int*>();
+
+    test<input_iterator<const int*>, output_iterator<int*>, sentinel<const int*> >();
+    test<random_access_iterator<const int*>, int*, sentinel<const int*> >();
+
+    {
+        S s[] = {{1}, {2}, {3}};
+        int out[3];
+        ranges::inclusive_scan(s, ranges::begin(out), ranges::multiplies{}, &S::i);
+        ::check_equal(out, {1, 2, 6});
+    }
+
+    // Check the parallel overloads
+    {
+        std::vector<S> v(100003, S{1});
+        std::vector<int> out(v.size());
+        auto r = ranges::inclusive_scan(ranges::par, v, out.begin(), ranges::plus{}, &S::i);
+        CHECK(r.in() == v.end());
+        CHECK(r.out() == out.end());
+        bool ok = true;
+        for(std::size_t i = 0; i < out.size(); ++i)
+            ok = ok && out[i] == (int)(i + 1);
+        CHECK(ok);
+
+        // Not commutative: the pieces must be scanned in order.
+        std::vector<std::string> w(10000);
+        for(std::size_t i = 0; i < w.size(); ++i)
+            w[i] = std::to_string(i % 10);
+        std::vector<std::string> expected(w.size()), actual(w.size());
+        ranges::partial_sum(w, expected.begin());
+        ranges::inclusive_scan(ranges::par, w.begin(), w.end(), actual.begin());
+        CHECK(actual == expected);
+
+        // In place
+        std::vector<int> x(20000, 1);
+        ranges::inclusive_scan(ranges::par, x, x.begin());
+        CHECK(x.back() == 20000);
+        CHECK(x[4095] == 4096);
+
+        std::vector<int> empty;
+        CHECK(ranges::inclusive_scan(ranges::par, empty, out.begin()).out() == out.begin());
+    }
+
+    return ::test_result();
+}
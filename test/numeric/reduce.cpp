@@ -0,0 +1,77 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/numeric/reduce.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+struct S
+{
+    int i;
+};
+
+template <class Iter, class Sent = Iter>
+void test()
+{
+    int ia[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    constexpr unsigned sc = ranges::size(ia);
+    for(unsigned n = 0; n <= sc; ++n)
+    {
+        CHECK(ranges::reduce(Iter(ia), Sent(ia+n), 0) == (int)(n * (n + 1) / 2));
+        CHECK(ranges::reduce(Iter(ia), Sent(ia+n), 10) == (int)(10 + n * (n + 1) / 2));
+        auto rng = ranges::make_iterator_range(Iter(ia), Sent(ia+n));
+        CHECK(ranges::reduce(rng, 0) == (int)(n * (n + 1) / 2));
+    }
+}
+
+int main()
+{
+    test<input_iterator<const int*> >();
+    test<forward_iterator<const int*> >();
+    test<bidirectional_iterator<const int*> >();
+    test<random_access_iterator<const int*> >();
+    test<const int*>();
+
+    test<input_iterator<const int*>, sentinel<const int*> >();
+    test<forward_iterator<const int*>, sentinel<const int*> >();
+    test<bidirectional_iterator<const int*>, sentinel<const int*> >();
+    test<random_access_iterator<const int*>, sentinel<const int*> >();
+
+    CHECK(ranges::reduce({1, 2, 3, 4, 5, 6}, 10) == 31);
+    CHECK(ranges::reduce({1, 2, 3, 4, 5, 6, 7, 8, 9}, 1, ranges::multiplies{}) == 362880);
+    CHECK(ranges::reduce({S{1}, S{2}, S{3}, S{4}, S{5}, S{6}}, 10, ranges::plus{}, &S::i) == 31);
+
+    // Check the parallel overloads
+    {
+        std::vector<S> v(100003, S{1});
+        CHECK(ranges::reduce(ranges::par, v, 10, ranges::plus{}, &S::i) == 100013);
+        CHECK(ranges::reduce(ranges::par, v.begin(), v.begin() + 5, 0, ranges::plus{}, &S::i) == 5);
+        CHECK(ranges::reduce(ranges::par, v.begin(), v.begin(), 7, ranges::plus{}, &S::i) == 7);
+        CHECK(ranges::reduce(ranges::seq, v, 0, ranges::plus{}, &S::i) == 100003);
+        // Small integers sum exactly in any order.
+        std::vector<double> w(50001);
+        for(std::size_t i = 0; i < w.size(); ++i)
+            w[i] = (double)(i % 17);
+        CHECK(ranges::reduce(ranges::par, w, 0.0) == ranges::accumulate(w, 0.0));
+        CHECK(ranges::reduce(w, 0.0) == ranges::accumulate(w, 0.0));
+    }
+
+    // The pieces of a parallel reduction depend on the size of the range alone.
+    CHECK(ranges::detail::fixed_chunk_count(std::ptrdiff_t(100000), std::ptrdiff_t(4096)) == 24);
+    CHECK(ranges::detail::fixed_chunk_count(std::ptrdiff_t(1) << 24, std::ptrdiff_t(4096)) == 64);
+    CHECK(ranges::detail::fixed_chunk_count(std::ptrdiff_t(10), std::ptrdiff_t(4096)) == 1);
+
+    return ::test_result();
+}
@@ -0,0 +1,79 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/numeric/inner_product.hpp>
+#include <range/v3/numeric/transform_reduce.hpp>
+#include "../simple_test.hpp"
+#include "../test_iterators.hpp"
+
+struct S
+{
+    int i;
+};
+
+template <class Iter1, class Iter2, class Sent1 = Iter1>
+void test()
+{
+    int a[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    int b[] = {6, 5, 4, 3, 2, 1, 0, 1, 2, 3};
+    unsigned const sa = sizeof(a) / sizeof(a[0]);
+    for(unsigned n = 0; n <= sa; ++n)
+    {
+        int const expected = ranges::inner_product(a, a + n, b, 0);
+        CHECK(ranges::transform_reduce(Iter1(a), Sent1(a+n), Iter2(b), 0) == expected);
+        CHECK(ranges::transform_reduce(Iter1(a), Sent1(a+n), Iter2(b), 10) == expected + 10);
+        CHECK(ranges::transform_reduce(Iter1(a), Sent1(a+n), Iter2(b), Iter2(b+sa), 0) ==
+            expected);
+        auto rng = ranges::make_iterator_range(Iter1(a), Sent1(a+n));
+        CHECK(ranges::transform_reduce(rng, Iter2(b), 0) == expected);
+    }
+    // The shorter range bounds the fold.
+    CHECK(ranges::transform_reduce(Iter1(a), Sent1(a+sa), Iter2(b), Iter2(b+3), 0) == 28);
+}
+
+int main()
+{
+    test<input_iterator<const int*>, input_iterator<const int*> >();
+    test<input_iterator<const int*>, forward_iterator<const int*> >();
+    test<forward_iterator<const int*>, random_access_iterator<const int*> >();
+    test<random_access_iterator<const int*>, input_iterator<const int*> >();
+    test<random_access_iterator<const int*>, random_access_iterator<const int*> >();
+    test<const int*, const int*>();
+
+    test<input_iterator<const int*>, input_iterator<const int*>, sentinel<const int*> >();
+    test<random_access_iterator<const int*>, random_access_iterator<const int*>,
+        sentinel<const int*> >();
+
+    CHECK(ranges::transform_reduce({1, 2, 3}, {4, 5, 6}, 0) == 32);
+    CHECK(ranges::transform_reduce({1, 2, 3}, {4, 5, 6}, 0, ranges::plus{}, ranges::plus{}) == 21);
+    {
+        S s[] = {{1}, {2}, {3}};
+        CHECK(ranges::transform_reduce(s, s, 0, ranges::plus{}, ranges::multiplies{}, &S::i,
+            &S::i) == 14);
+    }
+
+    // Check the parallel overloads
+    {
+        std::vector<S> v(100003, S{2});
+        std::vector<int> w(100003, 3);
+        CHECK(ranges::transform_reduce(ranges::par, v, w, 1, ranges::plus{},
+            ranges::multiplies{}, &S::i) == 600019);
+        CHECK(ranges::transform_reduce(ranges::par, v.begin(), v.end(), w.begin(),
+            w.begin() + 10, 0, ranges::plus{}, ranges::multiplies{}, &S::i) == 60);
+        CHECK(ranges::transform_reduce(ranges::seq, v, w, 0, ranges::plus{},
+            ranges::multiplies{}, &S::i) == 600018);
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,125 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <set>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/par_to_container.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/take_while.hpp>
+#include <range/v3/view/transform.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+struct is_odd
+{
+    bool operator()(int i) const
+    {
+        return i % 2 != 0;
+    }
+};
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v(100003);
+    for(std::size_t i = 0; i < v.size(); ++i)
+        v[i] = (int)i;
+
+    // transform | filter, with lambdas, which are not default constructible
+    {
+        auto rng = v | view::transform([](int i) { return i * 3; })
+                     | view::filter([](int i) { return i % 2 == 0; });
+        std::vector<int> const expected = to_vector(rng);
+        CHECK(expected.size() == 50002u);
+        CHECK((rng | par_to_vector) == expected);
+        CHECK(par_to_vector(rng) == expected);
+        CHECK((rng | par_to<std::vector>()) == expected);
+        std::vector<long> const longs = rng | par_to<std::vector<long>>();
+        CHECK(longs.size() == expected.size());
+        CHECK(longs.back() == 300006L);
+    }
+
+    // remove_if
+    {
+        auto rng = v | view::remove_if(is_odd{});
+        std::vector<int> const got = rng | par_to_vector;
+        CHECK(got.size() == 50002u);
+        CHECK(got == to_vector(rng));
+    }
+
+    // take_while stops in the middle: the pieces after it are dropped.
+    {
+        auto rng = v | view::transform([](int i) { return i + 1; })
+                     | view::take_while([](int i) { return i <= 70000; })
+                     | view::filter(is_odd{});
+        std::vector<int> const got = rng | par_to_vector;
+        CHECK(got.size() == 35000u);
+        CHECK(got == to_vector(rng));
+        CHECK(got.back() == 69999);
+    }
+    {
+        auto rng = v | view::take_while([](int i) { return i < 0; });
+        CHECK((rng | par_to_vector).empty());
+        auto all = v | view::take_while([](int i) { return i >= 0; });
+        CHECK((all | par_to_vector) == v);
+    }
+    // take_while after a filter sees only the elements that pass the filter.
+    {
+        auto rng = v | view::filter(is_odd{})
+                     | view::take_while([](int i) { return i % 1000 != 999 || i < 90000; });
+        std::vector<int> const got = rng | par_to_vector;
+        CHECK(got == to_vector(rng));
+        CHECK(got.back() == 90997);
+    }
+
+    // Other random-access sources
+    {
+        auto rng = view::iota(0, 20000) | view::transform([](int i) { return i * i; });
+        CHECK((rng | par_to_vector) == to_vector(rng));
+        std::vector<int> empty;
+        CHECK((empty | view::filter(is_odd{}) | par_to_vector).empty());
+        CHECK((v | par_to_vector) == v);
+    }
+
+    // Associative containers and strings
+    {
+        auto rng = v | view::transform([](int i) { return i % 5000; })
+                     | view::take_while([](int i) { return i < 4990 || i > 4992; });
+        std::set<int> const got = rng | par_to<std::set>();
+        CHECK(got == (rng | to_<std::set<int>>()));
+        CHECK(got.size() == 4990u);
+        std::multiset<int> const all = v | view::filter(is_odd{}) | par_to<std::multiset>();
+        CHECK(all.size() == 50001u);
+        std::string const s = v | view::transform([](int i) { return char('a' + i % 26); })
+                                | par_to<std::string>();
+        CHECK(s.size() == v.size());
+        CHECK(s.substr(26, 3) == "abc");
+    }
+
+    // Ranges that cannot be cut into pieces are collected in one go.
+    {
+        std::list<int> l(v.begin(), v.begin() + 1000);
+        auto rng = l | view::filter(is_odd{});
+        std::vector<int> const got = rng | par_to_vector;
+        CHECK(got.size() == 500u);
+        CHECK(got.front() == 1);
+        auto const crng = v | view::transform([](int i) { return i * 2; });
+        CHECK((crng | par_to_vector).size() == v.size());
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,163 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/soa_vector.hpp>
+#include <range/v3/action/sort.hpp>
+#include <range/v3/action/unique.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/algorithm/partition.hpp>
+#include <range/v3/algorithm/unique.hpp>
+#include "./simple_test.hpp"
+#include "./test_utils.hpp"
+
+using namespace ranges;
+
+struct first
+{
+    template<typename T>
+    auto operator()(T const &t) const -> decltype(std::get<0>(t))
+    {
+        return std::get<0>(t);
+    }
+};
+
+struct odd
+{
+    bool operator()(int i) const
+    {
+        return i % 2 != 0;
+    }
+};
+
+int main()
+{
+    using S = soa_vector<int, std::string, double>;
+    CONCEPT_ASSERT(RandomAccessRange<S>());
+    CONCEPT_ASSERT(BoundedRange<S>());
+    CONCEPT_ASSERT(SizedRange<S>());
+    CONCEPT_ASSERT(!View<S>());
+    CONCEPT_ASSERT(Same<range_value_t<S>, std::tuple<int, std::string, double>>());
+    CONCEPT_ASSERT(Same<decltype(std::declval<S &>().column<1>()), span<std::string>>());
+    CONCEPT_ASSERT(Same<decltype(std::declval<S const &>().column<2>()),
+        span<double const>>());
+
+    {
+        S s;
+        CHECK(s.empty());
+        s.emplace_back(3, "c", 0.3);
+        s.emplace_back(1, "a", 0.1);
+        s.push_back(std::make_tuple(2, std::string("b"), 0.2));
+        CHECK(s.size() == 3u);
+        CHECK(std::get<1>(s[1]) == "a");
+        std::get<2>(s[1]) = 1.5;
+        ::check_equal(s.column<2>(), {0.3, 1.5, 0.2});
+
+        ranges::sort(s, less{}, first{});
+        ::check_equal(s.column<0>(), {1, 2, 3});
+        ::check_equal(s.column<1>(), {"a", "b", "c"});
+        ::check_equal(s.column<2>(), {1.5, 0.2, 0.3});
+
+        // The range is the zip of the columns.
+        int i = 0;
+        for(auto &&t : s)
+            CHECK(std::get<0>(t) == ++i);
+
+        s.pop_back();
+        ::check_equal(s.column<1>(), {"a", "b"});
+        s.clear();
+        CHECK(s.empty());
+    }
+
+    // Sorting by a key leaves the other columns with their rows, and
+    // stable_sort keeps rows with equal keys in order.
+    {
+        soa_vector<int, int> s;
+        for(int i = 0; i < 1000; ++i)
+            s.emplace_back((i * 7919) % 13, i);
+        soa_vector<int, int> t = s;
+        auto end = ranges::stable_sort(t, less{}, first{});
+        CHECK(end == t.end());
+        for(std::size_t i = 1; i < t.size(); ++i)
+        {
+            CHECK(t[i - 1].first <= t[i].first);
+            if(t[i - 1].first == t[i].first)
+                CHECK(t[i - 1].second < t[i].second);
+        }
+        for(auto &&r : t)
+            CHECK(r.first == (r.second * 7919) % 13);
+
+        // Compared as whole tuples without a projection.
+        ranges::sort(s);
+        CHECK(ranges::equal(s, t));
+        ranges::sort(s, [](int i, int j) { return i > j; }, first{});
+        CHECK(s[0].first == 12);
+        CHECK(s[0].first == s[1].first);
+    }
+
+    // partition and unique move every column.
+    {
+        soa_vector<int, std::unique_ptr<int>> s;
+        for(int i = 0; i < 10; ++i)
+            s.emplace_back(i, std::unique_ptr<int>(new int(i)));
+        auto mid = ranges::partition(s, odd{}, first{});
+        CHECK((mid - s.begin()) == 5);
+        ::check_equal(s.column<0>(), {9, 1, 7, 3, 5, 4, 6, 2, 8, 0});
+        for(auto &&r : s)
+            CHECK(*r.second == r.first);
+        // Already partitioned
+        mid = ranges::partition(s, odd{}, first{});
+        CHECK((mid - s.begin()) == 5);
+        ::check_equal(s.column<0>(), {9, 1, 7, 3, 5, 4, 6, 2, 8, 0});
+        mid = s.partition([](int i) { return i > 9; }, first{});
+        CHECK(mid == s.begin());
+        mid = s.partition([](int i) { return i < 10; }, first{});
+        CHECK(mid == s.end());
+        ::check_equal(s.column<0>(), {9, 1, 7, 3, 5, 4, 6, 2, 8, 0});
+    }
+    {
+        soa_vector<int, std::string> s;
+        int const keys[] = {1, 1, 2, 3, 3, 3, 1, 4, 4};
+        for(int k : keys)
+            s.emplace_back(k, std::string(static_cast<std::size_t>(k), 'x'));
+        auto end = ranges::unique(s, equal_to{}, first{});
+        CHECK((end - s.begin()) == 5);
+        s.erase(end, s.end());
+        ::check_equal(s.column<0>(), {1, 2, 3, 1, 4});
+        ::check_equal(s.column<1>(), {"x", "xx", "xxx", "x", "xxxx"});
+
+        s.emplace_back(4, "yyyy");
+        s.emplace_back(0, "");
+        s |= action::sort(less{}, first{}) | action::unique(equal_to{}, first{});
+        ::check_equal(s.column<0>(), {0, 1, 2, 3, 4});
+        CHECK(s.column<1>().size() == 5);
+    }
+
+    // The element-wise algorithms on a zip of the columns agree.
+    {
+        soa_vector<int, char> s{{3, 'c'}, {1, 'a'}, {2, 'b'}, {1, 'z'}};
+        std::vector<int> a{3, 1, 2, 1};
+        std::vector<char> b{'c', 'a', 'b', 'z'};
+        s.stable_sort(less{}, first{});
+        auto z = view::zip(a, b);
+        ranges::stable_sort(z, less{}, first{});
+        ::check_equal(s.column<0>(), a);
+        ::check_equal(s.column<1>(), b);
+    }
+
+    return ::test_result();
+}
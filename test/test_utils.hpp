@@ -11,9 +11,12 @@
 #define RANGES_TEST_UTILS_HPP
 
 #include <algorithm>
+#include <cstddef>
 #include <cstring>
 #include <functional>
 #include <initializer_list>
+#include <memory>
+#include <new>
 #include <ostream>
 #include <meta/meta.hpp>
 #include <range/v3/distance.hpp>
@@ -279,4 +282,85 @@ struct MoveOnlyString
     }
 };
 
+
+// Hands out memory from a fixed buffer and never frees it, and counts what it
+// hands out. A default-constructed arena_allocator uses the heap instead, as
+// a polymorphic allocator uses the default memory resource.
+struct arena
+{
+    alignas(std::max_align_t) char buf_[1 << 16];
+    std::size_t used_ = 0;
+    std::size_t allocations_ = 0;
+
+    void *allocate(std::size_t bytes)
+    {
+        bytes = (bytes + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+        if(bytes > sizeof(buf_) - used_)
+            throw std::bad_alloc{};
+        void *p = buf_ + used_;
+        used_ += bytes;
+        ++allocations_;
+        return p;
+    }
+};
+
+template<typename T>
+struct arena_allocator
+{
+    using value_type = T;
+    arena *arena_ = nullptr;
+
+    arena_allocator() = default;
+    explicit arena_allocator(arena &a) noexcept
+      : arena_(&a)
+    {}
+    template<typename U>
+    arena_allocator(arena_allocator<U> const &that) noexcept
+      : arena_(that.arena_)
+    {}
+    T *allocate(std::size_t n)
+    {
+        return arena_ ? static_cast<T *>(arena_->allocate(n * sizeof(T))) :
+            std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T *p, std::size_t n) noexcept
+    {
+        if(!arena_)
+            std::allocator<T>{}.deallocate(p, n);
+    }
+    template<typename U>
+    bool operator==(arena_allocator<U> const &that) const
+    {
+        return arena_ == that.arena_;
+    }
+    template<typename U>
+    bool operator!=(arena_allocator<U> const &that) const
+    {
+        return arena_ != that.arena_;
+    }
+};
+
+// A random number engine that counts the numbers drawn from it.
+template<typename Engine>
+struct counting_engine
+{
+    using result_type = typename Engine::result_type;
+    Engine engine_;
+    std::size_t draws_ = 0;
+
+    static constexpr result_type min()
+    {
+        return Engine::min();
+    }
+    static constexpr result_type max()
+    {
+        return Engine::max();
+    }
+    result_type operator()()
+    {
+        ++draws_;
+        return engine_();
+    }
+};
+
 #endif
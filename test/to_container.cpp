@@ -13,7 +13,10 @@
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/to_container.hpp>
+#include <range/v3/view/filter.hpp>
 #include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/take_while.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/view/take.hpp>
 #include <range/v3/action/sort.hpp>
@@ -61,5 +64,63 @@ int main()
     CHECK(vl.reservation_count == std::size_t{1});
     CHECK(vl.last_reservation == N);
 
+    // Joins of sized ranges are sized, and reserve exactly.
+    {
+        std::vector<std::vector<int>> vv{{1, 2}, {}, {3, 4, 5}};
+        auto j = view::join(vv);
+        CONCEPT_ASSERT(SizedRange<decltype(j)>());
+        CHECK(ranges::size(j) == 5u);
+        auto jv = j | to_<vector_like<int>>();
+        CHECK(jv.reservation_count == std::size_t{1});
+        CHECK(jv.last_reservation == 5u);
+        ::check_equal(jv, {1, 2, 3, 4, 5});
+
+        auto j0 = view::join(vv, 0);
+        CONCEPT_ASSERT(SizedRange<decltype(j0)>());
+        CHECK(ranges::size(j0) == 7u);
+        std::vector<std::vector<int>> none;
+        CHECK(ranges::size(view::join(none, 0)) == 0u);
+    }
+
+    // Views that drop elements reserve as much as the range they adapt.
+    {
+        auto f = view::iota(0, int{N}) | view::filter([](int i){return i % 3 == 0;})
+            | view::transform([](int i){return i / 3;});
+        CONCEPT_ASSERT(!SizedRange<decltype(f)>());
+        CHECK(size_hint(f) == N);
+        auto fv = f | to_<vector_like<int>>();
+        CHECK(fv.reservation_count == std::size_t{1});
+        CHECK(fv.last_reservation == N);
+        CHECK(fv.size() == (N + 2) / 3);
+        CHECK(fv.back() == int{(N - 1) / 3});
+
+        auto t = view::iota(0, int{N}) | view::take_while([](int i){return i < 10;});
+        CHECK(size_hint(t) == N);
+        CHECK((t | to_vector).size() == 10u);
+    }
+
+    // With an allocator
+    {
+        arena a;
+        auto vec2 = view::iota(0, 100) | view::transform([](int i){return i*i;})
+            | to_<std::vector>(arena_allocator<char>{a});
+        static_assert((bool)Same<decltype(vec2), std::vector<int, arena_allocator<int>>>(), "");
+        CHECK(vec2.get_allocator().arena_ == &a);
+        CHECK(vec2.size() == 100u);
+        CHECK(vec2.back() == 9801);
+        CHECK(a.allocations_ == 1u);
+
+        auto lst1 = view::iota(0, 10) | to_<std::list>(arena_allocator<int>{a});
+        static_assert((bool)Same<decltype(lst1), std::list<int, arena_allocator<int>>>(), "");
+        ::check_equal(lst1, {0,1,2,3,4,5,6,7,8,9});
+        CHECK(a.allocations_ == 11u);
+
+        using long_vector = std::vector<long, arena_allocator<long>>;
+        auto vec3 = view::ints | view::take(10) | to_<long_vector>(arena_allocator<long>{a});
+        static_assert((bool)Same<decltype(vec3), long_vector>(), "");
+        ::check_equal(vec3, {0,1,2,3,4,5,6,7,8,9});
+        CHECK(a.allocations_ > 11u);
+    }
+
     return ::test_result();
 }
@@ -0,0 +1,177 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/utility/random.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+// Each count of a uniform draw, n draws over k values, is within a quarter of
+// its expectation.
+template<typename Counts>
+bool near_uniform(Counts const &counts, long n)
+{
+    long const expected = n / static_cast<long>(counts.size());
+    for(long c : counts)
+    {
+        if(c < expected - expected / 4 || c > expected + expected / 4)
+            return false;
+    }
+    return true;
+}
+
+int main()
+{
+    using ranges::xoshiro256starstar;
+    CONCEPT_ASSERT(ranges::UniformRandomNumberGenerator<xoshiro256starstar>());
+    CONCEPT_ASSERT(ranges::UniformRandomNumberGenerator<xoshiro256starstar &>());
+
+    // The engine, seeded through splitmix64
+    {
+        xoshiro256starstar g;
+        CHECK(g() == 0x99ec5f36cb75f2b4u);
+        CHECK(g() == 0xbf6e1f784956452au);
+        CHECK(g() == 0x1a5f849d4933e6e0u);
+        CHECK(g() == 0x6aa594f1262d2d2cu);
+
+        xoshiro256starstar h{42u};
+        CHECK(h() == 0x15780b2e0c2ec716u);
+        CHECK(h() == 0x6104d9866d113a7eu);
+        h.seed(42u);
+        CHECK(h() == 0x15780b2e0c2ec716u);
+    }
+    {
+        std::seed_seq seq1{1, 2, 3}, seq2{1, 2, 3};
+        xoshiro256starstar g1{seq1}, g2{seq2};
+        CHECK(g1 == g2);
+        g1();
+        CHECK(g1 != g2);
+        g2.discard(1);
+        CHECK(g1 == g2);
+
+        // Copies, from non-const engines too, continue the same stream.
+        xoshiro256starstar g5(g1), g6{g1};
+        CHECK(g5 == g1);
+        CHECK(g6 == g1);
+        g6();
+        g5 = g6;
+        CHECK(g5 == g6);
+        CHECK(g5() == g6());
+        CONCEPT_ASSERT(!ranges::SeedSequence<xoshiro256starstar &>());
+
+        // Jumped copies make different streams.
+        xoshiro256starstar g3 = g1;
+        g3.jump();
+        CHECK(g1 != g3);
+        CHECK(g1() != g3());
+        xoshiro256starstar g4 = g3;
+        g4.jump();
+        CHECK(g3 != g4);
+    }
+
+    // fill_random
+    {
+        xoshiro256starstar g1{7u}, g2{7u};
+        std::vector<std::uint64_t> v(100);
+        CHECK(ranges::fill_random(v, g1) == v.end());
+        for(std::uint64_t x : v)
+            CHECK(x == g2());
+
+        // Narrower integers take the high bits of a word.
+        std::array<std::uint8_t, 10> bytes;
+        ranges::fill_random(bytes, g1);
+        for(std::uint8_t b : bytes)
+            CHECK(b == static_cast<std::uint8_t>(g2() >> 56));
+    }
+    {
+        // Two results of a 32-bit engine per 64-bit word, high word first.
+        std::mt19937 g1{5489u}, g2{5489u};
+        std::array<std::uint64_t, 8> words;
+        ranges::fill_random(words.begin(), words.end(), g1);
+        for(std::uint64_t w : words)
+        {
+            std::uint64_t const hi = g2();
+            CHECK(w == (hi << 32 | g2()));
+        }
+    }
+    {
+        // Engines whose results are not whole words still fill uniformly.
+        std::minstd_rand g;
+        std::vector<std::uint32_t> v(60000);
+        ranges::fill_random(v, g);
+        std::array<long, 16> counts{};
+        for(std::uint32_t x : v)
+            ++counts[x >> 28];
+        CHECK(near_uniform(counts, 60000));
+    }
+    {
+        // The default engine
+        std::array<std::uint64_t, 4> a{}, b{};
+        ranges::fill_random(a);
+        ranges::fill_random(b);
+        CHECK(!ranges::equal(a, b));
+    }
+
+    // Bounded integers
+    {
+        xoshiro256starstar g{3u};
+        std::array<long, 6> counts{};
+        for(long i = 0; i < 60000; ++i)
+        {
+            auto const r = ranges::detail::bounded_random(g, 6);
+            CHECK(r < 6u);
+            ++counts[r];
+        }
+        CHECK(near_uniform(counts, 60000));
+    }
+    {
+        // Through 32-bit words
+        std::mt19937 g{3u};
+        std::array<long, 7> counts{};
+        for(long i = 0; i < 70000; ++i)
+            ++counts[ranges::detail::bounded_random(g, 7)];
+        CHECK(near_uniform(counts, 70000));
+
+        // Bounds wider than a 32-bit word
+        std::uint64_t const bound = (std::uint64_t{3} << 33) + 1;
+        std::array<long, 3> thirds{};
+        for(long i = 0; i < 30000; ++i)
+        {
+            auto const r = ranges::detail::bounded_random(g, bound);
+            CHECK(r < bound);
+            ++thirds[r / (bound / 3 + 1)];
+        }
+        CHECK(near_uniform(thirds, 30000));
+    }
+    {
+        // Two at a time, jointly uniform
+        xoshiro256starstar g{11u};
+        ranges::detail::random_words<xoshiro256starstar> words{g};
+        std::array<long, 15> counts{};
+        for(long i = 0; i < 150000; ++i)
+        {
+            std::uint64_t r0, r1;
+            ranges::detail::bounded_random_words(words, 3, 5, r0, r1);
+            CHECK(r0 < 3u);
+            CHECK(r1 < 5u);
+            ++counts[r0 * 5 + r1];
+        }
+        CHECK(near_uniform(counts, 150000));
+    }
+
+    return ::test_result();
+}
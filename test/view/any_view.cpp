@@ -9,16 +9,103 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <memory>
+#include <tuple>
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/take.hpp>
 #include <range/v3/view/reverse.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/zip.hpp>
 #include <range/v3/view/any_view.hpp>
 #include <range/v3/utility/copy.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
+struct alloc_counts
+{
+    int allocs = 0, deallocs = 0;
+};
+
+template<typename T>
+struct counting_allocator
+{
+    using value_type = T;
+    alloc_counts *counts;
+
+    explicit counting_allocator(alloc_counts &c)
+      : counts(&c)
+    {}
+    template<typename U>
+    counting_allocator(counting_allocator<U> const &that)
+      : counts(that.counts)
+    {}
+    T *allocate(std::size_t n)
+    {
+        ++counts->allocs;
+        return std::allocator<T>{}.allocate(n);
+    }
+    void deallocate(T *p, std::size_t n)
+    {
+        ++counts->deallocs;
+        std::allocator<T>{}.deallocate(p, n);
+    }
+    template<typename U>
+    friend bool operator==(counting_allocator const &x, counting_allocator<U> const &y)
+    {
+        return x.counts == y.counts;
+    }
+    template<typename U>
+    friend bool operator!=(counting_allocator const &x, counting_allocator<U> const &y)
+    {
+        return !(x == y);
+    }
+};
+
+struct sum
+{
+    template<typename Tuple>
+    int operator()(Tuple const &t) const
+    {
+        return std::get<0>(t) + std::get<1>(t) + std::get<2>(t) + std::get<3>(t) +
+            std::get<4>(t);
+    }
+};
+
+// A small view whose iterators point into it.
+struct three_ints
+  : ranges::view_facade<three_ints, ranges::finite>
+{
+private:
+    friend ranges::range_access;
+    int ints_[3] = {1, 2, 3};
+    struct cursor
+    {
+        int const *p;
+        int read() const
+        {
+            return *p;
+        }
+        void next()
+        {
+            ++p;
+        }
+        bool equal(cursor const &that) const
+        {
+            return p == that.p;
+        }
+    };
+    cursor begin_cursor() const
+    {
+        return {ints_};
+    }
+    cursor end_cursor() const
+    {
+        return {ints_ + 3};
+    }
+};
+
 int main()
 {
     using namespace ranges;
@@ -75,5 +162,74 @@ int main()
         ::check_equal(any_view<int>{vec2}, ten_ints);
     }
 
+    // Small ranges and iterators are stored inline: erasing them, and copying
+    // their iterators, does not allocate.
+    {
+        alloc_counts counts;
+        counting_allocator<char> alloc{counts};
+        std::vector<int> vec(begin(ten_ints), end(ten_ints));
+        {
+            any_random_access_view<int &> v{std::allocator_arg, alloc, vec};
+            auto i = v.begin();
+            auto j = i;
+            j += 3;
+            CHECK(*j == 3);
+            CHECK((j - i) == 3);
+            i = j;
+            CHECK(*i == 3);
+            ::check_equal(v, ten_ints);
+            any_random_access_view<int &> w = v;
+            any_random_access_view<int &> x = std::move(w);
+            ::check_equal(x, ten_ints);
+        }
+        CHECK(counts.allocs == 0);
+        CHECK(counts.deallocs == 0);
+    }
+
+    // Other ranges are allocated, however small, so that their iterators stay
+    // valid when the any_view is moved.
+    {
+        alloc_counts counts;
+        counting_allocator<char> alloc{counts};
+        std::unique_ptr<any_view<int>> v{
+            new any_view<int>{std::allocator_arg, alloc, three_ints{}}};
+        CHECK(counts.allocs == 1);
+        auto i = v->begin();
+        any_view<int> w = std::move(*v);
+        v.reset();
+        CHECK(*i == 1);
+        ++i;
+        CHECK(*i == 2);
+        ++i;
+        ++i;
+        CHECK(i == w.end());
+        CHECK(counts.allocs == 1);
+    }
+
+    // Larger ones are allocated with the supplied allocator.
+    {
+        alloc_counts counts;
+        counting_allocator<char> alloc{counts};
+        std::vector<int> a(begin(ten_ints), end(ten_ints));
+        auto rng = view::zip(a, a, a, a, a) | view::transform(sum{});
+        CHECK(sizeof(rng) > detail::any_buffer_size);
+        CHECK(sizeof(range_iterator_t<decltype(rng)>) > detail::any_buffer_size);
+        {
+            any_view<int> v{std::allocator_arg, alloc, rng};
+            CHECK(counts.allocs == 1);
+            auto i = v.begin();
+            CHECK(counts.allocs == 2);
+            CHECK(*i == 0);
+            ++i;
+            CHECK(*i == 5);
+            ::check_equal(v, {0, 5, 10, 15, 20, 25, 30, 35, 40, 45});
+            int const allocs = counts.allocs;
+            any_view<int> w = std::move(v);
+            CHECK(counts.allocs == allocs);
+            ::check_equal(w, {0, 5, 10, 15, 20, 25, 30, 35, 40, 45});
+        }
+        CHECK(counts.allocs == counts.deallocs);
+    }
+
     return test_result();
 }
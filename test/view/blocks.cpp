@@ -0,0 +1,191 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/filter.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/view/zip_with.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+struct square
+{
+    int operator()(int i) const
+    {
+        return i * i;
+    }
+};
+
+struct is_odd
+{
+    bool operator()(int i) const
+    {
+        return (i % 2) == 1;
+    }
+};
+
+struct to_string_
+{
+    std::string operator()(int i) const
+    {
+        return std::to_string(i);
+    }
+};
+
+// Removes the elements at odd offsets from base, so it only works on the
+// references of the range it filters, not on copies of them.
+struct at_odd_offset
+{
+    int const *base;
+    bool operator()(int const &i) const
+    {
+        return ((&i - base) % 2) == 1;
+    }
+};
+
+template<typename Rng>
+using blocked_t = detail::blocked<range_iterator_t<Rng>, range_sentinel_t<Rng>>;
+
+template<typename Rng>
+std::vector<range_value_t<Rng>> one_at_a_time(Rng &&rng)
+{
+    std::vector<range_value_t<Rng>> v;
+    for(auto it = begin(rng); it != end(rng); ++it)
+        v.push_back(*it);
+    return v;
+}
+
+// Checks that accumulate, copy and to_vector see the same elements a block at
+// a time as a loop over the range does one at a time.
+template<typename Rng>
+void check_blocks(Rng &&rng)
+{
+    auto const expected = one_at_a_time(rng);
+    range_value_t<Rng> sum{};
+    for(auto const &x : expected)
+        sum = sum + x;
+    CHECK(accumulate(rng, range_value_t<Rng>{}) == sum);
+    std::vector<range_value_t<Rng>> out(expected.size() + 1);
+    auto res = copy(rng, out.begin());
+    CHECK(res.out() == out.begin() + static_cast<std::ptrdiff_t>(expected.size()));
+    CHECK(res.in() == end(rng));
+    out.pop_back();
+    ::check_equal(out, expected);
+    ::check_equal(to_vector(rng), expected);
+}
+
+int main()
+{
+    std::vector<int> v = view::iota(0, 1000);
+    std::vector<int> w = view::iota(0, 300);
+
+    // The views hand out blocks.
+    auto sq = v | view::transform(square{});
+    auto odd_sq = sq | view::remove_if(is_odd{});
+    auto some = odd_sq | view::take(100);
+    auto zipped = view::zip_with(std::plus<int>{}, v, w);
+    CONCEPT_ASSERT(blocked_t<decltype(sq)>());
+    CONCEPT_ASSERT(blocked_t<decltype(odd_sq)>());
+    CONCEPT_ASSERT(blocked_t<decltype(some)>());
+    CONCEPT_ASSERT(blocked_t<decltype(zipped)>());
+    CONCEPT_ASSERT(blocked_t<decltype(v | view::filter(is_odd{}))>());
+    CONCEPT_ASSERT(!blocked_t<std::vector<int>>());
+    CONCEPT_ASSERT(detail::block_copyable<range_iterator_t<decltype(sq)>,
+        range_sentinel_t<decltype(sq)>>());
+    // Random-access ranges are indexed by the loops of algorithms instead.
+    CONCEPT_ASSERT(!detail::block_loopable<range_iterator_t<decltype(sq)>,
+        range_sentinel_t<decltype(sq)>>());
+    CONCEPT_ASSERT(detail::block_loopable<range_iterator_t<decltype(odd_sq)>,
+        range_sentinel_t<decltype(odd_sq)>>());
+    CONCEPT_ASSERT(!detail::block_copyable<range_iterator_t<decltype(view::zip(v, w))>,
+        range_sentinel_t<decltype(view::zip(v, w))>>());
+
+    check_blocks(sq);
+    check_blocks(odd_sq);
+    check_blocks(some);
+    check_blocks(zipped);
+    check_blocks(v | view::filter(is_odd{}) | view::transform(square{}));
+    check_blocks(v | view::transform(square{}) | view::take(1));
+    check_blocks(v | view::take(257) | view::transform(square{}));
+    check_blocks(w | view::remove_if(is_odd{}) | view::take(1000));
+
+    // Const views hand out blocks too.
+    {
+        auto const &csq = sq;
+        CONCEPT_ASSERT(blocked_t<decltype(csq)>());
+        check_blocks(csq);
+        check_blocks(csq | view::remove_if(is_odd{}));
+        auto const &sq_sq = sq | view::transform(square{});
+        CONCEPT_ASSERT(blocked_t<decltype(sq_sq)>());
+        CONCEPT_ASSERT(detail::block_copyable<range_iterator_t<decltype(sq_sq)>,
+            range_sentinel_t<decltype(sq_sq)>>());
+        check_blocks(sq_sq);
+    }
+
+    // The predicate of remove_if sees the references of the range it filters.
+    {
+        auto rng = w | view::remove_if(at_odd_offset{w.data()});
+        CONCEPT_ASSERT(blocked_t<decltype(rng)>());
+        check_blocks(rng);
+        CHECK(accumulate(rng, 0) == 149 * 150);
+        auto evens = v | view::remove_if(is_odd{});
+        check_blocks(evens | view::remove_if(at_odd_offset{v.data() + 2}));
+        CHECK(accumulate(evens | view::remove_if(at_odd_offset{v.data()}), 0) == 249500);
+    }
+
+    // Blocks end at the end of the range.
+    {
+        std::vector<int> e;
+        check_blocks(e | view::transform(square{}));
+        check_blocks(e | view::transform(square{}) | view::remove_if(is_odd{}));
+        auto rng = w | view::transform(square{});
+        auto it = begin(rng);
+        int buf[detail::block_size()];
+        CHECK(detail::read_block(it, end(rng), buf, detail::block_size()) == 256);
+        CHECK(buf[255] == 255 * 255);
+        CHECK(detail::read_block(it, end(rng), buf, detail::block_size()) == 44);
+        CHECK(buf[0] == 256 * 256);
+        CHECK(it == end(rng));
+        CHECK(detail::read_block(it, end(rng), buf, detail::block_size()) == 0);
+    }
+
+    // A block of a filtered range may be short of the end.
+    {
+        auto rng = w | view::remove_if(is_odd{});
+        auto it = begin(rng);
+        int buf[detail::block_size()];
+        CHECK(detail::read_block(it, end(rng), buf, 10) == 5);
+        ::check_equal(view::counted(buf, 5), {0, 2, 4, 6, 8});
+        CHECK(*it == 10);
+    }
+
+    // Values that are not trivial are taken one at a time.
+    {
+        auto rng = w | view::transform(to_string_{});
+        CONCEPT_ASSERT(blocked_t<decltype(rng)>());
+        CONCEPT_ASSERT(!detail::block_copyable<range_iterator_t<decltype(rng)>,
+            range_sentinel_t<decltype(rng)>>());
+        CHECK(accumulate(rng, std::string{}).size() == 10u + 90u * 2u + 200u * 3u);
+        ::check_equal(to_vector(rng), one_at_a_time(rng));
+    }
+
+    return ::test_result();
+}
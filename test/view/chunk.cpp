@@ -10,9 +10,13 @@
 // Project home: https://github.com/ericniebler/range-v3
 
 #include <list>
+#include <sstream>
+#include <string>
 #include <vector>
 #include <forward_list>
 #include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/span.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/chunk.hpp>
 #include <range/v3/view/reverse.hpp>
@@ -137,5 +141,36 @@ int main()
         CHECK((next(it,7) - it) == 0);
     }
 
+    {
+        // Input ranges are read into a buffer, and each chunk is a span of it.
+        std::istringstream sin{"0 1 2 3 4 5 6 7 8 9 10"};
+        auto rng = istream<int>(sin) | view::chunk(3);
+        ::models<concepts::InputRange>(rng);
+        ::models_not<concepts::ForwardRange>(rng);
+        CONCEPT_ASSERT(Same<range_value_t<decltype(rng)>, span<int>>());
+        auto it = rng.begin();
+        ::check_equal(*it, {0,1,2});
+        int const *buf = (*it).data();
+        ::check_equal(*++it, {3,4,5});
+        CHECK((*it).data() == buf);
+        ::check_equal(*++it, {6,7,8});
+        ::check_equal(*++it, {9,10});
+        CHECK(++it == rng.end());
+    }
+
+    {
+        std::istringstream sin{"a b c d e"};
+        auto rng = view::chunk(istream<std::string>(sin), 2);
+        auto it = rng.begin();
+        ::check_equal(*it, {"a", "b"});
+        ::check_equal(*++it, {"c", "d"});
+        ::check_equal(*++it, {"e"});
+        CHECK(++it == rng.end());
+
+        std::istringstream empty{""};
+        auto rng2 = istream<int>(empty) | view::chunk(2);
+        CHECK(rng2.begin() == rng2.end());
+    }
+
     return ::test_result();
 }
@@ -17,7 +17,12 @@
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/remove_if.hpp>
 #include <range/v3/view/take_while.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/count_if.hpp>
 #include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/find_if.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/numeric/accumulate.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
@@ -93,5 +98,44 @@ int main()
         CHECK(ranges::distance(ranges::begin(rng), ranges::end(rng)) == 30);
     }
 
+    // Algorithms walk a concatenation one range at a time, between any two
+    // positions.
+    {
+        std::vector<int> a{1, 2, 3}, b{}, c{4, 5}, d{6, 7};
+        auto rng = view::concat(a, b, c, d);
+        auto const &crng = rng;
+        CONCEPT_ASSERT(detail::segmented<range_iterator_t<decltype(rng)>,
+            range_sentinel_t<decltype(rng)>>());
+        CONCEPT_ASSERT(detail::segmented<range_iterator_t<decltype(crng)>,
+            range_sentinel_t<decltype(crng)>>());
+        CHECK(accumulate(rng, 0) == 28);
+        CHECK(accumulate(crng, 0) == 28);
+        CHECK(count_if(rng, [](int i) { return i > 2; }) == 5);
+
+        auto it = find_if(rng, [](int i) { return i == 5; });
+        CHECK(*it == 5);
+        CHECK(accumulate(ranges::begin(rng), it, 0) == 10);
+        CHECK(accumulate(ranges::next(ranges::begin(rng), 4), it, 0) == 0);
+        CHECK(count_if(ranges::next(ranges::begin(rng)), it, [](int) { return true; }) == 3);
+
+        int sum = 0;
+        auto last = ranges::end(rng);
+        CHECK(for_each(it, last, [&](int i) { sum += i; }).in() == last);
+        CHECK(sum == 18);
+
+        std::vector<int> out(7);
+        auto res = copy(rng, out.begin());
+        CHECK(res.in() == ranges::end(rng));
+        CHECK(res.out() == out.end());
+        ::check_equal(out, {1, 2, 3, 4, 5, 6, 7});
+
+        // The last range has a sentinel, so the concatenation does too.
+        auto rng2 = view::concat(a, c | view::take_while([](int i) { return i < 5; }));
+        CONCEPT_ASSERT(detail::segmented<range_iterator_t<decltype(rng2)>,
+            range_sentinel_t<decltype(rng2)>>());
+        CHECK(accumulate(rng2, 0) == 10);
+        CHECK(find_if(rng2, [](int i) { return i == 5; }) == ranges::end(rng2));
+    }
+
     return test_result();
 }
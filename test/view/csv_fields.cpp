@@ -0,0 +1,126 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/csv_fields.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+namespace
+{
+    // The records of rng, as vectors of the unescaped fields.
+    template<typename Rng>
+    std::vector<std::vector<std::string>> records(Rng && rng)
+    {
+        std::vector<std::vector<std::string>> v(1);
+        for(auto it = ranges::begin(rng); it != ranges::end(rng); ++it)
+        {
+            v.back().push_back((*it).str());
+            if((*it).end_of_record())
+                v.emplace_back();
+        }
+        CHECK(v.back().empty());
+        v.pop_back();
+        return v;
+    }
+
+    using R = std::vector<std::vector<std::string>>;
+
+    void check_csv(std::string const &str, R const &expected)
+    {
+        using namespace ranges;
+        CHECK(records(view::csv_fields(str)) == expected);
+        std::list<char> const lst(str.begin(), str.end());
+        CHECK(records(view::csv_fields(lst)) == expected);
+    }
+}
+
+int main()
+{
+    using namespace ranges;
+
+    check_csv("", R{});
+    check_csv("a", R{{"a"}});
+    check_csv("a,b,c\n1,2,3\n", R{{"a", "b", "c"}, {"1", "2", "3"}});
+    check_csv("a,b\r\n1,2", R{{"a", "b"}, {"1", "2"}});
+    check_csv("a,b\r1,2\r", R{{"a", "b"}, {"1", "2"}});
+    check_csv("a,,\n,\n\nx", R{{"a", "", ""}, {"", ""}, {""}, {"x"}});
+    check_csv("a,b,", R{{"a", "b", ""}});
+    check_csv("\"a,b\",\"c\nd\",\"say \"\"hi\"\"\"\n", R{{"a,b", "c\nd", "say \"hi\""}});
+    check_csv("\"\",\"\"\"\"", R{{"", "\""}});
+    check_csv("\"ab\"cd,e", R{{"ab", "e"}});
+    check_csv("\"unterminated,x\ny", R{{"unterminated,x\ny"}});
+    check_csv("a,\"b\"\r\n", R{{"a", "b"}});
+    check_csv("x\r", R{{"x"}});
+
+    {
+        std::string const str = "id,\"name, full\",\"a \"\"b\"\"\"\n";
+        auto rng = view::csv_fields(str);
+        CONCEPT_ASSERT(ForwardView<decltype(rng)>());
+        using Field = range_reference_t<decltype(rng)>;
+        CONCEPT_ASSERT(SizedRange<Field>());
+        CONCEPT_ASSERT(Same<range_iterator_t<Field>, std::string::const_iterator>());
+        auto it = begin(rng);
+        CHECK(!(*it).quoted());
+        CHECK(&*begin(*it) == &str[0]);
+        ++it;
+        CHECK((*it).quoted());
+        CHECK(!(*it).escaped());
+        ::check_equal(*it, std::string{"name, full"});
+        CHECK(&*begin(*it) == &str[4]);
+        ++it;
+        CHECK((*it).escaped());
+        CHECK((*it).end_of_record());
+        ::check_equal(*it, std::string{"a \"\"b\"\""});
+        CHECK(next(it) == end(rng));
+        CHECK(distance(rng) == 3);
+    }
+
+    {
+        std::string const str = "a;'b;c';'d''e'\n";
+        R const expected{{"a", "b;c", "d'e"}};
+        CHECK(records(view::csv_fields(str, ';', '\'')) == expected);
+        CHECK(records(str | view::csv_fields(';', '\'')) == expected);
+        std::string const tsv = "a\tb", csv = "a,b";
+        CHECK(records(tsv | view::csv_fields('\t')) == (R{{"a", "b"}}));
+        CHECK(records(csv | view::csv_fields) == (R{{"a", "b"}}));
+    }
+
+    {
+        // The iterators outlive the view they came from.
+        std::string const str = "a;'b;c'\nd;e";
+        using Rng = decltype(view::csv_fields(str, ';', '\''));
+        std::unique_ptr<Rng> p{new Rng{view::csv_fields(str, ';', '\'')}};
+        auto it = begin(*p);
+        Rng const rng = std::move(*p);
+        p.reset();
+        CHECK((*it).str() == "a");
+        CHECK((*++it).str() == "b;c");
+        CHECK((*it).end_of_record());
+        CHECK((*++it).str() == "d");
+        CHECK((*++it).str() == "e");
+        CHECK(++it == end(rng));
+    }
+
+    {
+        // Long fields, which take the vector scan where there is one.
+        std::string const a(100, 'a'), b(70, 'b');
+        std::string const q = "\"" + a + "\"\"" + b + ",\n\"";
+        check_csv(a + "," + b + "\n" + q + "," + a,
+            R{{a, b}, {a + "\"" + b + ",\n", a}});
+    }
+
+    return test_result();
+}
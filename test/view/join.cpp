@@ -14,11 +14,17 @@
 #include <functional>
 #include <range/v3/core.hpp>
 #include <range/v3/view/join.hpp>
+#include <range/v3/view/remove_if.hpp>
 #include <range/v3/view/split.hpp>
 #include <range/v3/view/generate_n.hpp>
 #include <range/v3/view/repeat_n.hpp>
 #include <range/v3/view/concat.hpp>
 #include <range/v3/view/single.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/find_if.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/numeric/accumulate.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -65,6 +71,48 @@ namespace
         const std::vector<int> flat_nums = ranges::view::join( nums );
         ::check_equal(flat_nums, {1,2,3,4,5,6});
     }
+
+    // Algorithms that walk a joined range one inner range at a time must agree
+    // with the element-wise loop, and stop where it would.
+    void test_segments()
+    {
+        using namespace ranges;
+        std::vector<std::vector<int>> vv = {{1, 2}, {}, {3, 4, 5}, {}, {6}};
+        auto rng = vv | view::join;
+        CONCEPT_ASSERT(detail::segmented<decltype(begin(rng)), decltype(end(rng))>());
+
+        int sum = 0;
+        for_each(rng, [&](int i) { sum += i; });
+        CHECK(sum == 21);
+        CHECK(accumulate(rng, 0) == 21);
+        CHECK(count_if(rng, [](int i) { return i % 2 == 0; }) == 3);
+
+        auto it = find_if(rng, [](int i) { return i == 4; });
+        CHECK(*it == 4);
+        CHECK(*++it == 5);
+        CHECK(find_if(rng, [](int i) { return i == 7; }) == end(rng));
+
+        std::vector<int> out(6);
+        auto res = copy(rng, out.begin());
+        CHECK(res.in() == end(rng));
+        CHECK(res.out() == out.end());
+        ::check_equal(out, {1, 2, 3, 4, 5, 6});
+
+        auto rng2 = view::join(vv, 0);
+        CHECK(accumulate(rng2, 0) == 21);
+        CHECK(count_if(rng2, [](int i) { return i == 0; }) == 4);
+        auto it2 = find_if(rng2, [](int i) { return i == 0; });
+        CHECK(*++it2 == 0);
+        CHECK(*++it2 == 3);
+
+        // Nested: the inner ranges are concatenations.
+        CHECK(accumulate(view::join(twice(twice(21))), 0) == 84);
+
+        std::vector<std::vector<int>> empty;
+        CHECK(accumulate(empty | view::join, 0) == 0);
+        std::vector<std::vector<int>> empties(3);
+        CHECK(count_if(empties | view::join, [](int) { return true; }) == 0);
+    }
 }
 
 int main()
@@ -132,7 +180,18 @@ int main()
     CHECK(rng6.size() == 4u);
     check_equal(rng6, {42,42,42,42});
 
+    // An outer range that cannot be iterated when const is not sized.
+    {
+        std::vector<std::vector<int>> vv = {{1, 2}, {}, {3}, {4, 5}, {6}};
+        auto rng7 = vv | view::remove_if([](std::vector<int> const &v){return v.size() == 1;}) |
+            view::join;
+        models_not<concepts::SizedRange>(rng7);
+        CHECK(to_vector(rng7).size() == 4u);
+        check_equal(rng7, {1, 2, 4, 5});
+    }
+
     test_issue_283();
+    test_segments();
 
     {
         input_array<std::string, 4> some_strings = {{"This","is","his","face"}};
@@ -0,0 +1,67 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/span.hpp>
+#include <range/v3/view/lines.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+using namespace ranges;
+
+namespace
+{
+    std::vector<std::string> lines_of(std::string const &text)
+    {
+        return text | view::lines | view::transform([](span<char const> s) {
+            return std::string(s.begin(), s.end()); });
+    }
+}
+
+int main()
+{
+    std::string const text = "Now is\nthe time\n\nfor all\ngood men\n";
+    auto rng = text | view::lines;
+    using Rng = decltype(rng);
+    CONCEPT_ASSERT(ForwardView<Rng>());
+    CONCEPT_ASSERT(BoundedRange<Rng>());
+    CONCEPT_ASSERT(Same<range_value_t<Rng>, span<char const>>());
+    ::check_equal(lines_of(text), {"Now is", "the time", "", "for all", "good men"});
+
+    // Lines point into the original text.
+    CHECK((*begin(rng)).data() == text.data());
+    CHECK((*next(begin(rng), 2)).data() == text.data() + 16);
+    CHECK((*next(begin(rng), 2)).size() == 0);
+
+    // Like std::getline: a final line without '\n' counts, and there is no
+    // empty line after a final '\n'.
+    ::check_equal(lines_of("a\nb"), {"a", "b"});
+    ::check_equal(lines_of("a\n"), {"a"});
+    ::check_equal(lines_of("\n"), {""});
+    ::check_equal(lines_of("\n\n"), {"", ""});
+    CHECK(lines_of("").empty());
+
+    // Lines of a mutable range are mutable.
+    std::vector<char> v(text.begin(), text.end());
+    for(span<char> line : v | view::lines)
+        if(!line.empty())
+            line[0] = '*';
+    CHECK(std::string(v.begin(), v.end()) == "*ow is\n*he time\n\n*or all\n*ood men\n");
+
+    char const chars[] = {'x', '\n', 'y'};
+    ::check_equal(lines_of(std::string(chars, 3)), {"x", "y"});
+    CHECK(distance(chars | view::lines) == 2);
+
+    return ::test_result();
+}
@@ -1,5 +1,7 @@
 #include <range/v3/view/sample.hpp>
+#include <range/v3/algorithm/adjacent_find.hpp>
 #include <range/v3/algorithm/equal.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
 #include <numeric>
 #include <vector>
 #include <random>
@@ -27,5 +29,17 @@ int main ()
         CHECK(ranges::equal(rng, tmp));
     }
 
+    // Random numbers are drawn per element of the sample, not of the population.
+    {
+        std::vector<int> big(1000000);
+        std::iota(std::begin(big), std::end(big), 0);
+        counting_engine<std::mt19937> engine;
+        std::vector<int> const got = big | view::sample(10, engine);
+        CHECK(got.size() == 10u);
+        CHECK(ranges::is_sorted(got));
+        CHECK(ranges::adjacent_find(got) == got.end());
+        CHECK(engine.draws_ < 200u);
+    }
+
     return ::test_result();
 }
@@ -264,5 +264,15 @@ int main()
     //     begin(empty_range); // infinite loop!
     // }
 
+    // inputs of very different sizes, where one is skipped through by galloping
+    {
+        std::vector<int> big = view::iota(0, 10000) | view::transform([](int i){return 3 * i;});
+        std::vector<int> small = {-1, 5, 9, 3000, 3001, 3003, 29997, 40000};
+        ::check_equal(view::set_difference(small, big), {-1, 5, 3001, 40000});
+        ::check_equal(view::set_difference(small, view::ints(0) | view::stride(3)),
+                      {-1, 5, 3001, 40000});
+        CHECK(distance(view::set_difference(big, small)) == 9996);
+    }
+
     return test_result();
 }
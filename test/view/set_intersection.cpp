@@ -10,6 +10,9 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <algorithm>
+#include <cstdint>
+#include <random>
 #include <vector>
 #include <sstream>
 #include <range/v3/core.hpp>
@@ -224,5 +227,77 @@ int main()
     }
 
 
+    // inputs of very different sizes, where one is skipped through by galloping
+    {
+        std::vector<int> big = view::iota(0, 10000) | view::transform([](int i){return 3 * i;});
+        std::vector<int> small = {-1, 5, 9, 3000, 3001, 3003, 29997, 40000};
+        ::check_equal(view::set_intersection(big, small), {9, 3000, 3003, 29997});
+        ::check_equal(view::set_intersection(small, big), {9, 3000, 3003, 29997});
+        ::check_equal(view::set_intersection(small, view::ints(0) | view::stride(3)),
+                      {9, 3000, 3003, 29997});
+    }
+
+    // contiguous integers, skipped through a block at a time
+    {
+        std::mt19937 gen;
+        for(int range : {20, 1000, 64000})
+        {
+            std::uniform_int_distribution<int> dist(0, range - 1);
+            std::vector<std::uint32_t> a(1000), b(800);
+            std::vector<std::int64_t> c(1000), d(800);
+            for(std::size_t i = 0; i < a.size(); ++i)
+                c[i] = -static_cast<std::int64_t>(a[i] = static_cast<std::uint32_t>(dist(gen)));
+            for(std::size_t i = 0; i < b.size(); ++i)
+                d[i] = -static_cast<std::int64_t>(b[i] = static_cast<std::uint32_t>(dist(gen)));
+            std::sort(a.begin(), a.end());
+            std::sort(b.begin(), b.end());
+            std::sort(c.begin(), c.end());
+            std::sort(d.begin(), d.end());
+            std::vector<std::uint32_t> expected;
+            std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                std::back_inserter(expected));
+            std::vector<std::int64_t> expected2;
+            std::set_intersection(c.begin(), c.end(), d.begin(), d.end(),
+                std::back_inserter(expected2));
+
+            ::check_equal(view::set_intersection(a, b), expected);
+            ::check_equal(view::set_intersection(b, a), expected);
+            ::check_equal(view::set_intersection(c, d), expected2);
+            ::check_equal(view::set_intersection(d, c), expected2);
+        }
+    }
+
+    // intersection of more than two ranges
+    {
+        std::vector<int> a = {1, 2, 2, 3, 3, 3, 4, 5, 7, 9, 9};
+        std::vector<int> b = {0, 2, 2, 3, 3, 5, 7, 8, 9, 9};
+        std::vector<int> c = {2, 3, 3, 3, 4, 9, 9, 9};
+        auto res = view::set_intersection(a, b, c);
+
+        models<concepts::ForwardView>(res);
+        models_not<concepts::RandomAccessView>(res);
+        models_not<concepts::BoundedView>(res);
+
+        using R = decltype(res);
+        CONCEPT_ASSERT(Same<range_value_t<R>, int>());
+        CONCEPT_ASSERT(Same<range_reference_t<R>, int&>());
+        CONCEPT_ASSERT(range_cardinality<R>::value == ranges::finite);
+
+        ::check_equal(res, {2, 3, 3, 9, 9});
+        ::check_equal(view::set_intersection(c, b, a), {2, 3, 3, 9, 9});
+        ::check_equal(view::set_intersection(a, b, c, view::ints(3, 9)), {3});
+        std::vector<int> none;
+        CHECK(empty(view::set_intersection(a, b, c, none)));
+
+        // with infinite ranges, and with other value types
+        auto res2 = view::set_intersection(view::ints(0) | view::stride(2), i2_infinite,
+            view::ints(0) | view::stride(3));
+        CONCEPT_ASSERT(range_cardinality<decltype(res2)>::value == unknown);
+        ::check_equal(res2 | view::take(4), {0, 36, 144, 324});
+
+        std::vector<long> d = {3, 9, 10};
+        ::check_equal(view::set_intersection(a, c, d), {3, 9});
+    }
+
     return test_result();
 }
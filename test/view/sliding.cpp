@@ -12,8 +12,12 @@
 
 #include <forward_list>
 #include <list>
+#include <sstream>
+#include <string>
 #include <vector>
 #include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/span.hpp>
 #include <range/v3/view/cycle.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/repeat.hpp>
@@ -178,5 +182,53 @@ int main()
         ::check_equal(*next(it,27), {6,0,1});
     }
 
+    {
+        // Input ranges are read into a buffer, and each window is a span of it.
+        for(std::size_t capacity : {3u, 4u, 7u, 100u})
+        {
+            std::istringstream sin{"0 1 2 3 4 5 6 7 8 9"};
+            auto rng = istream<int>(sin) | view::sliding(K, capacity);
+            ::models<concepts::InputRange>(rng);
+            ::models_not<concepts::ForwardRange>(rng);
+            CONCEPT_ASSERT(Same<range_value_t<decltype(rng)>, span<int>>());
+            int i = 0;
+            for(auto it = rng.begin(); it != rng.end(); ++it, ++i)
+                ::check_equal(*it, {i, i + 1, i + 2});
+            CHECK(i == 8);
+        }
+        {
+            std::istringstream sin{"0 1 2 3 4 5 6 7 8 9"};
+            auto rng = view::sliding(istream<int>(sin), 4);
+            int i = 0;
+            for(auto it = rng.begin(); it != rng.end(); ++it, ++i)
+                ::check_equal(*it, {i, i + 1, i + 2, i + 3});
+            CHECK(i == 7);
+        }
+        {
+            // Forward ranges ignore the capacity.
+            std::vector<int> v{0, 1, 2, 3};
+            auto rng = v | view::sliding(K, 100);
+            ::models<concepts::RandomAccessRange>(rng);
+            ::check_equal(*rng.begin(), {0, 1, 2});
+            CHECK(distance(rng) == 2);
+            ::check_equal(*view::sliding(v, 2, 2).begin(), {0, 1});
+        }
+        {
+            // Fewer elements than a window.
+            std::istringstream sin{"0 1"};
+            auto rng = istream<int>(sin) | view::sliding(K);
+            CHECK(rng.begin() == rng.end());
+        }
+        {
+            std::istringstream sin{"a b c d"};
+            auto rng = istream<std::string>(sin) | view::sliding(2);
+            auto it = rng.begin();
+            ::check_equal(*it, {"a", "b"});
+            ::check_equal(*++it, {"b", "c"});
+            ::check_equal(*++it, {"c", "d"});
+            CHECK(++it == rng.end());
+        }
+    }
+
     return ::test_result();
 }
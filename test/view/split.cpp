@@ -10,6 +10,7 @@
 // Project home: https://github.com/ericniebler/range-v3
 
 #include <string>
+#include <vector>
 #include <cctype>
 #include <range/v3/core.hpp>
 #include <range/v3/view/counted.hpp>
@@ -38,6 +39,27 @@ namespace
     {
         return {&sz[0], &sz[N-1]};
     }
+
+    template<typename Rng>
+    std::vector<std::string> fields(Rng && rng)
+    {
+        std::vector<std::string> v;
+        for(auto it = ranges::begin(rng); it != ranges::end(rng); ++it)
+            v.push_back(ranges::to_<std::string>(*it));
+        return v;
+    }
+
+    // Splitting a contiguous range must give the same fields as splitting the
+    // same elements through a forward iterator, which takes the generic path.
+    template<typename Delim>
+    void check_contiguous(std::string const &str, Delim const &delim)
+    {
+        using namespace ranges;
+        using I = forward_iterator<std::string::const_iterator>;
+        auto contig = view::split(str, delim);
+        auto generic = make_iterator_range(I{str.begin()}, I{str.end()}) | view::split(delim);
+        ::check_equal(fields(contig), fields(generic));
+    }
 }
 
 int main()
@@ -155,5 +177,48 @@ int main()
         }
     }
 
+    {
+        std::string str("a,b,,c,");
+        auto rng = view::split(str, ',');
+        using Field = range_reference_t<decltype(rng)>;
+        CONCEPT_ASSERT(ForwardRange<decltype(rng)>());
+        CONCEPT_ASSERT(SizedRange<Field>());
+        CONCEPT_ASSERT(RandomAccessRange<Field>());
+        CONCEPT_ASSERT(Same<range_iterator_t<Field>, std::string::iterator>());
+        ::check_equal(fields(rng), {"a", "b", "", "c"});
+        CHECK((*begin(rng)).size() == 1u);
+        CHECK(&*begin(*next(begin(rng), 3)) == &str[5]);
+        ::check_equal(fields(view::split(str, c_str(",,"))), {"a,b", "c,"});
+        auto const &crng = rng;
+        ::check_equal(fields(crng), {"a", "b", "", "c"});
+    }
+
+    for(std::string const &str : {std::string{}, std::string{","}, std::string{",,a"},
+        std::string{"abc"}, std::string{"a,b,,c,"}, std::string{"aaaa,aa,a"},
+        std::string{"x,,,,y,,z,,"}})
+    {
+        check_contiguous(str, ',');
+        check_contiguous(str, 'a');
+        check_contiguous(str, c_str(","));
+        check_contiguous(str, c_str(",,"));
+        check_contiguous(str, c_str("aa"));
+        check_contiguous(str, c_str("a,,"));
+        check_contiguous(str, view::empty<char>());
+    }
+
+    {
+        // Elements that memchr cannot search for.
+        std::vector<int> v{1, 0, 2, 3, 0, 0, 4};
+        auto rng = view::split(v, 0);
+        CONCEPT_ASSERT(SizedRange<range_reference_t<decltype(rng)>>());
+        CHECK(distance(rng) == 4);
+        check_equal(*begin(rng), {1});
+        check_equal(*next(begin(rng), 1), {2, 3});
+        CHECK(empty(*next(begin(rng), 2)));
+        check_equal(*next(begin(rng), 3), {4});
+        int const pat[] = {0, 0};
+        CHECK(distance(view::split(v, pat)) == 2);
+    }
+
     return test_result();
 }
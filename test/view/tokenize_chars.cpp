@@ -0,0 +1,122 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/tokenize_chars.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+namespace
+{
+    template<typename Rng>
+    std::vector<std::string> tokens(Rng && rng)
+    {
+        std::vector<std::string> v;
+        for(auto it = ranges::begin(rng); it != ranges::end(rng); ++it)
+            v.push_back(ranges::to_<std::string>(*it));
+        return v;
+    }
+
+    template<typename Class>
+    std::vector<std::string> naive_tokens(std::string const &str, Class cls)
+    {
+        std::vector<std::string> v;
+        std::string tok;
+        for(char c : str)
+        {
+            if(cls(c))
+                tok += c;
+            else if(!tok.empty())
+            {
+                v.push_back(tok);
+                tok.clear();
+            }
+        }
+        if(!tok.empty())
+            v.push_back(tok);
+        return v;
+    }
+
+    // More distinct sets of low nibbles than the vector scan can tell apart.
+    using scattered = ranges::char_class::any_of<'\x01', '\x12', '\x23', '\x34', '\x45',
+        '\x56', '\x67', '\x78', '\x89', '\x9A'>;
+
+    template<typename Class>
+    void check_class(std::string const &str, Class cls)
+    {
+        using namespace ranges;
+        ::check_equal(tokens(view::tokenize_chars(str, cls)), naive_tokens(str, cls));
+        std::list<char> const lst(str.begin(), str.end());
+        ::check_equal(tokens(view::tokenize_chars(lst, cls)), naive_tokens(str, cls));
+    }
+}
+
+int main()
+{
+    using namespace ranges;
+
+    std::string const txt = "  hello, world!\tfoo_bar 42\n";
+    ::check_equal(tokens(view::tokenize_chars(txt, char_class::word{})),
+        {"hello", "world", "foo_bar", "42"});
+    ::check_equal(tokens(txt | view::tokenize_chars(char_class::not_<char_class::space>{})),
+        {"hello,", "world!", "foo_bar", "42"});
+    ::check_equal(tokens(txt | view::tokenize_chars(char_class::alpha{})),
+        {"hello", "world", "foo", "bar"});
+    ::check_equal(tokens(txt | view::tokenize_chars(char_class::punct{})), {",", "!", "_"});
+    ::check_equal(tokens(txt | view::tokenize_chars(
+        char_class::or_<char_class::digit, char_class::any_of<'o', 'l'>>{})),
+        {"llo", "o", "l", "oo", "42"});
+    std::string const empty, spaces = "   ";
+    CHECK(tokens(empty | view::tokenize_chars(char_class::alnum{})).empty());
+    CHECK(tokens(spaces | view::tokenize_chars(char_class::alnum{})).empty());
+
+    {
+        auto rng = txt | view::tokenize_chars(char_class::word{});
+        using Token = range_reference_t<decltype(rng)>;
+        CONCEPT_ASSERT(ForwardView<decltype(rng)>());
+        CONCEPT_ASSERT(SizedRange<Token>());
+        CONCEPT_ASSERT(Same<range_iterator_t<Token>, std::string::const_iterator>());
+        CHECK(&*begin(*begin(rng)) == &txt[2]);
+        CHECK(size(*next(begin(rng), 2)) == 7u);
+        auto const &crng = rng;
+        ::check_equal(tokens(crng), {"hello", "world", "foo_bar", "42"});
+    }
+
+    // Long texts of all bytes, which take the vector scan where there is one.
+    std::mt19937 gen;
+    for(std::size_t n : {31u, 32u, 33u, 100u, 4096u})
+    {
+        for(int spread : {2, 16, 256})
+        {
+            std::uniform_int_distribution<int> byte(0, 255);
+            std::uniform_int_distribution<int> len(1, spread);
+            std::string str;
+            while(str.size() < n)
+            {
+                char const c = static_cast<char>(byte(gen));
+                str.append(static_cast<std::size_t>(len(gen)), c);
+            }
+            str.resize(n);
+            check_class(str, char_class::space{});
+            check_class(str, char_class::word{});
+            check_class(str, char_class::not_<char_class::alnum>{});
+            check_class(str, char_class::xdigit{});
+            check_class(str, scattered{});
+            check_class(str, char_class::not_<scattered>{});
+        }
+    }
+
+    return test_result();
+}